@@ -17,6 +17,15 @@
 
 #include "ct_types.h"
 
+/* Geometry limits (CT-MATH-001 §8.7) */
+#define CT_AUGMENT_MAX_EXTENT   16384U              /* Largest input or output side */
+#define CT_AUGMENT_MAX_ANGLE    51472               /* π/4, Q16.16 radians */
+#define CT_AUGMENT_SCALE_MIN    FIXED_HALF          /* Smallest zoom, 0.5 */
+#define CT_AUGMENT_SCALE_MAX    (2 * FIXED_ONE)     /* Largest zoom, 2.0 */
+
+/* Cutout limit (CT-MATH-001 §8.8) */
+#define CT_AUGMENT_MAX_CUTOUTS  64U                 /* Largest cutout_count */
+
 /**
  * @brief Initialize augmentation context.
  * @param ctx Augmentation context
@@ -30,14 +39,72 @@ void ct_augment_init(ct_augment_ctx_t *ctx,
                      uint32_t epoch,
                      ct_augment_flags_t flags);
 
+/**
+ * @brief Prove whether adding noise can saturate samples in a value range.
+ * @param ctx Augmentation context (noise_std must be set; noise_plan_std
+ *            is set on success)
+ * @param data_range Range of every element reaching the noise step
+ * @return 1 if the noise accumulation cannot saturate (unchecked kernel
+ *         selected while noise_std is unchanged), 0 otherwise
+ * @note Generating the noise term itself can still saturate for extreme
+ *       uniforms; that step stays checked.
+ * @traceability CT-MATH-001 §14.5
+ */
+int ct_augment_plan(ct_augment_ctx_t *ctx, ct_range_t data_range);
+
+/**
+ * @brief Draw the flip, crop and geometry decisions of a run of samples.
+ * @param ctx Augmentation context
+ * @param first_idx Global sample index of plan[0]; plan[i] belongs to
+ *                  first_idx + i
+ * @param count Number of samples
+ * @param plan Receives count decision records
+ * @note One strided PRNG fill per enabled decision covers the whole run.
+ *       Executing plan[i] gives bit for bit what ct_augment_sample and
+ *       ct_augment_geometry give for its index; crop draws are bounded by
+ *       the sample's shape only then. Cutout and noise are drawn during
+ *       execution, as their draw counts depend on earlier draws and on the
+ *       sample size. The records are plain data and can be logged as is.
+ * @traceability CT-MATH-001 §8.10
+ */
+void ct_augment_plan_batch(const ct_augment_ctx_t *ctx,
+                           uint32_t first_idx,
+                           uint32_t count,
+                           ct_augment_decision_t *plan);
+
+/**
+ * @brief As ct_augment_sample, with the decisions taken from a plan record.
+ * @traceability CT-MATH-001 §6, §8.8, §8.10
+ */
+void ct_augment_sample_planned(const ct_augment_ctx_t *ctx,
+                               const ct_augment_decision_t *decision,
+                               const ct_sample_t *input,
+                               ct_sample_t *output,
+                               ct_fault_flags_t *faults);
+
+/**
+ * @brief As ct_augment_geometry, with the transform taken from a plan record.
+ * @traceability CT-MATH-001 §8.7, §8.10
+ */
+void ct_augment_geometry_planned(const ct_augment_ctx_t *ctx,
+                                 const ct_augment_decision_t *decision,
+                                 const ct_sample_t *input,
+                                 ct_sample_t *output,
+                                 ct_fault_flags_t *faults);
+
 /**
  * @brief Augment single sample.
  * @param ctx Augmentation context
  * @param input Input sample
  * @param output Output sample (augmented)
  * @param sample_idx Global sample index (for PRNG)
- * @param faults Fault flags
- * @traceability REQ-AUG-002, CT-MATH-001 §6
+ * @param faults Fault flags (domain error if cutout is enabled with
+ *               cutout_count above CT_AUGMENT_MAX_CUTOUTS or on a sample
+ *               that is not [H], [H, W] or [C, H, W]; cutout is then skipped)
+ * @note Cutout runs last, after noise, so erased pixels hold exactly the
+ *       fill. Rectangles larger than the image are clipped to it; the same
+ *       rectangles are erased in every channel plane.
+ * @traceability REQ-AUG-002, CT-MATH-001 §6, §8.8
  */
 void ct_augment_sample(const ct_augment_ctx_t *ctx,
                        const ct_sample_t *input,
@@ -45,13 +112,91 @@ void ct_augment_sample(const ct_augment_ctx_t *ctx,
                        uint32_t sample_idx,
                        ct_fault_flags_t *faults);
 
+/**
+ * @brief Apply the geometric augmentations as one bilinear warp.
+ * @param ctx Augmentation context: flags rot90, affine and resize with
+ *            resize_height/resize_width, affine_max_angle and
+ *            affine_scale_min/affine_scale_max
+ * @param input Q16.16 sample, [H, W] or [C, H, W] (each channel plane is
+ *              warped alike)
+ * @param output Receives header and data; output->data must hold
+ *               C × resize_height × resize_width elements with resize,
+ *               else C × H × W, and must not overlap the input
+ * @param sample_idx Global sample index (for PRNG)
+ * @param faults Fault flags (domain error on an invalid sample or parameter;
+ *               output is then untouched)
+ * @note Quarter turns, rotation by θ ∈ [−max, max] about the centre, zoom
+ *       by s ∈ [scale_min, scale_max] and resizing compose into a single
+ *       integer sampling map, so every output pixel is interpolated once.
+ *       Without geometry flags the sample is copied. Runs before
+ *       ct_augment_sample, which works in place on the result;
+ *       ct_augment_batch does not apply it.
+ * @traceability CT-MATH-001 §8.1, §8.7
+ */
+void ct_augment_geometry(const ct_augment_ctx_t *ctx,
+                         const ct_sample_t *input,
+                         ct_sample_t *output,
+                         uint32_t sample_idx,
+                         ct_fault_flags_t *faults);
+
+/**
+ * @brief Augment single narrow (int16) sample.
+ * @param ctx Augmentation context (noise_std is Q16.16 and is narrowed to
+ *            the sample's dtype)
+ * @param input Input sample (CT_DTYPE_Q8_8 or CT_DTYPE_Q1_15)
+ * @param output Output sample (augmented)
+ * @param sample_idx Global sample index (for PRNG)
+ * @param faults Fault flags (domain error on unknown dtype)
+ * @note Flip and crop decisions match ct_augment_sample for the same
+ *       sample_idx. Noise is std × r with r the top 16 PRNG bits as Q1.15.
+ * @traceability CT-MATH-001 §3.10, §6
+ */
+void ct_augment_sample16(const ct_augment_ctx_t *ctx,
+                         const ct_sample16_t *input,
+                         ct_sample16_t *output,
+                         uint32_t sample_idx,
+                         ct_fault_flags_t *faults);
+
+/**
+ * @brief Mix the samples of a batch pairwise (mixup and cutmix).
+ * @param ctx Augmentation context: flags mixup and/or cutmix with
+ *            mix_lambda_min/mix_lambda_max (0 ≤ min ≤ max ≤ 1.0)
+ * @param input Filled batch; its samples are only read
+ * @param output Batch with input's batch_size; receives the sample headers,
+ *               sample hashes and batch hash, with sample data in buf
+ * @param buf Storage for the mixed data, samples back to back; must not
+ *            overlap the input samples
+ * @param capacity buf size in elements
+ * @param labels batch_size records: each slot's partner and own label weight
+ * @return 0 on success, -1 if the λ range is invalid, the filled samples
+ *         differ in shape or dtype, buf is too small, or cutmix meets a
+ *         sample that is not [H], [H, W] or [C, H, W] (nothing written)
+ * @note Each filled slot draws a partner among the other filled slots and
+ *       an own weight λ from [min, max]. Mixup blends the whole sample,
+ *       λ·own + (1 − λ)·partner, with the dispatched lerp_q16 kernel.
+ *       Cutmix pastes a partner rectangle covering about 1 − λ of every
+ *       channel plane; the label weight is the exact uncovered share. With
+ *       both flags each slot picks one at random. Padding slots and batches
+ *       with a single filled sample pass through with weight 1.0. Hashes
+ *       are copied: the commitment still names the source samples.
+ * @traceability CT-MATH-001 §8.9
+ */
+int ct_augment_mix_batch(const ct_augment_ctx_t *ctx,
+                         const ct_batch_t *input,
+                         ct_batch_t *output,
+                         int32_t *buf,
+                         uint32_t capacity,
+                         ct_mix_label_t *labels);
+
 /**
  * @brief Augment entire batch.
  * @param ctx Augmentation context
  * @param input Input batch
  * @param output Output batch (augmented)
  * @param faults Fault flags
- * @traceability REQ-AUG-003
+ * @note Decisions are planned in runs of up to 64 samples
+ *       (ct_augment_plan_batch), then executed.
+ * @traceability REQ-AUG-003, CT-MATH-001 §8.10
  */
 void ct_augment_batch(const ct_augment_ctx_t *ctx,
                       const ct_batch_t *input,
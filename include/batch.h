@@ -45,6 +45,117 @@ void ct_batch_fill(ct_batch_t *batch,
                    uint32_t epoch,
                    uint64_t seed);
 
+/**
+ * @brief Fill batch from an epoch that uses only part of the dataset.
+ * @param batch Batch to fill
+ * @param dataset Source dataset
+ * @param epoch_samples M: the epoch is the first M positions of the
+ *                      permutation of all num_samples
+ * @param batch_index Index of this batch, below ceil(M / batch_size)
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @return 0 on success, -1 if M is 0 or above num_samples (batch unchanged)
+ * @note A uniformly random M-subset, fresh every epoch, in random order.
+ *       Only the M selected samples are permuted and hashed; the last batch
+ *       is partial at M. With M = num_samples this is ct_batch_fill. Record
+ *       M in ct_config_t.epoch_samples.
+ * @traceability CT-MATH-001 §7.8, §9.1
+ */
+int ct_batch_fill_subset(ct_batch_t *batch,
+                         const ct_dataset_t *dataset,
+                         uint32_t epoch_samples,
+                         uint32_t batch_index,
+                         uint32_t epoch,
+                         uint64_t seed);
+
+/**
+ * @brief Fill batch from the samples an exclusion keeps.
+ * @param batch Batch to fill
+ * @param dataset Source dataset, unchanged by the exclusion
+ * @param exclusion Exclusion over the dataset (exclusion.h)
+ * @param batch_index Index of this batch, below ceil(num_kept / batch_size)
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @return 0 on success, -1 if the exclusion covers another dataset size or
+ *         keeps nothing (batch unchanged)
+ * @note The epoch permutes the num_kept survivors; each position maps to
+ *       its original index with ct_exclusion_select. Excluded samples are
+ *       never read or hashed. Commit to the result with
+ *       ct_hash_dataset_excluding.
+ * @traceability CT-MATH-001 §7.9, §9.1
+ */
+int ct_batch_fill_excluding(ct_batch_t *batch,
+                            const ct_dataset_t *dataset,
+                            const ct_exclusion_t *exclusion,
+                            uint32_t batch_index,
+                            uint32_t epoch,
+                            uint64_t seed);
+
+/**
+ * @brief Fill batch with samples drawn from an alias table.
+ * @param batch Batch to fill
+ * @param dataset Source dataset
+ * @param sampler Table from ct_alias_build over the dataset's weights
+ * @param batch_index Index of this batch
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @return 0 on success, -1 if the sampler does not cover the dataset
+ *         (batch unchanged)
+ * @note An epoch is still num_samples draws, batched and padded as in
+ *       ct_batch_fill; slot i of batch b holds draw b × batch_size + i.
+ *       Samples may repeat. Record the sampler in ct_config_t.
+ * @traceability CT-MATH-001 §7.6, §9.1
+ */
+int ct_batch_fill_weighted(ct_batch_t *batch,
+                           const ct_dataset_t *dataset,
+                           const ct_alias_table_t *sampler,
+                           uint32_t batch_index,
+                           uint32_t epoch,
+                           uint64_t seed);
+
+/**
+ * @brief Fill batch with a fixed class mix (stratified ordering).
+ * @param batch Batch of strata->batch_size slots
+ * @param dataset Source dataset
+ * @param strata Strata from ct_strata_build over the dataset's labels
+ * @param batch_index Index of this batch
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @return 0 on success, -1 if the batch size or dataset size does not match
+ *         the strata (batch unchanged)
+ * @note Every batch is full: quota[c] samples of class c at the slots fixed
+ *       by the strata, taken from class c's stream at batch_index × quota[c].
+ *       O(batch_size); nothing is scanned. Record the strata in ct_config_t.
+ * @traceability CT-MATH-001 §7.7
+ */
+int ct_batch_fill_stratified(ct_batch_t *batch,
+                             const ct_dataset_t *dataset,
+                             const ct_strata_t *strata,
+                             uint32_t batch_index,
+                             uint32_t epoch,
+                             uint64_t seed);
+
+/**
+ * @brief Fill batch from a weighted mixture of datasets.
+ * @param batch Batch to fill
+ * @param mixture Mixture from ct_mixture_build (mixture.h)
+ * @param batch_index Index of this batch, below ceil(epoch_samples / batch_size)
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @return 0 on success, -1 if the batch starts past the epoch (batch
+ *         unchanged)
+ * @note Slot i of batch b holds position b × batch_size + i; the last batch
+ *       is partial at epoch_samples. sample_hashes[i] is the mixture leaf of
+ *       the slot's source and sample, so the batch hash names every source.
+ *       Commit to the mixture with its mixture_hash.
+ * @traceability CT-MATH-001 §7.10, §9.1
+ */
+int ct_batch_fill_mixture(ct_batch_t *batch,
+                          const ct_mixture_t *mixture,
+                          uint32_t batch_index,
+                          uint32_t epoch,
+                          uint64_t seed);
+
 /**
  * @brief Get sample from batch.
  * @param batch Source batch
@@ -62,4 +173,147 @@ const ct_sample_t* ct_batch_get_sample(const ct_batch_t *batch, uint32_t index);
  */
 int ct_batch_verify(const ct_batch_t *batch);
 
+/**
+ * @brief Copy a batch's sample data into one contiguous buffer.
+ * @param batch Filled batch; sample data pointers are redirected into buf
+ * @param buf Destination, samples laid out back to back
+ * @param capacity buf size in elements
+ * @return 0 on success, -1 if buf is too small (batch unchanged)
+ * @note Hashes stay valid: only where the data lives changes. Use before
+ *       exporting a batch whose samples still point into the dataset.
+ * @traceability CT-STRUCT-001 §22
+ */
+int ct_batch_pack(ct_batch_t *batch, int32_t *buf, uint32_t capacity);
+
+/*===========================================================================*/
+/* Compact batches (CT-STRUCT-001 §10.1)                                     */
+/*===========================================================================*/
+
+/**
+ * @brief Initialize compact batch descriptor.
+ * @param batch Descriptor to initialize
+ * @param refs Pre-allocated reference array (batch_size entries)
+ * @param batch_size Maximum samples per batch
+ * @traceability CT-STRUCT-001 §10.1
+ */
+void ct_batch_ref_init(ct_batch_ref_t *batch,
+                       ct_sample_ref_t *refs,
+                       uint32_t batch_size);
+
+/**
+ * @brief Fill compact batch with shuffled dataset indices.
+ * @param batch Descriptor to fill
+ * @param num_samples Dataset size N
+ * @param leaf_hashes Dataset leaf hashes (ct_hash_dataset_leaves)
+ * @param batch_index Index of this batch
+ * @param epoch Current epoch
+ * @param seed Random seed
+ * @note Selects the same samples and yields the same batch_hash as
+ *       ct_batch_fill, without touching sample data.
+ * @traceability CT-MATH-001 §9.1, CT-STRUCT-001 §10.1
+ */
+void ct_batch_ref_fill(ct_batch_ref_t *batch,
+                       uint32_t num_samples,
+                       const ct_hash_t *leaf_hashes,
+                       uint32_t batch_index,
+                       uint32_t epoch,
+                       uint64_t seed);
+
+/**
+ * @brief As ct_batch_ref_fill, for an epoch of the first M positions.
+ * @return 0 on success, -1 if M is 0 or above num_samples
+ * @note Selects the same samples and yields the same batch_hash as
+ *       ct_batch_fill_subset.
+ * @traceability CT-MATH-001 §7.8, CT-STRUCT-001 §10.1
+ */
+int ct_batch_ref_fill_subset(ct_batch_ref_t *batch,
+                             uint32_t num_samples,
+                             const ct_hash_t *leaf_hashes,
+                             uint32_t epoch_samples,
+                             uint32_t batch_index,
+                             uint32_t epoch,
+                             uint64_t seed);
+
+/**
+ * @brief As ct_batch_ref_fill, over the samples an exclusion keeps.
+ * @return 0 on success, -1 if the exclusion covers another dataset size or
+ *         keeps nothing
+ * @note Selects the same samples and yields the same batch_hash as
+ *       ct_batch_fill_excluding. The leaf hashes are the full dataset's.
+ * @traceability CT-MATH-001 §7.9, CT-STRUCT-001 §10.1
+ */
+int ct_batch_ref_fill_excluding(ct_batch_ref_t *batch,
+                                uint32_t num_samples,
+                                const ct_hash_t *leaf_hashes,
+                                const ct_exclusion_t *exclusion,
+                                uint32_t batch_index,
+                                uint32_t epoch,
+                                uint64_t seed);
+
+/**
+ * @brief As ct_batch_ref_fill, with indices drawn from an alias table.
+ * @return 0 on success, -1 if sampler->num_samples differs from num_samples
+ * @note Selects the same samples and yields the same batch_hash as
+ *       ct_batch_fill_weighted.
+ * @traceability CT-MATH-001 §7.6, CT-STRUCT-001 §10.1
+ */
+int ct_batch_ref_fill_weighted(ct_batch_ref_t *batch,
+                               uint32_t num_samples,
+                               const ct_hash_t *leaf_hashes,
+                               const ct_alias_table_t *sampler,
+                               uint32_t batch_index,
+                               uint32_t epoch,
+                               uint64_t seed);
+
+/**
+ * @brief As ct_batch_ref_fill, with the stratified ordering.
+ * @return 0 on success, -1 if batch_size differs from the strata's
+ * @note Selects the same samples and yields the same batch_hash as
+ *       ct_batch_fill_stratified. original_index is the slot's position
+ *       batch_index × batch_size + i.
+ * @traceability CT-MATH-001 §7.7, CT-STRUCT-001 §10.1
+ */
+int ct_batch_ref_fill_stratified(ct_batch_ref_t *batch,
+                                 const ct_hash_t *leaf_hashes,
+                                 const ct_strata_t *strata,
+                                 uint32_t batch_index,
+                                 uint32_t epoch,
+                                 uint64_t seed);
+
+/**
+ * @brief Select the commitment a compact batch carries.
+ * @param batch Compact batch (re-fill or re-hash afterwards)
+ * @param hash_mode CT_BATCH_HASH_CONTENT or CT_BATCH_HASH_REFERENCE
+ * @param dataset_hash Trusted dataset root (ct_hash_dataset); ignored in
+ *                     content mode
+ * @return 0 on success, -1 for an unknown mode (batch unchanged)
+ * @note Record the same mode in ct_config_t so it enters the config hash.
+ * @traceability CT-MATH-001 §10.8
+ */
+int ct_batch_ref_set_hash_mode(ct_batch_ref_t *batch,
+                               uint32_t hash_mode,
+                               const ct_hash_t dataset_hash);
+
+/**
+ * @brief Resolve a slot of a compact batch to a sample view.
+ * @param batch Compact batch
+ * @param dataset Dataset the batch was filled from
+ * @param index Slot index within batch
+ * @return Pointer to the dataset sample, or NULL for an invalid or
+ *         padding slot
+ * @traceability CT-STRUCT-001 §10.1
+ */
+const ct_sample_t* ct_batch_ref_resolve(const ct_batch_ref_t *batch,
+                                        const ct_dataset_t *dataset,
+                                        uint32_t index);
+
+/**
+ * @brief Verify compact batch hash.
+ * @param batch Compact batch
+ * @param leaf_hashes Dataset leaf hashes
+ * @return 1 if valid, 0 if invalid
+ * @traceability CT-STRUCT-001 §10.1
+ */
+int ct_batch_ref_verify(const ct_batch_ref_t *batch, const ct_hash_t *leaf_hashes);
+
 #endif /* CT_BATCH_H */
@@ -30,6 +30,17 @@
 #define FIXED_MIN     INT32_MIN                /* 0x80000000 */
 #define FIXED_EPS     1                        /* 0x00000001 */
 
+/*===========================================================================*/
+/* Data Types (CT-MATH-001 §3.10)                                            */
+/*===========================================================================*/
+
+#define CT_DTYPE_Q16_16       0   /* int32, 16 fractional bits */
+#define CT_DTYPE_Q8_8         1   /* int16, 8 fractional bits */
+#define CT_DTYPE_Q1_15        2   /* int16, 15 fractional bits */
+
+#define CT_FRAC_Q8_8          8
+#define CT_FRAC_Q1_15         15
+
 /*===========================================================================*/
 /* Configuration                                                              */
 /*===========================================================================*/
@@ -46,6 +57,11 @@
 #define CT_DOMAIN_BATCH       0x02
 #define CT_DOMAIN_PROVENANCE  0x03
 #define CT_DOMAIN_EPOCH_CHAIN 0x04
+#define CT_DOMAIN_BATCH_REF   0x05
+#define CT_DOMAIN_ALIAS       0x06
+#define CT_DOMAIN_STRATA      0x07
+#define CT_DOMAIN_EXCLUSION   0x08
+#define CT_DOMAIN_MIXTURE     0x09
 
 /*===========================================================================*/
 /* Hash Type                                                                  */
@@ -53,6 +69,23 @@
 
 typedef uint8_t ct_hash_t[32];
 
+/*===========================================================================*/
+/* Streaming Merkle Accumulator (CT-MATH-001 §10.4)                          */
+/*===========================================================================*/
+
+typedef struct {
+    ct_hash_t level[32];           /**< Complete subtree of 2^k leaves if bit k of count */
+    uint32_t count;                /**< Leaves pushed so far */
+} ct_merkle_acc_t;
+
+/* Retained Merkle tree (CT-MATH-001 §10.9): every level kept, leaves
+ * first, so a later version can be compared subtree by subtree */
+typedef struct {
+    ct_hash_t *nodes;              /**< Level k holds ⌈N / 2^k⌉ nodes, levels in order */
+    uint32_t num_leaves;           /**< N */
+    uint32_t num_levels;           /**< 1 + ⌈log2 N⌉; the last holds the root */
+} ct_merkle_tree_t;
+
 /*===========================================================================*/
 /* Fault Flags (CT-STRUCT-001 §3)                                            */
 /*===========================================================================*/
@@ -81,6 +114,28 @@ typedef struct {
     int32_t *data;                 /**< Sample data (Q16.16) */
 } ct_sample_t;
 
+/*===========================================================================*/
+/* Narrow Sample (CT-MATH-001 §3.10)                                         */
+/*===========================================================================*/
+
+typedef struct {
+    uint32_t version;              /**< Format version (1) */
+    uint32_t dtype;                /**< CT_DTYPE_Q8_8 or CT_DTYPE_Q1_15 */
+    uint32_t ndims;                /**< Number of dimensions */
+    uint32_t dims[CT_MAX_DIMS];    /**< Dimension sizes */
+    uint32_t total_elements;       /**< Product of dims */
+    int16_t *data;                 /**< Sample data (Q8.8 or Q1.15) */
+} ct_sample16_t;
+
+/*===========================================================================*/
+/* Value Range (CT-MATH-001 §14.5)                                           */
+/*===========================================================================*/
+
+typedef struct {
+    int32_t min;                   /**< Smallest value (Q16.16) */
+    int32_t max;                   /**< Largest value (Q16.16); min > max if empty */
+} ct_range_t;
+
 /*===========================================================================*/
 /* Normalization Context (CT-STRUCT-001 §6)                                  */
 /*===========================================================================*/
@@ -89,8 +144,16 @@ typedef struct {
     const int32_t *means;          /**< Mean values (Q16.16) */
     const int32_t *inv_stds;       /**< Inverse standard deviations (Q16.16) */
     uint32_t num_features;         /**< Number of features */
+    uint32_t unchecked;            /**< Saturation proven impossible (ct_normalize_plan) */
 } ct_normalize_ctx_t;
 
+typedef struct {
+    const int16_t *means;          /**< Mean values (sample format) */
+    const int16_t *inv_stds;       /**< Inverse standard deviations (sample format) */
+    uint32_t num_features;         /**< Number of features */
+    uint32_t dtype;                /**< CT_DTYPE_Q8_8 or CT_DTYPE_Q1_15 */
+} ct_normalize16_ctx_t;
+
 /*===========================================================================*/
 /* Augmentation (CT-STRUCT-001 §8)                                           */
 /*===========================================================================*/
@@ -100,7 +163,13 @@ typedef struct {
     uint32_t v_flip        : 1;    /**< Enable vertical flip */
     uint32_t random_crop   : 1;    /**< Enable random crop */
     uint32_t gaussian_noise: 1;    /**< Enable Gaussian noise */
-    uint32_t _reserved     : 28;
+    uint32_t rot90         : 1;    /**< Enable random quarter turns (geometry) */
+    uint32_t affine        : 1;    /**< Enable random rotation and scale (geometry) */
+    uint32_t resize        : 1;    /**< Resample to resize_height × resize_width (geometry) */
+    uint32_t cutout        : 1;    /**< Enable random rectangle erasing */
+    uint32_t mixup         : 1;    /**< Blend samples pairwise (batch-level) */
+    uint32_t cutmix        : 1;    /**< Paste a partner's rectangle (batch-level) */
+    uint32_t _reserved     : 22;
 } ct_augment_flags_t;
 
 typedef struct {
@@ -110,8 +179,42 @@ typedef struct {
     uint32_t crop_width;           /**< Crop width (if random_crop) */
     uint32_t crop_height;          /**< Crop height (if random_crop) */
     int32_t noise_std;             /**< Noise std dev (Q16.16) */
+    int32_t noise_plan_std;        /**< noise_std proven not to saturate the
+                                        sample (ct_augment_plan); 0 = none */
+    uint32_t resize_width;         /**< Output width (if resize) */
+    uint32_t resize_height;        /**< Output height (if resize) */
+    int32_t affine_max_angle;      /**< Max |rotation|, Q16.16 radians (if affine) */
+    int32_t affine_scale_min;      /**< Smallest zoom factor (Q16.16, if affine) */
+    int32_t affine_scale_max;      /**< Largest zoom factor (Q16.16, if affine) */
+    uint32_t cutout_count;         /**< Most rectangles per sample (if cutout) */
+    uint32_t cutout_height;        /**< Largest rectangle height (if cutout) */
+    uint32_t cutout_width;         /**< Largest rectangle width (if cutout) */
+    int32_t cutout_value;          /**< Fill value, or noise amplitude (Q16.16) */
+    uint32_t cutout_noise;         /**< 1 = fill with noise in [−value, value] */
+    int32_t mix_lambda_min;        /**< Smallest own-sample weight λ (Q16.16, if
+                                        mixup or cutmix) */
+    int32_t mix_lambda_max;        /**< Largest λ, at most 1.0 */
 } ct_augment_ctx_t;
 
+typedef struct {
+    uint32_t partner;              /**< Batch slot mixed into this one */
+    int32_t weight;                /**< Weight of this slot's own label (Q16.16);
+                                        the partner's takes 1.0 − weight */
+} ct_mix_label_t;
+
+/* One sample's augmentation decisions (CT-MATH-001 §8.10). Crop draws stay
+ * raw: their bound depends on the sample's shape, known only at execution */
+typedef struct {
+    uint64_t crop_x;               /**< ct_prng draw for the crop column */
+    uint64_t crop_y;               /**< ct_prng draw for the crop row */
+    int32_t angle;                 /**< Rotation θ (Q16.16 radians), 0 without affine */
+    int32_t scale;                 /**< Zoom s (Q16.16), 1.0 without affine */
+    uint32_t sample_idx;           /**< Global sample index the draws belong to */
+    uint8_t h_flip;                /**< 1 = mirror horizontally */
+    uint8_t turns;                 /**< Quarter turns, 0..3 */
+    uint16_t _reserved;
+} ct_augment_decision_t;
+
 /*===========================================================================*/
 /* Shuffle Context (CT-STRUCT-001 §9)                                        */
 /*===========================================================================*/
@@ -121,6 +224,30 @@ typedef struct {
     uint32_t epoch;                /**< Current epoch */
 } ct_shuffle_ctx_t;
 
+/* Weighted sampling table (CT-MATH-001 §7.6): column i yields i when the
+ * coin falls below prob[i] (out of total_weight), else alias[i] */
+typedef struct {
+    uint32_t *prob;                /**< Acceptance threshold per column */
+    uint32_t *alias;               /**< Index yielded on rejection */
+    uint32_t num_samples;          /**< N: one column per dataset sample */
+    uint32_t total_weight;         /**< Σ weights, at most 2^32 − 1 */
+    ct_hash_t table_hash;          /**< Merkle root over the columns */
+} ct_alias_table_t;
+
+/* Stratified ordering (CT-MATH-001 §7.7): every batch takes quota[c] samples
+ * of class c from that class's own permutation, at fixed batch slots */
+typedef struct {
+    uint32_t *offsets;             /**< num_classes + 1: class c owns
+                                        members[offsets[c], offsets[c + 1]) */
+    uint32_t *members;             /**< Dataset indices grouped by class, ascending */
+    uint32_t *slots;               /**< batch_size: slot of each class-grouped position */
+    const uint32_t *quota;         /**< Samples of each class per batch */
+    uint32_t num_classes;          /**< C */
+    uint32_t num_samples;          /**< N */
+    uint32_t batch_size;           /**< B = Σ quota */
+    ct_hash_t strata_hash;         /**< Commitment to classes and quotas */
+} ct_strata_t;
+
 /*===========================================================================*/
 /* Batch (CT-STRUCT-001 §10)                                                 */
 /*===========================================================================*/
@@ -133,6 +260,32 @@ typedef struct {
     ct_hash_t batch_hash;          /**< Merkle root of samples */
 } ct_batch_t;
 
+/*===========================================================================*/
+/* Compact Batch Descriptor (CT-STRUCT-001 §10.1)                            */
+/*===========================================================================*/
+
+#define CT_SAMPLE_REF_NONE    0xFFFFFFFFU  /* shuffled_index of a padding slot */
+
+/* Batch commitment modes (CT-MATH-001 §10.8), recorded in the config hash */
+#define CT_BATCH_HASH_CONTENT   0   /* Merkle root of sample hashes (§10.4) */
+#define CT_BATCH_HASH_REFERENCE 1   /* Cached leaves bound to dataset_hash */
+
+typedef struct {
+    uint32_t original_index;       /**< Index in sequential order: b × B + i */
+    uint32_t shuffled_index;       /**< Dataset index π_e(original), or CT_SAMPLE_REF_NONE */
+} ct_sample_ref_t;
+
+typedef struct {
+    ct_sample_ref_t *refs;         /**< One reference per slot */
+    uint32_t batch_size;           /**< Maximum samples in batch */
+    uint32_t batch_index;          /**< Index of this batch */
+    uint32_t epoch;                /**< Epoch the permutation belongs to */
+    uint32_t count;                /**< Filled slots (< batch_size for the last batch) */
+    uint32_t hash_mode;            /**< CT_BATCH_HASH_* */
+    ct_hash_t dataset_hash;        /**< Trusted dataset root (reference mode) */
+    ct_hash_t batch_hash;          /**< Commitment per hash_mode */
+} ct_batch_ref_t;
+
 /*===========================================================================*/
 /* Dataset (CT-STRUCT-001 §11)                                               */
 /*===========================================================================*/
@@ -143,6 +296,50 @@ typedef struct {
     ct_hash_t dataset_hash;        /**< Hash of entire dataset */
 } ct_dataset_t;
 
+/* Samples removed from a dataset in place (CT-MATH-001 §7.9): bit i of the
+ * bitmap set means sample i is excluded. The directories make rank and
+ * select over the survivors constant-time */
+typedef struct {
+    uint64_t *words;               /**< ⌈N / 64⌉ bitmap words; bits past N are 0 */
+    uint64_t *blocks;              /**< Per 512-sample block: survivors before it,
+                                        then 7 × 9-bit counts within it */
+    uint32_t *hints;               /**< Block holding survivor 512j,
+                                        ⌈num_kept / 512⌉ + 1 entries */
+    uint32_t num_samples;          /**< N */
+    uint32_t num_kept;             /**< N − excluded */
+    ct_hash_t bitmap_hash;         /**< Merkle root over the bitmap */
+} ct_exclusion_t;
+
+/* Weighted mixture of datasets (CT-MATH-001 §7.10): epoch positions cycle
+ * through a fixed schedule of W = Σ weights slots, and each source draws
+ * from its own permutation */
+typedef struct {
+    const ct_dataset_t *datasets;  /**< num_sources datasets, each with its root */
+    const uint32_t *weights;       /**< Slots of each source per cycle */
+    uint32_t *schedule;            /**< W: source of each cycle slot */
+    uint32_t *ranks;               /**< W: earlier slots of the same source */
+    uint32_t num_sources;          /**< S */
+    uint32_t total_weight;         /**< W = Σ weights */
+    uint32_t epoch_samples;        /**< Positions per epoch M */
+    ct_hash_t mixture_hash;        /**< Commitment to sources and weights */
+} ct_mixture_t;
+
+/*===========================================================================*/
+/* Configuration (CT-MATH-001 §11.4)                                         */
+/*===========================================================================*/
+
+typedef struct {
+    uint32_t batch_size;                   /**< Samples per batch */
+    uint64_t seed;                         /**< Random seed */
+    const ct_augment_ctx_t *augment;       /**< Augmentation, or NULL */
+    const ct_normalize_ctx_t *normalize;   /**< Normalisation statistics, or NULL */
+    uint32_t batch_hash_mode;              /**< CT_BATCH_HASH_* */
+    const ct_alias_table_t *sampler;       /**< Weighted sampling, or NULL for the
+                                                uniform permutation */
+    const ct_strata_t *strata;             /**< Stratified batches, or NULL */
+    uint32_t epoch_samples;                /**< Samples used per epoch, or 0 for all */
+} ct_config_t;
+
 /*===========================================================================*/
 /* Provenance Chain (CT-STRUCT-001 §12)                                      */
 /*===========================================================================*/
@@ -0,0 +1,128 @@
+/**
+ * @file dedup.h
+ * @project Certifiable Data Pipeline
+ * @brief Finding duplicate samples by their leaf hashes.
+ *
+ * @details Samples are equal when their ct_hash_sample digests are, so a
+ *          dedup pass streams the dataset's leaf hashes, in index order,
+ *          through an open-addressing table keyed by digest. The first
+ *          occurrence of each digest is canonical; every later one is
+ *          reported against it.
+ *
+ *          The digest space is split into P partitions by its leading bits.
+ *          Each partition has its own table and report and sees only its own
+ *          digests, so partitions share nothing: P callers can run them at
+ *          once, or one process can run them one after another when a table
+ *          for all N samples does not fit in memory. Either way the result
+ *          does not depend on P.
+ *
+ *          ct_dedup_exclude marks the reported duplicates in an exclusion
+ *          (exclusion.h), whose survivors are the canonical samples.
+ *
+ * @traceability CT-MATH-001 §7.11, CT-STRUCT-001 §26
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_DEDUP_H
+#define CT_DEDUP_H
+
+#include "ct_types.h"
+
+#define CT_DEDUP_EMPTY  0xFFFFFFFFU   /* index of a free slot */
+
+typedef struct {
+    ct_hash_t hash;                /**< Digest of the canonical sample */
+    uint32_t index;                /**< Its sample index, or CT_DEDUP_EMPTY */
+} ct_dedup_slot_t;
+
+typedef struct {
+    uint32_t index;                /**< Duplicate sample */
+    uint32_t canonical;            /**< First sample with the same digest */
+} ct_dedup_pair_t;
+
+typedef struct {
+    ct_dedup_slot_t *slots;        /**< Open-addressing table, linear probing */
+    ct_dedup_pair_t *pairs;        /**< Duplicate report, ascending index */
+    uint32_t capacity;             /**< Slots, a power of two */
+    uint32_t max_pairs;            /**< Report entries available */
+    uint32_t num_partitions;       /**< P */
+    uint32_t partition;            /**< This table's partition, below P */
+    uint32_t next_index;           /**< Samples seen so far, all partitions */
+    uint32_t num_unique;           /**< Canonical samples in this partition */
+    uint32_t num_duplicates;       /**< Entries used in pairs */
+} ct_dedup_t;
+
+/**
+ * @brief Partition of a digest.
+ * @param hash Leaf hash
+ * @param num_partitions P
+ * @return ⌊prefix × P / 2^32⌋, prefix the first four digest bytes as uint32_le
+ * @traceability CT-MATH-001 §7.11
+ */
+uint32_t ct_dedup_partition_of(const ct_hash_t hash, uint32_t num_partitions);
+
+/**
+ * @brief Start a dedup pass over one partition.
+ * @param dedup Pass to initialise
+ * @param slots Storage for capacity table slots
+ * @param capacity Power of two; holds up to capacity − max(1, capacity / 8)
+ *                 canonical samples, i.e. 7/8 × capacity from 8 slots up
+ * @param pairs Storage for max_pairs report entries
+ * @param max_pairs Report entries available
+ * @param num_partitions P, at least 1
+ * @param partition Partition handled, below P
+ * @return 0 on success, -1 if capacity is not a power of two or the
+ *         partition is out of range (dedup untouched)
+ * @note Clears the table: O(capacity).
+ * @traceability CT-MATH-001 §7.11
+ */
+int ct_dedup_init(ct_dedup_t *dedup,
+                  ct_dedup_slot_t *slots,
+                  uint32_t capacity,
+                  ct_dedup_pair_t *pairs,
+                  uint32_t max_pairs,
+                  uint32_t num_partitions,
+                  uint32_t partition);
+
+/**
+ * @brief Feed the next run of leaf hashes.
+ * @param dedup Pass from ct_dedup_init
+ * @param leaves Leaf hashes of samples next_index … next_index + count − 1
+ * @param count Number of leaves
+ * @return 0 on success, -1 if the table is full (over 7/8 load), the report
+ *         is full, or the index would pass 2^32 − 2. The pass then holds
+ *         part of the run and must be restarted with more storage.
+ * @note Leaves of other partitions cost one multiply each. A leaf of this
+ *       partition costs one probe sequence, expected O(1).
+ * @traceability CT-MATH-001 §7.11
+ */
+int ct_dedup_add(ct_dedup_t *dedup, const ct_hash_t *leaves, uint32_t count);
+
+/**
+ * @brief Mark the duplicates of every partition in an exclusion.
+ * @param parts Completed passes, one per partition (any order)
+ * @param num_parts Number of passes
+ * @param exclusion Exclusion over the same N samples (exclusion.h)
+ * @return 0 on success, -1 if a reported index is not below N (exclusion
+ *         unchanged)
+ * @note Rebuilds the exclusion once. Its survivors are the canonical
+ *       samples; commit with ct_hash_dataset_excluding.
+ * @traceability CT-MATH-001 §7.11
+ */
+int ct_dedup_exclude(const ct_dedup_t *parts, uint32_t num_parts, ct_exclusion_t *exclusion);
+
+/**
+ * @brief Canonical unique-index list.
+ * @param exclusion Exclusion from ct_dedup_exclude
+ * @param out Output array [num_kept], ascending sample indices
+ * @return num_kept
+ * @traceability CT-MATH-001 §7.11
+ */
+uint32_t ct_dedup_unique(const ct_exclusion_t *exclusion, uint32_t *out);
+
+#endif /* CT_DEDUP_H */
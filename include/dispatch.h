@@ -0,0 +1,230 @@
+/**
+ * @file dispatch.h
+ * @project Certifiable Data Pipeline
+ * @brief Runtime CPU feature detection and kernel dispatch.
+ *
+ * @details Bulk kernels (DVM array ops, invariant division, normalisation,
+ *          narrow int16 variants, augmentation noise, PRNG fill, strided and
+ *          bounded draws, SHA-256 compression, floating-point export, layout
+ *          transpose, bilinear warp, sample blending) are selected once from
+ *          a central table. Every accelerated variant MUST be bit-identical
+ *          to the scalar reference, including the fault flags it raises; the
+ *          table is self-checked against the scalar reference before first
+ *          use.
+ *
+ *          The environment variable CT_DISPATCH_BACKEND forces a backend
+ *          ("scalar", "sse4.1", "avx2", "avx512") for certification runs.
+ *
+ * @traceability CT-MATH-001 §14.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_DISPATCH_H
+#define CT_DISPATCH_H
+
+#include "ct_types.h"
+#include "dvm.h"
+#include <stddef.h>
+
+/*===========================================================================*/
+/* Backends and CPU features                                                  */
+/*===========================================================================*/
+
+typedef enum {
+    CT_BACKEND_SCALAR = 0,         /**< Portable C reference */
+    CT_BACKEND_SSE41  = 1,         /**< x86 SSE4.1 */
+    CT_BACKEND_AVX2   = 2,         /**< x86 AVX2 */
+    CT_BACKEND_AVX512 = 3          /**< x86 AVX-512 F/BW/DQ/VL */
+} ct_backend_t;
+
+#define CT_BACKEND_COUNT      4
+
+#define CT_CPU_SSE41          (1U << 0)
+#define CT_CPU_AVX2           (1U << 1)
+#define CT_CPU_AVX512         (1U << 2)  /* F + BW + DQ + VL, OS-enabled */
+#define CT_CPU_SHANI          (1U << 3)
+#define CT_CPU_NEON           (1U << 4)
+#define CT_CPU_ARM_SHA2       (1U << 5)
+
+#define CT_DISPATCH_ENV       "CT_DISPATCH_BACKEND"
+
+/* Border handling of the warp_row kernel */
+#define CT_WARP_ZERO          0U   /* Taps outside the image read as 0 */
+#define CT_WARP_REPLICATE     1U   /* Taps clamp to the nearest edge pixel */
+
+/*===========================================================================*/
+/* Kernel signatures                                                          */
+/*===========================================================================*/
+
+/* out[i] = dvm_add32(a[i], b[i]); out may alias a or b */
+typedef void (*ct_kernel_binop_fn)(const int32_t *a, const int32_t *b,
+                                   int32_t *out, uint32_t n,
+                                   ct_fault_flags_t *faults);
+
+/* out[i] = dvm_mul_q16(dvm_sub32(x[i], means[i]), inv_stds[i]) */
+typedef void (*ct_kernel_normalize_fn)(const int32_t *x, const int32_t *means,
+                                       const int32_t *inv_stds, int32_t *out,
+                                       uint32_t n, ct_fault_flags_t *faults);
+
+/* out[i] = ct_prng(seed, epoch, op_base | (op_offset + i)) */
+typedef void (*ct_kernel_prng_fill_fn)(uint64_t *out, uint32_t n,
+                                       uint64_t seed, uint32_t epoch,
+                                       uint32_t op_base, uint32_t op_offset);
+
+/* out[i] = ct_prng(seed, epoch, op_first + i × op_stride), op_id wrapping
+ * modulo 2^32: one draw per sample for a run of sample indices */
+typedef void (*ct_kernel_prng_stride_fn)(uint64_t *out, uint32_t n,
+                                         uint64_t seed, uint32_t epoch,
+                                         uint32_t op_first, uint32_t op_stride);
+
+/* out[i] = ct_prng_bound_v2(u[i], bound) */
+typedef void (*ct_kernel_bound_fn)(const uint64_t *u, uint32_t *out, uint32_t n,
+                                   uint32_t bound);
+
+/* out[i] = 2 × dvm_mul_q16(noise_std, (int32)(u[i] >> 32 & 0xFFFF0000) − ½) */
+typedef void (*ct_kernel_noise_fn)(const uint64_t *u, int32_t *out, uint32_t n,
+                                   int32_t noise_std, ct_fault_flags_t *faults);
+
+/* out[i] = dvm_div_q16_by(num[i], div) */
+typedef void (*ct_kernel_div_q16_fn)(const int32_t *num, const dvm_divisor_t *div,
+                                     int32_t *out, uint32_t n,
+                                     ct_fault_flags_t *faults);
+
+/* out[i] = dvm_add16(a[i], b[i]); out may alias a or b */
+typedef void (*ct_kernel_binop16_fn)(const int16_t *a, const int16_t *b,
+                                     int16_t *out, uint32_t n,
+                                     ct_fault_flags_t *faults);
+
+/* out[i] = dvm_mul_fx16(dvm_sub16(x[i], means[i]), inv_stds[i], frac_bits) */
+typedef void (*ct_kernel_normalize16_fn)(const int16_t *x, const int16_t *means,
+                                         const int16_t *inv_stds, int16_t *out,
+                                         uint32_t n, uint32_t frac_bits,
+                                         ct_fault_flags_t *faults);
+
+/* out[i] = dvm_mul_fx16(noise_std, (int16)(u[i] >> 48), 15) */
+typedef void (*ct_kernel_noise16_fn)(const uint64_t *u, int16_t *out, uint32_t n,
+                                     int16_t noise_std, ct_fault_flags_t *faults);
+
+/* out[i] = x[i] / 2^16 as binary32, magnitude RNE to 24 significant bits
+ * (CT-MATH-001 §3.11); exact when |x[i]| < 2^24 */
+typedef void (*ct_kernel_to_f32_fn)(const int32_t *x, float *out, uint32_t n);
+
+/* out[i] = x[i] / 2^16 as binary64; always exact */
+typedef void (*ct_kernel_to_f64_fn)(const int32_t *x, double *out, uint32_t n);
+
+/* out[i] = bfloat16 bits of x[i] / 2^16, magnitude RNE to 8 significant
+ * bits directly from the exact value (no double rounding via binary32) */
+typedef void (*ct_kernel_to_bf16_fn)(const int32_t *x, uint16_t *out, uint32_t n);
+
+/* dst[c * dst_stride + r] = src[r * src_stride + c] for r < rows, c < cols */
+typedef void (*ct_kernel_transpose32_fn)(const int32_t *src, uint32_t src_stride,
+                                         int32_t *dst, uint32_t dst_stride,
+                                         uint32_t rows, uint32_t cols);
+
+/* out[i] = bilinear sample of the height × width image src at Q16.16 pixel
+ * coordinates (sx + i·dx, sy + i·dy); taps outside the image read as zero
+ * or as the nearest edge pixel (CT_WARP_*, CT-MATH-001 §8.7) */
+typedef void (*ct_kernel_warp_row_fn)(const int32_t *src, uint32_t width, uint32_t height,
+                                      uint32_t border, int32_t sx, int32_t sy,
+                                      int32_t dx, int32_t dy, int32_t *out, uint32_t n);
+
+/* out[i] = RNE16((2^16 − t)·a[i] + t·b[i]) for t in [0, 2^16]; the result
+ * lies between a[i] and b[i], so nothing saturates (CT-MATH-001 §8.9);
+ * out may alias a or b */
+typedef void (*ct_kernel_lerp_fn)(const int32_t *a, const int32_t *b, int32_t t,
+                                  int32_t *out, uint32_t n);
+
+/* SHA-256 compression of nblocks consecutive 64-byte blocks */
+typedef void (*ct_kernel_sha256_fn)(uint32_t state[8], const uint8_t *data,
+                                    size_t nblocks);
+
+/*===========================================================================*/
+/* Dispatch table                                                             */
+/*===========================================================================*/
+
+typedef struct {
+    ct_backend_t backend;                 /**< Vector backend in use */
+    uint32_t cpu_features;                /**< CT_CPU_* bits detected */
+    uint32_t sha256_accel;                /**< 1 if SHA-NI compression selected */
+    ct_kernel_binop_fn add32;             /**< Bulk dvm_add32 */
+    ct_kernel_binop_fn sub32;             /**< Bulk dvm_sub32 */
+    ct_kernel_binop_fn mul_q16;           /**< Bulk dvm_mul_q16 */
+    ct_kernel_div_q16_fn div_q16;         /**< Bulk division by an invariant divisor */
+    ct_kernel_normalize_fn normalize;     /**< CT-MATH-001 §4.2 inner loop */
+    ct_kernel_prng_fill_fn prng_fill;     /**< Bulk ct_prng */
+    ct_kernel_noise_fn noise;             /**< Augmentation noise map */
+    ct_kernel_sha256_fn sha256_blocks;    /**< SHA-256 compression */
+    /* Unchecked variants: exact only when no step can saturate (caller
+     * proves this, see ct_normalize_plan); they never raise faults and
+     * ignore the faults argument. */
+    ct_kernel_binop_fn add32_unchecked;   /**< add32 on range-proven inputs */
+    ct_kernel_normalize_fn normalize_unchecked; /**< normalize on range-proven inputs */
+    ct_kernel_binop16_fn add16;           /**< Bulk dvm_add16 */
+    ct_kernel_normalize16_fn normalize16; /**< CT-MATH-001 §3.10 narrow normalize */
+    ct_kernel_noise16_fn noise16;         /**< Narrow augmentation noise map */
+    ct_kernel_to_f32_fn to_f32;           /**< Q16.16 → binary32 export */
+    ct_kernel_to_f64_fn to_f64;           /**< Q16.16 → binary64 export */
+    ct_kernel_to_bf16_fn to_bf16;         /**< Q16.16 → bfloat16 export */
+    ct_kernel_transpose32_fn transpose32; /**< Blocked 32-bit transpose */
+    ct_kernel_warp_row_fn warp_row;       /**< Bilinear resample along a row */
+    ct_kernel_lerp_fn lerp_q16;           /**< Fixed-weight blend of two arrays */
+    ct_kernel_prng_stride_fn prng_stride; /**< Bulk ct_prng at strided op_ids */
+    ct_kernel_bound_fn bound_v2;          /**< Bulk ct_prng_bound_v2 */
+} ct_dispatch_t;
+
+/*===========================================================================*/
+/* API                                                                        */
+/*===========================================================================*/
+
+/**
+ * @brief Detect CPU features (cpuid/xgetbv on x86, getauxval on Linux/ARM).
+ * @return Bitmask of CT_CPU_* flags
+ */
+uint32_t ct_cpu_features(void);
+
+/**
+ * @brief Build a dispatch table for a specific backend.
+ * @param table Table to populate
+ * @param backend Requested vector backend
+ * @param sha256_accel Non-zero to allow SHA-NI compression
+ * @return 0 on success, -1 if the CPU does not support the backend
+ * @note Kernels without a variant for the backend fall back to the
+ *       best lower backend, ultimately the scalar reference.
+ */
+int ct_dispatch_build(ct_dispatch_t *table, ct_backend_t backend, int sha256_accel);
+
+/**
+ * @brief Compare every kernel in a table against the scalar reference.
+ * @param table Table to check
+ * @return 1 if all kernels match on the known vectors, 0 otherwise
+ */
+int ct_dispatch_self_check(const ct_dispatch_t *table);
+
+/**
+ * @brief Select and self-check the process-wide dispatch table.
+ * @return 0 on success, -1 if the forced backend is unknown or unsupported,
+ *         or the self-check failed (the scalar table is installed instead)
+ * @note Thread-safe. Exactly one call selects the table; concurrent first
+ *       calls wait for it, and later calls return the original status.
+ */
+int ct_dispatch_init(void);
+
+/**
+ * @brief Get the process-wide dispatch table (initializes on first use).
+ * @return Active dispatch table
+ */
+const ct_dispatch_t *ct_dispatch_get(void);
+
+/**
+ * @brief Human-readable backend name (as accepted by CT_DISPATCH_BACKEND).
+ * @param backend Backend
+ * @return Static string
+ */
+const char *ct_backend_name(ct_backend_t backend);
+
+#endif /* CT_DISPATCH_H */
@@ -92,6 +92,104 @@ int32_t dvm_mul_q16(int32_t a, int32_t b, ct_fault_flags_t *faults);
  */
 int32_t dvm_div_q16(int32_t num, int32_t denom, ct_fault_flags_t *faults);
 
+/*===========================================================================*/
+/* Invariant divisors (CT-MATH-001 §3.9)                                     */
+/*===========================================================================*/
+
+/**
+ * @brief Precomputed Q16.16 divisor.
+ * @details Replaces the hardware divide of dvm_div_q16 by a multiply-high
+ *          and shift: floor(|num| × 2^16 / |denom|) =
+ *          floor(|num| × magic / 2^(32 + shift)) for every int32 num.
+ */
+typedef struct {
+    uint64_t magic;                /**< ceil(2^(48 + shift) / |denom|) */
+    uint32_t shift;                /**< ceil(log2 |denom|) */
+    uint32_t negative;             /**< 1 if denom < 0 */
+    int32_t denom;                 /**< Original denominator (0 = div_zero) */
+} dvm_divisor_t;
+
+/**
+ * @brief Precompute a divisor.
+ * @param div Divisor to initialize
+ * @param denom Denominator (Q16.16); 0 is accepted and faults on use
+ * @traceability CT-MATH-001 §3.9
+ */
+void dvm_divisor_init(dvm_divisor_t *div, int32_t denom);
+
+/**
+ * @brief Q16.16 division by a precomputed divisor.
+ * @param num Numerator (Q16.16)
+ * @param div Precomputed divisor
+ * @param faults Fault flags (div_zero if denom == 0)
+ * @return Bit-identical to dvm_div_q16(num, div->denom, faults)
+ * @traceability CT-MATH-001 §3.9
+ */
+int32_t dvm_div_q16_by(int32_t num, const dvm_divisor_t *div, ct_fault_flags_t *faults);
+
+/*===========================================================================*/
+/* Narrow formats (CT-MATH-001 §3.10)                                        */
+/*===========================================================================*/
+
+/**
+ * @brief Fractional bits of a dtype.
+ * @param dtype CT_DTYPE_* code
+ * @return 16, 8 or 15, or 0 for an unknown dtype
+ * @traceability CT-MATH-001 §3.10
+ */
+uint32_t ct_dtype_frac_bits(uint32_t dtype);
+
+/**
+ * @brief Clamp 32-bit value to 16-bit range with fault signaling.
+ * @param x Value to clamp
+ * @param faults Fault flags (updated if clamped)
+ * @return Clamped 16-bit value
+ * @traceability CT-MATH-001 §3.10
+ */
+int16_t dvm_clamp16(int32_t x, ct_fault_flags_t *faults);
+
+/**
+ * @brief Saturating 16-bit addition.
+ * @traceability CT-MATH-001 §3.10
+ */
+int16_t dvm_add16(int16_t a, int16_t b, ct_fault_flags_t *faults);
+
+/**
+ * @brief Saturating 16-bit subtraction.
+ * @traceability CT-MATH-001 §3.10
+ */
+int16_t dvm_sub16(int16_t a, int16_t b, ct_fault_flags_t *faults);
+
+/**
+ * @brief Narrow fixed-point multiplication (Qm.f × Qm.f → Qm.f).
+ * @param a First operand
+ * @param b Second operand
+ * @param frac_bits Fractional bits f (1-15)
+ * @param faults Fault flags (domain error if frac_bits out of range)
+ * @return clamp16(RNE(a × b, f))
+ * @traceability CT-MATH-001 §3.10
+ */
+int16_t dvm_mul_fx16(int16_t a, int16_t b, uint32_t frac_bits, ct_fault_flags_t *faults);
+
+/**
+ * @brief Exact widening of a narrow value to Q16.16.
+ * @param x Narrow value
+ * @param frac_bits Fractional bits of x (1-15)
+ * @return x × 2^(16 − frac_bits)
+ * @traceability CT-MATH-001 §3.10
+ */
+int32_t dvm_widen16(int16_t x, uint32_t frac_bits);
+
+/**
+ * @brief Narrowing of a Q16.16 value.
+ * @param x Q16.16 value
+ * @param frac_bits Fractional bits of the result (1-15)
+ * @param faults Fault flags (domain error if frac_bits out of range)
+ * @return clamp16(RNE(x, 16 − frac_bits))
+ * @traceability CT-MATH-001 §3.10
+ */
+int16_t dvm_narrow16(int32_t x, uint32_t frac_bits, ct_fault_flags_t *faults);
+
 /*===========================================================================*/
 /* Fault flag helpers                                                         */
 /*===========================================================================*/
@@ -0,0 +1,93 @@
+/**
+ * @file exclusion.h
+ * @project Certifiable Data Pipeline
+ * @brief Removing samples from a dataset in place (exclusion bitmap).
+ *
+ * @details Blacklisted samples are marked in a bitmap over the dataset
+ *          instead of being copied out. A rank directory (survivors before
+ *          every 512-sample block, and before each of its eight words) and a
+ *          select directory (the block that holds every 512th survivor)
+ *          answer rank and select in constant time, so an epoch permutes the
+ *          N − k survivors and maps each position to its original index
+ *          with ct_exclusion_select.
+ *
+ *          The dataset keeps its samples, leaf hashes and root. The bitmap
+ *          has its own Merkle root, and ct_hash_dataset_excluding binds the
+ *          two; removing a handful of samples rehashes N / 8 bytes of
+ *          bitmap, not the dataset.
+ *
+ * @traceability CT-MATH-001 §7.9, CT-STRUCT-001 §24
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_EXCLUSION_H
+#define CT_EXCLUSION_H
+
+#include "ct_types.h"
+
+/* Storage for a dataset of n samples */
+#define CT_EXCLUSION_WORDS(n)   (((n) + 63U) / 64U)                 /* words */
+#define CT_EXCLUSION_BLOCKS(n)  (2U * (((n) + 511U) / 512U + 1U))   /* blocks */
+#define CT_EXCLUSION_HINTS(n)   (((n) + 511U) / 512U + 1U)          /* hints */
+
+/**
+ * @brief Start an exclusion with every sample kept.
+ * @param exclusion Exclusion to initialise
+ * @param n Number of samples N
+ * @param words Storage for CT_EXCLUSION_WORDS(n) words
+ * @param blocks Storage for CT_EXCLUSION_BLOCKS(n) entries
+ * @param hints Storage for CT_EXCLUSION_HINTS(n) entries
+ * @traceability CT-MATH-001 §7.9
+ */
+void ct_exclusion_init(ct_exclusion_t *exclusion,
+                       uint32_t n,
+                       uint64_t *words,
+                       uint64_t *blocks,
+                       uint32_t *hints);
+
+/**
+ * @brief Exclude samples and rebuild the directories.
+ * @param exclusion Initialised exclusion
+ * @param indices Samples to exclude (already excluded ones are ignored)
+ * @param count Number of indices
+ * @return 0 on success, -1 if an index is not below N (nothing excluded)
+ * @note O(count + N / 512) plus the bitmap root over N / 8 bytes.
+ * @traceability CT-MATH-001 §7.9
+ */
+int ct_exclusion_add(ct_exclusion_t *exclusion, const uint32_t *indices, uint32_t count);
+
+/**
+ * @brief Recompute num_kept, the directories and bitmap_hash from words.
+ * @param exclusion Exclusion whose words were edited directly (e.g. to
+ *                  re-admit a sample); bits past N must be 0
+ * @traceability CT-MATH-001 §7.9
+ */
+void ct_exclusion_rebuild(ct_exclusion_t *exclusion);
+
+/**
+ * @brief Number of kept samples before original index i.
+ * @param exclusion Built exclusion
+ * @param i Original index in [0, N]
+ * @return Survivors in [0, i); for a kept sample, its position among them
+ * @note O(1): one directory entry and one word.
+ * @traceability CT-MATH-001 §7.9
+ */
+uint32_t ct_exclusion_rank(const ct_exclusion_t *exclusion, uint32_t i);
+
+/**
+ * @brief Original index of the k-th kept sample.
+ * @param exclusion Built exclusion
+ * @param k Survivor position, below num_kept
+ * @return Original index i with ct_exclusion_rank(i) == k, sample i kept
+ * @note O(1) while exclusions are sparse: the hints pin the block, up to a
+ *       binary search over the blocks between two hints.
+ * @traceability CT-MATH-001 §7.9
+ */
+uint32_t ct_exclusion_select(const ct_exclusion_t *exclusion, uint32_t k);
+
+#endif /* CT_EXCLUSION_H */
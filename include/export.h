@@ -0,0 +1,149 @@
+/**
+ * @file export.h
+ * @project Certifiable Data Pipeline
+ * @brief Zero-copy batch export to tensor runtimes.
+ *
+ * @details A batch whose samples share one shape and sit at a constant
+ *          stride in memory is described as a DLPack tensor of shape
+ *          [B, dims...] without copying. This holds for shared-memory ring
+ *          views (shm.h), streamed batches (stream.h) and batches packed
+ *          with ct_batch_pack.
+ *
+ *          For runtimes that want real values, the converting exports write
+ *          binary32, binary64 or bfloat16 into a caller buffer in one pass
+ *          (gather and conversion fused) and describe that buffer instead.
+ *          Rounding is fixed by CT-MATH-001 §3.11, so every backend and
+ *          every floating-point environment produces the same bits.
+ *
+ *          The ct_dl_* structures are declared here with the DLPack ABI
+ *          (dlpack.h v0.6 and later: DLDevice, DLDataType, DLTensor,
+ *          DLManagedTensor), so the library needs no DLPack headers; a
+ *          consumer that has them passes &export.managed as a
+ *          DLManagedTensor *.
+ *
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_EXPORT_H
+#define CT_EXPORT_H
+
+#include "ct_types.h"
+
+/*===========================================================================*/
+/* DLPack ABI                                                                 */
+/*===========================================================================*/
+
+#define CT_DL_DEVICE_CPU   1    /* kDLCPU */
+#define CT_DL_CODE_INT     0    /* kDLInt */
+#define CT_DL_CODE_UINT    1    /* kDLUInt */
+#define CT_DL_CODE_FLOAT   2    /* kDLFloat */
+#define CT_DL_CODE_BFLOAT  4    /* kDLBfloat */
+
+typedef struct {
+    int32_t device_type;           /**< DLDeviceType (C enum, int-sized) */
+    int32_t device_id;
+} ct_dl_device_t;
+
+typedef struct {
+    uint8_t code;                  /**< DLDataTypeCode */
+    uint8_t bits;
+    uint16_t lanes;
+} ct_dl_dtype_t;
+
+typedef struct {
+    void *data;
+    ct_dl_device_t device;
+    int32_t ndim;
+    ct_dl_dtype_t dtype;
+    int64_t *shape;
+    int64_t *strides;              /**< In elements */
+    uint64_t byte_offset;
+} ct_dl_tensor_t;
+
+typedef struct ct_dl_managed_tensor {
+    ct_dl_tensor_t dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(struct ct_dl_managed_tensor *self);
+} ct_dl_managed_tensor_t;
+
+/*===========================================================================*/
+/* Export                                                                     */
+/*===========================================================================*/
+
+/* Called once when the consumer drops the tensor, e.g. to release a ring slot */
+typedef void (*ct_export_release_fn)(void *ctx);
+
+typedef struct {
+    ct_dl_managed_tensor_t managed;        /**< Hand &managed to the consumer */
+    int64_t shape[CT_MAX_DIMS + 1];        /**< [B, dims...] */
+    int64_t strides[CT_MAX_DIMS + 1];      /**< [sample stride, row-major...] */
+    ct_export_release_fn release;          /**< Or NULL */
+    void *release_ctx;
+} ct_batch_export_t;
+
+/**
+ * @brief Describe a batch as a DLPack int32 tensor, in place.
+ * @param batch Batch whose sample data stays valid until the deleter runs
+ * @param out Caller-owned export record; must outlive the tensor
+ * @param release Invoked by the deleter (may be NULL)
+ * @param release_ctx Argument for release
+ * @return 0 on success, -1 if the batch is empty, its samples differ in
+ *         shape or dtype, or their data is not at a constant stride
+ * @note Values are raw Q16.16 integers (divide by 65536 for real values).
+ *       Trailing padding slots of a partial batch are not part of the
+ *       tensor: shape[0] counts filled samples only.
+ * @traceability CT-STRUCT-001 §22
+ */
+int ct_batch_export_dlpack(const ct_batch_t *batch,
+                           ct_batch_export_t *out,
+                           ct_export_release_fn release,
+                           void *release_ctx);
+
+/*===========================================================================*/
+/* Converting export                                                          */
+/*===========================================================================*/
+
+/**
+ * @brief Convert a batch to binary32 in buf and describe it as a DLPack tensor.
+ * @param batch Batch of Q16.16 samples sharing one shape (any layout)
+ * @param buf Destination, packed [B, dims...]; must outlive the tensor
+ * @param capacity buf size in elements
+ * @param out Caller-owned export record; must outlive the tensor
+ * @param release Invoked by the deleter, e.g. to recycle buf (may be NULL)
+ * @param release_ctx Argument for release
+ * @return 0 on success, -1 if the batch is empty, its samples differ in
+ *         shape or dtype, or buf is too small (buf is then untouched)
+ * @note Exact when |x| < 2^24 (real magnitude below 256); larger magnitudes round to nearest,
+ *       ties to even. The batch is not referenced after return, so a ring
+ *       slot can be released at once.
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ */
+int ct_batch_export_f32(const ct_batch_t *batch, float *buf, uint32_t capacity,
+                        ct_batch_export_t *out, ct_export_release_fn release,
+                        void *release_ctx);
+
+/**
+ * @brief As ct_batch_export_f32, to binary64 (always exact).
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ */
+int ct_batch_export_f64(const ct_batch_t *batch, double *buf, uint32_t capacity,
+                        ct_batch_export_t *out, ct_export_release_fn release,
+                        void *release_ctx);
+
+/**
+ * @brief As ct_batch_export_f32, to bfloat16 bit patterns.
+ * @note Rounded once, from the exact value, to 8 significant bits (ties to
+ *       even); no intermediate binary32 rounding.
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ */
+int ct_batch_export_bf16(const ct_batch_t *batch, uint16_t *buf, uint32_t capacity,
+                         ct_batch_export_t *out, ct_export_release_fn release,
+                         void *release_ctx);
+
+#endif /* CT_EXPORT_H */
@@ -0,0 +1,124 @@
+/**
+ * @file kernels.h
+ * @project Certifiable Data Pipeline
+ * @brief Bulk kernel variants behind the dispatch table.
+ *
+ * @details The scalar kernels are the normative reference: each is a direct
+ *          loop over the DVM primitives and defines the exact output and
+ *          fault behaviour every accelerated variant must reproduce.
+ *
+ * @traceability CT-MATH-001 §3, §3.10, §3.11, §4.2, §5, §14.1, §14.5
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_KERNELS_H
+#define CT_KERNELS_H
+
+#include "dispatch.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CT_HAVE_X86_KERNELS 1
+#else
+#define CT_HAVE_X86_KERNELS 0
+#endif
+
+/*===========================================================================*/
+/* Scalar reference kernels                                                   */
+/*===========================================================================*/
+
+void ct_kernel_add32_scalar(const int32_t *a, const int32_t *b,
+                            int32_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_sub32_scalar(const int32_t *a, const int32_t *b,
+                            int32_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_mul_q16_scalar(const int32_t *a, const int32_t *b,
+                              int32_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_div_q16_scalar(const int32_t *num, const dvm_divisor_t *div,
+                              int32_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_normalize_scalar(const int32_t *x, const int32_t *means,
+                                const int32_t *inv_stds, int32_t *out,
+                                uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_prng_fill_scalar(uint64_t *out, uint32_t n,
+                                uint64_t seed, uint32_t epoch,
+                                uint32_t op_base, uint32_t op_offset);
+
+void ct_kernel_prng_stride_scalar(uint64_t *out, uint32_t n,
+                                  uint64_t seed, uint32_t epoch,
+                                  uint32_t op_first, uint32_t op_stride);
+
+void ct_kernel_bound_v2_scalar(const uint64_t *u, uint32_t *out, uint32_t n,
+                               uint32_t bound);
+
+void ct_kernel_noise_scalar(const uint64_t *u, int32_t *out, uint32_t n,
+                            int32_t noise_std, ct_fault_flags_t *faults);
+
+void ct_kernel_add32_unchecked_scalar(const int32_t *a, const int32_t *b,
+                                      int32_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_normalize_unchecked_scalar(const int32_t *x, const int32_t *means,
+                                          const int32_t *inv_stds, int32_t *out,
+                                          uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_add16_scalar(const int16_t *a, const int16_t *b,
+                            int16_t *out, uint32_t n, ct_fault_flags_t *faults);
+
+void ct_kernel_normalize16_scalar(const int16_t *x, const int16_t *means,
+                                  const int16_t *inv_stds, int16_t *out,
+                                  uint32_t n, uint32_t frac_bits,
+                                  ct_fault_flags_t *faults);
+
+void ct_kernel_noise16_scalar(const uint64_t *u, int16_t *out, uint32_t n,
+                              int16_t noise_std, ct_fault_flags_t *faults);
+
+void ct_kernel_to_f32_scalar(const int32_t *x, float *out, uint32_t n);
+
+void ct_kernel_to_f64_scalar(const int32_t *x, double *out, uint32_t n);
+
+void ct_kernel_to_bf16_scalar(const int32_t *x, uint16_t *out, uint32_t n);
+
+void ct_kernel_transpose32_scalar(const int32_t *src, uint32_t src_stride,
+                                  int32_t *dst, uint32_t dst_stride,
+                                  uint32_t rows, uint32_t cols);
+
+void ct_kernel_warp_row_scalar(const int32_t *src, uint32_t width, uint32_t height,
+                               uint32_t border, int32_t sx, int32_t sy,
+                               int32_t dx, int32_t dy, int32_t *out, uint32_t n);
+
+void ct_kernel_lerp_q16_scalar(const int32_t *a, const int32_t *b, int32_t t,
+                               int32_t *out, uint32_t n);
+
+void ct_sha256_blocks_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+/**
+ * @brief Populate a table with the scalar reference kernels.
+ * @param table Table to populate
+ */
+void ct_kernels_scalar_populate(ct_dispatch_t *table);
+
+/*===========================================================================*/
+/* x86 variants                                                               */
+/*===========================================================================*/
+
+#if CT_HAVE_X86_KERNELS
+
+void ct_sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t nblocks);
+
+/**
+ * @brief Overlay the x86 variants for a backend onto a populated table.
+ * @param table Table already holding the scalar kernels
+ * @param backend Backend (caller has verified CPU support)
+ */
+void ct_kernels_x86_populate(ct_dispatch_t *table, ct_backend_t backend);
+
+#endif
+
+#endif /* CT_KERNELS_H */
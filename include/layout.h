@@ -0,0 +1,73 @@
+/**
+ * @file layout.h
+ * @project Certifiable Data Pipeline
+ * @brief Tensor layout conversion (CHW ↔ HWC, NCHW ↔ NHWC).
+ *
+ * @details A 3-D sample is stored either channel-major (CHW: dims
+ *          [C, H, W]) or channel-last (HWC: dims [H, W, C]). Converting
+ *          between them is a transpose of a C × (H·W) matrix, done by the
+ *          dispatched cache-blocked transpose kernel. Batch conversion is
+ *          fused with packing, so a batch whose samples point into an HWC
+ *          dataset becomes one contiguous NCHW tensor in a single pass
+ *          (and vice versa), ready for ct_batch_export_dlpack.
+ *
+ * @traceability CT-STRUCT-001 §23
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_LAYOUT_H
+#define CT_LAYOUT_H
+
+#include "ct_types.h"
+
+typedef enum {
+    CT_LAYOUT_CHW = 0,    /**< dims [C, H, W]; a packed batch is NCHW */
+    CT_LAYOUT_HWC = 1     /**< dims [H, W, C]; a packed batch is NHWC */
+} ct_layout_t;
+
+/**
+ * @brief Convert one sample between layouts.
+ * @param input 3-D Q16.16 sample in layout from
+ * @param from Layout of input
+ * @param to Requested layout
+ * @param output Sample whose data points to total_elements of storage not
+ *               overlapping input; receives the header in layout to
+ * @return 0 on success, -1 if input is not a 3-D Q16.16 sample or a
+ *         layout is unknown (output untouched)
+ * @note from == to copies the data.
+ * @traceability CT-STRUCT-001 §23
+ */
+int ct_layout_sample(const ct_sample_t *input,
+                     ct_layout_t from,
+                     ct_layout_t to,
+                     ct_sample_t *output);
+
+/**
+ * @brief Pack a batch into one contiguous buffer, converting its layout.
+ * @param batch Filled batch of samples in layout from; data pointers and
+ *              dims are redirected into buf
+ * @param buf Destination, samples back to back; must not overlap the
+ *            current sample data
+ * @param capacity buf size in elements
+ * @param from Layout of the batch's samples
+ * @param to Layout of the packed samples
+ * @return 0 on success, -1 if buf is too small or a filled sample is not
+ *         3-D Q16.16 (batch unchanged)
+ * @note Sample hashes and the batch hash keep committing to the samples
+ *       as filled: ct_batch_verify still holds, but re-hashing converted
+ *       sample data does not reproduce sample_hashes. Verify samples
+ *       before converting.
+ * @traceability CT-STRUCT-001 §22, §23
+ */
+int ct_batch_pack_layout(ct_batch_t *batch,
+                         int32_t *buf,
+                         uint32_t capacity,
+                         ct_layout_t from,
+                         ct_layout_t to);
+
+#endif /* CT_LAYOUT_H */
@@ -46,4 +46,51 @@ void ct_dataset_init(ct_dataset_t *dataset,
                      ct_sample_t *samples,
                      uint32_t num_samples);
 
+/**
+ * @brief Scan per-feature value ranges of a dataset.
+ * @param dataset Dataset to scan
+ * @param ranges Output ranges, one per feature (element index)
+ * @param num_features Number of features to scan
+ * @note Samples shorter than num_features contribute only to the features
+ *       they hold; a feature no sample holds gets an empty range.
+ * @traceability CT-MATH-001 §14.5
+ */
+void ct_dataset_scan_ranges(const ct_dataset_t *dataset,
+                            ct_range_t *ranges,
+                            uint32_t num_features);
+
+/**
+ * @brief Union of a set of ranges.
+ * @param ranges Input ranges
+ * @param count Number of ranges
+ * @return Smallest range containing every input (empty if count is 0)
+ * @traceability CT-MATH-001 §14.5
+ */
+ct_range_t ct_range_union(const ct_range_t *ranges, uint32_t count);
+
+/**
+ * @brief Narrow a Q16.16 sample to an int16 dtype.
+ * @param input Q16.16 sample
+ * @param output Narrow sample (data must hold total_elements values)
+ * @param dtype CT_DTYPE_Q8_8 or CT_DTYPE_Q1_15
+ * @param faults Fault flags (saturation; domain error on
+ *               unknown dtype with output untouched)
+ * @traceability CT-MATH-001 §3.10
+ */
+void ct_sample_narrow(const ct_sample_t *input,
+                      ct_sample16_t *output,
+                      uint32_t dtype,
+                      ct_fault_flags_t *faults);
+
+/**
+ * @brief Widen a narrow sample to Q16.16 (exact).
+ * @param input Narrow sample
+ * @param output Q16.16 sample (data must hold total_elements values)
+ * @param faults Fault flags (domain error on unknown dtype, output untouched)
+ * @traceability CT-MATH-001 §3.10
+ */
+void ct_sample_widen(const ct_sample16_t *input,
+                     ct_sample_t *output,
+                     ct_fault_flags_t *faults);
+
 #endif /* CT_LOADER_H */
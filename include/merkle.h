@@ -37,12 +37,102 @@ void ct_hash_internal(const ct_hash_t left, const ct_hash_t right, ct_hash_t out
 /**
  * @brief Compute Merkle root from array of leaf hashes.
  * @param leaves Array of leaf hashes
- * @param count Number of leaves
+ * @param count Number of leaves (any count; O(log count) working state)
  * @param out_root Output root hash
  * @traceability REQ-MERK-003, CT-MATH-001 §10.3
  */
 void ct_merkle_root(const ct_hash_t *leaves, uint32_t count, ct_hash_t out_root);
 
+/**
+ * @brief Start an incremental Merkle root.
+ * @param acc Accumulator to reset
+ * @traceability CT-MATH-001 §10.4
+ */
+void ct_merkle_acc_init(ct_merkle_acc_t *acc);
+
+/**
+ * @brief Append the next leaf.
+ * @param acc Accumulator
+ * @param leaf Leaf hash, in tree order
+ * @note Amortised one internal-node hash per leaf; leaves may arrive one at
+ *       a time, e.g. as frames are received.
+ */
+void ct_merkle_acc_push(ct_merkle_acc_t *acc, const ct_hash_t leaf);
+
+/**
+ * @brief Root of the leaves pushed so far.
+ * @param acc Accumulator (unchanged; more leaves may still be pushed)
+ * @param out_root Equals ct_merkle_root over the same leaves
+ */
+void ct_merkle_acc_finish(const ct_merkle_acc_t *acc, ct_hash_t out_root);
+
+/* Nodes of a retained tree over n leaves, at most */
+#define CT_MERKLE_TREE_NODES(n)  ((size_t)(n) * 2U + 32U)
+
+/**
+ * @brief Build a retained Merkle tree, keeping every level.
+ * @param tree Receives the tree; its array is nodes
+ * @param leaves Leaf hashes, n entries
+ * @param n Number of leaves N
+ * @param nodes Storage for CT_MERKLE_TREE_NODES(n) hashes
+ * @return 0 on success, -1 if n is 0 (tree untouched)
+ * @note Same N − 1 internal hashes as ct_merkle_root, whose root it keeps.
+ * @traceability CT-MATH-001 §10.9
+ */
+int ct_merkle_tree_build(ct_merkle_tree_t *tree,
+                         const ct_hash_t *leaves,
+                         uint32_t n,
+                         ct_hash_t *nodes);
+
+/**
+ * @brief Root of a retained tree.
+ * @param tree Tree from ct_merkle_tree_build
+ * @param out_root Equals ct_merkle_root over its leaves
+ * @traceability CT-MATH-001 §10.9
+ */
+void ct_merkle_tree_root(const ct_merkle_tree_t *tree, ct_hash_t out_root);
+
+/**
+ * @brief Replace one leaf and rehash its path to the root.
+ * @param tree Tree from ct_merkle_tree_build
+ * @param index Leaf index
+ * @param leaf New leaf hash
+ * @return 0 on success, -1 if index is not below N (tree unchanged)
+ * @note O(log N) internal hashes.
+ * @traceability CT-MATH-001 §10.9
+ */
+int ct_merkle_tree_update(ct_merkle_tree_t *tree, uint32_t index, const ct_hash_t leaf);
+
+/**
+ * @brief Leaves that differ between two versions of a tree.
+ * @param a Earlier version
+ * @param b Later version (N may differ)
+ * @param out Output array [max_out], ascending leaf indices
+ * @param max_out Entries available in out
+ * @return Number of differing leaves: indices below both sizes whose leaves
+ *         differ, and every index below only one. Only the first max_out
+ *         are written.
+ * @note Descends only into subtrees whose hashes differ: O(k log N) node
+ *       comparisons for k changes, and no hashing.
+ * @traceability CT-MATH-001 §10.9
+ */
+uint32_t ct_merkle_diff(const ct_merkle_tree_t *a,
+                        const ct_merkle_tree_t *b,
+                        uint32_t *out,
+                        uint32_t max_out);
+
+/**
+ * @brief First leaf that differs between two versions of a tree.
+ * @param a One version
+ * @param b The other (N may differ)
+ * @return Lowest index whose leaves differ or that lies below only one N;
+ *         max(N_a, N_b) if the trees are identical
+ * @note Bisects from the root: one node comparison per level, O(log N),
+ *       and no hashing.
+ * @traceability CT-MATH-001 §10.10
+ */
+uint32_t ct_merkle_first_diff(const ct_merkle_tree_t *a, const ct_merkle_tree_t *b);
+
 /**
  * @brief Compute batch hash (Merkle root of samples).
  * @param batch Batch to hash
@@ -51,6 +141,104 @@ void ct_merkle_root(const ct_hash_t *leaves, uint32_t count, ct_hash_t out_root)
  */
 void ct_hash_batch(const ct_batch_t *batch, ct_hash_t out_hash);
 
+/**
+ * @brief Compute the leaf hash of every sample in a dataset.
+ * @param dataset Dataset to hash
+ * @param out_leaves Output hashes, one per sample (num_samples entries)
+ * @note Compute once per dataset; compact batches reference these leaves.
+ * @traceability CT-MATH-001 §10.1, CT-STRUCT-001 §10.1
+ */
+void ct_hash_dataset_leaves(const ct_dataset_t *dataset, ct_hash_t *out_leaves);
+
+/**
+ * @brief Compute the dataset root from its leaf hashes.
+ * @param leaves Dataset leaf hashes (ct_hash_dataset_leaves)
+ * @param num_samples Number of samples
+ * @param out_hash Output hash (Merkle root of the leaves)
+ * @traceability CT-MATH-001 §10.8
+ */
+void ct_hash_dataset(const ct_hash_t *leaves, uint32_t num_samples, ct_hash_t out_hash);
+
+/**
+ * @brief Compute batch hash of a compact batch from precomputed leaves.
+ * @param batch Compact batch (hash_mode selects the commitment)
+ * @param leaf_hashes Dataset leaf hashes (ct_hash_dataset_leaves)
+ * @param out_hash Output hash. In content mode it equals ct_hash_batch of
+ *                 the same batch filled with full sample copies; in
+ *                 reference mode it is H_batch_ref of CT-MATH-001 §10.8
+ * @traceability CT-MATH-001 §10.4, §10.8, CT-STRUCT-001 §10.1
+ */
+void ct_hash_batch_refs(const ct_batch_ref_t *batch,
+                        const ct_hash_t *leaf_hashes,
+                        ct_hash_t out_hash);
+
+/**
+ * @brief Compute the commitment to a weighted sampling table.
+ * @param table Alias table with prob, alias, num_samples and total_weight set
+ * @param out_hash Merkle root over leaves of up to 64 columns
+ * @traceability CT-MATH-001 §7.6
+ */
+void ct_hash_alias_table(const ct_alias_table_t *table, ct_hash_t out_hash);
+
+/**
+ * @brief Compute the commitment to a stratified ordering.
+ * @param strata Strata with offsets, members, quota and counts set
+ * @param out_hash SHA-256 over the class quotas and sizes and the Merkle
+ *                 root of the grouped members
+ * @traceability CT-MATH-001 §7.7
+ */
+void ct_hash_strata(const ct_strata_t *strata, ct_hash_t out_hash);
+
+/**
+ * @brief Compute the commitment to an exclusion bitmap.
+ * @param exclusion Exclusion with words and num_samples set
+ * @param out_hash Merkle root over leaves of up to 64 bitmap words
+ * @traceability CT-MATH-001 §7.9
+ */
+void ct_hash_exclusion(const ct_exclusion_t *exclusion, ct_hash_t out_hash);
+
+/**
+ * @brief Commit to a dataset with samples excluded, without rehashing it.
+ * @param dataset_hash Root of the full dataset (ct_hash_dataset)
+ * @param exclusion Exclusion over the same dataset (bitmap_hash set)
+ * @param out_hash SHA-256 over the dataset root, N, the survivor count and
+ *                 the bitmap root. Pass it to ct_provenance_init.
+ * @note O(1): only the bitmap root changes when samples are removed.
+ * @traceability CT-MATH-001 §7.9
+ */
+void ct_hash_dataset_excluding(const ct_hash_t dataset_hash,
+                               const ct_exclusion_t *exclusion,
+                               ct_hash_t out_hash);
+
+/**
+ * @brief Compute the commitment to a mixture of datasets.
+ * @param mixture Mixture with datasets, weights and counts set
+ * @param out_hash SHA-256 over S, W, M and each source's weight, size and
+ *                 dataset root. Pass it to ct_provenance_init.
+ * @traceability CT-MATH-001 §7.10
+ */
+void ct_hash_mixture(const ct_mixture_t *mixture, ct_hash_t out_hash);
+
+/**
+ * @brief Batch leaf of a sample drawn from a mixture source.
+ * @param source Source index
+ * @param sample_hash Hash of the sample (ct_hash_sample)
+ * @param out_hash SHA256(0x09 || uint32_le(source) || sample_hash)
+ * @traceability CT-MATH-001 §7.10
+ */
+void ct_hash_mixture_leaf(uint32_t source, const ct_hash_t sample_hash, ct_hash_t out_hash);
+
+/**
+ * @brief Compute configuration hash.
+ * @param config Configuration
+ * @param out_hash Output hash (SHA256 of serialize(config))
+ * @note Any batch_hash_mode other than CT_BATCH_HASH_CONTENT changes the
+ *       serialization version, so the mode is bound into provenance, and
+ *       so does a weighted sampler, whose table hash is appended.
+ * @traceability CT-MATH-001 §11.4
+ */
+void ct_hash_config(const ct_config_t *config, ct_hash_t out_hash);
+
 /**
  * @brief Compute epoch hash (Merkle root of batches).
  * @param batch_hashes Array of batch hashes
@@ -81,4 +269,21 @@ void ct_provenance_init(ct_provenance_t *prov,
  */
 void ct_provenance_advance(ct_provenance_t *prov, const ct_hash_t epoch_hash);
 
+/**
+ * @brief First chain head at which two runs diverge.
+ * @param heads_a Run a's heads: h_0 after ct_provenance_init, then
+ *                current_hash after each ct_provenance_advance
+ * @param heads_b Run b's heads, recorded the same way
+ * @param num_heads Heads recorded by both runs
+ * @return Lowest e with heads_a[e] ≠ heads_b[e], or num_heads if none.
+ *         0 means the dataset, config or seed differ; e > 0 means epoch
+ *         e − 1 is the first whose H_epoch differs.
+ * @note Binary search, O(log E) comparisons: a chain that diverges never
+ *       rejoins.
+ * @traceability CT-MATH-001 §10.10
+ */
+uint32_t ct_provenance_first_diff(const ct_hash_t *heads_a,
+                                  const ct_hash_t *heads_b,
+                                  uint32_t num_heads);
+
 #endif /* CT_MERKLE_H */
@@ -0,0 +1,79 @@
+/**
+ * @file mixture.h
+ * @project Certifiable Data Pipeline
+ * @brief Weighted mixtures of several datasets.
+ *
+ * @details A mixture draws from S datasets without concatenating them. Epoch
+ *          positions cycle through a fixed schedule of W = Σ weights slots,
+ *          source s holding weights[s] of them, spread evenly. Each source
+ *          reads its own Feistel permutation, keyed per epoch by ct_prng and
+ *          evaluated only at the positions used, so a source visits every
+ *          sample once per pass whatever its weight.
+ *
+ *          Every source keeps its dataset root. ct_hash_mixture binds the
+ *          roots, weights and epoch size, and batch leaves name the source
+ *          of each sample (ct_hash_mixture_leaf).
+ *
+ * @traceability CT-MATH-001 §7.10, CT-STRUCT-001 §25
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_MIXTURE_H
+#define CT_MIXTURE_H
+
+#include "ct_types.h"
+
+/**
+ * @brief Fix the cycle schedule of a mixture and commit to it.
+ * @param mixture Receives the mixture; its arrays are schedule and ranks
+ * @param datasets num_sources datasets with dataset_hash set; must outlive
+ *                 mixture
+ * @param weights Slots of each source per cycle (0 = never drawn); must
+ *                outlive mixture
+ * @param num_sources Number of sources S
+ * @param epoch_samples Positions per epoch M
+ * @param schedule Storage for Σ weights source numbers
+ * @param ranks Storage for Σ weights slot ranks
+ * @param work Scratch for num_sources counters
+ * @return 0 on success, -1 if S or M is 0, the weights sum to 0 or above
+ *         2^31 − 1, or a source with a weight has no samples (mixture
+ *         untouched)
+ * @note O(W × S) once. Sets mixture_hash (ct_hash_mixture).
+ * @traceability CT-MATH-001 §7.10
+ */
+int ct_mixture_build(ct_mixture_t *mixture,
+                     const ct_dataset_t *datasets,
+                     const uint32_t *weights,
+                     uint32_t num_sources,
+                     uint32_t epoch_samples,
+                     uint32_t *schedule,
+                     uint32_t *ranks,
+                     uint32_t *work);
+
+/**
+ * @brief Source and sample at a run of epoch positions.
+ * @param mixture Mixture from ct_mixture_build
+ * @param seed Random seed
+ * @param epoch Current epoch
+ * @param start First position; start + count at most epoch_samples
+ * @param count Number of positions
+ * @param out_source Output array [count], source of each position
+ * @param out_index Output array [count], sample index within that source
+ * @note Positions of one source are consecutive in its stream, so each
+ *       source costs one ct_permute_range per pass it crosses.
+ * @traceability CT-MATH-001 §7.10
+ */
+void ct_mixture_range(const ct_mixture_t *mixture,
+                      uint64_t seed,
+                      uint32_t epoch,
+                      uint32_t start,
+                      uint32_t count,
+                      uint32_t *out_source,
+                      uint32_t *out_index);
+
+#endif /* CT_MIXTURE_H */
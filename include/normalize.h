@@ -30,6 +30,21 @@ void ct_normalize_init(ct_normalize_ctx_t *ctx,
                        const int32_t *inv_stds,
                        uint32_t num_features);
 
+/**
+ * @brief Prove whether normalization can saturate on a value range.
+ * @param ctx Normalization context (unchecked is set on success)
+ * @param ranges Per-feature input ranges (num_features entries)
+ * @param out_ranges Per-feature output ranges, or NULL
+ * @return 1 if no element in range can saturate (unchecked kernel
+ *         selected), 0 otherwise
+ * @note Inputs outside ranges are a contract violation: re-plan whenever
+ *       the means, inv_stds or the data change.
+ * @traceability CT-MATH-001 §14.5
+ */
+int ct_normalize_plan(ct_normalize_ctx_t *ctx,
+                      const ct_range_t *ranges,
+                      ct_range_t *out_ranges);
+
 /**
  * @brief Normalize single sample.
  * @param ctx Normalization context
@@ -56,4 +71,32 @@ void ct_normalize_batch(const ct_normalize_ctx_t *ctx,
                         ct_batch_t *output,
                         ct_fault_flags_t *faults);
 
+/**
+ * @brief Initialize narrow (int16) normalization context.
+ * @param ctx Narrow normalization context
+ * @param means Array of mean values (in dtype format)
+ * @param inv_stds Array of inverse standard deviations (in dtype format)
+ * @param num_features Number of features
+ * @param dtype CT_DTYPE_Q8_8 or CT_DTYPE_Q1_15
+ * @traceability CT-MATH-001 §3.10
+ */
+void ct_normalize16_init(ct_normalize16_ctx_t *ctx,
+                         const int16_t *means,
+                         const int16_t *inv_stds,
+                         uint32_t num_features,
+                         uint32_t dtype);
+
+/**
+ * @brief Normalize single narrow sample.
+ * @param ctx Narrow normalization context
+ * @param input Input sample (dtype must match ctx)
+ * @param output Output sample (normalized, same dtype)
+ * @param faults Fault flags (domain error on dtype mismatch; output untouched)
+ * @traceability CT-MATH-001 §3.10, §4.2
+ */
+void ct_normalize16_sample(const ct_normalize16_ctx_t *ctx,
+                           const ct_sample16_t *input,
+                           ct_sample16_t *output,
+                           ct_fault_flags_t *faults);
+
 #endif /* CT_NORMALIZE_H */
@@ -38,4 +38,39 @@ uint64_t ct_prng(uint64_t seed, uint32_t epoch, uint32_t op_id);
  */
 uint32_t ct_prng_uniform(uint64_t seed, uint32_t epoch, uint32_t op_id, uint32_t n);
 
+/**
+ * @brief Map an already drawn PRNG value to a uniform integer in [0, n).
+ * @param rand Value from ct_prng (or a bulk prng kernel)
+ * @param n Upper bound (exclusive)
+ * @return ct_prng_uniform(seed, epoch, op_id, n) when rand = ct_prng(seed, epoch, op_id)
+ * @note Lets a draw be made ahead of time, before its bound is known.
+ * @traceability CT-MATH-001 §5.3
+ */
+uint32_t ct_prng_bound(uint64_t rand, uint32_t n);
+
+/**
+ * @brief Generate uniform random integer in [0, n), version 2.
+ * @param seed Global random seed
+ * @param epoch Current epoch
+ * @param op_id Operation identifier
+ * @param n Upper bound (exclusive)
+ * @return Random value in [0, n)
+ * @note Multiply-high rejection sampling: unbiased for every n, and a
+ *       division only when the first product lands in the rejection
+ *       window (probability below n / 2^32). Differs from ct_prng_uniform
+ *       for the same inputs; new draw sites use this version, existing
+ *       ones keep version 1 so recorded runs replay.
+ * @traceability CT-MATH-001 §5.5
+ */
+uint32_t ct_prng_uniform_v2(uint64_t seed, uint32_t epoch, uint32_t op_id, uint32_t n);
+
+/**
+ * @brief Map an already drawn PRNG value to [0, n) by version 2.
+ * @param rand Value from ct_prng (or a bulk prng kernel)
+ * @param n Upper bound (exclusive)
+ * @return ct_prng_uniform_v2(seed, epoch, op_id, n) when rand = ct_prng(seed, epoch, op_id)
+ * @traceability CT-MATH-001 §5.5
+ */
+uint32_t ct_prng_bound_v2(uint64_t rand, uint32_t n);
+
 #endif /* CT_PRNG_H */
@@ -0,0 +1,237 @@
+/**
+ * @file shm.h
+ * @project Certifiable Data Pipeline
+ * @brief POSIX shared-memory batch ring for multi-process trainers.
+ *
+ * @details One server process loads and commits the dataset, prepares
+ *          batches with the library and publishes them into a ring of slots
+ *          in a named shared-memory object. Client processes on the same host
+ *          attach and consume every published batch as a ct_batch_t view whose
+ *          sample data and sample hashes point into the shared region; only
+ *          the small sample headers are copied. The server also publishes the
+ *          dataset hash, config hash and provenance chain head so each client
+ *          can verify what it trains on.
+ *
+ *          Single producer, broadcast to up to CT_SHM_MAX_CLIENTS consumers.
+ *          A slot is reused only after every attached client has released
+ *          it. All calls are non-blocking: a full or empty ring, or a
+ *          join/claim lock held by another process, returns CT_SHM_AGAIN and
+ *          the caller decides how to wait.
+ *
+ *          Crashes: a client that exits without ct_shm_client_detach is
+ *          evicted as soon as it would block ct_shm_server_publish, or
+ *          eagerly by ct_shm_server_reap, and its entry is reused by the next
+ *          attach. A lock left by a process that died holding it is taken
+ *          over. Liveness is kill(pid, 0), so all processes must share one
+ *          PID namespace, a zombie client still blocks until its parent
+ *          waits for it, and a recycled pid keeps its entry until that
+ *          process exits too. A handle belongs to the process that made it;
+ *          do not use it across fork. A provenance update cut short by a
+ *          crash may read torn until the next ct_shm_server_set_provenance.
+ *
+ * @traceability CT-STRUCT-001 §20
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_SHM_H
+#define CT_SHM_H
+
+#include "ct_types.h"
+#include <stddef.h>
+
+/*===========================================================================*/
+/* Limits and status codes                                                    */
+/*===========================================================================*/
+
+#define CT_SHM_MAX_CLIENTS    64
+#define CT_SHM_NAME_MAX       64    /* Including the leading '/' and NUL */
+
+#define CT_SHM_OK             0     /* Operation completed */
+#define CT_SHM_AGAIN          1     /* Ring full (server) or empty (client) */
+#define CT_SHM_CLOSED         2     /* Server closed and every batch consumed */
+#define CT_SHM_ERROR          (-1)  /* Invalid argument, layout or OS failure */
+
+/*===========================================================================*/
+/* Handles                                                                    */
+/*===========================================================================*/
+
+typedef struct {
+    uint32_t slot_count;           /**< Batches in flight, >= 1 */
+    uint32_t batch_size;           /**< Samples per batch */
+    uint32_t max_elements;         /**< Largest total_elements of any sample */
+    ct_hash_t dataset_hash;        /**< Published dataset commitment */
+    ct_hash_t config_hash;         /**< Published ct_hash_config */
+} ct_shm_params_t;
+
+typedef struct {
+    void *base;                    /**< Mapped region */
+    size_t size;                   /**< Mapped bytes */
+    uint64_t next_seq;             /**< Sequence number of the next publish */
+    char name[CT_SHM_NAME_MAX];    /**< Object name, for unlink */
+} ct_shm_server_t;
+
+typedef struct {
+    void *base;                    /**< Mapped region */
+    size_t size;                   /**< Mapped bytes */
+    uint32_t client_id;            /**< Cursor slot in the header */
+    uint32_t held;                 /**< A view is outstanding */
+    uint64_t cursor;               /**< Sequence number of the next batch */
+    uint32_t batch_size;           /**< From the server's layout */
+    uint32_t max_elements;         /**< From the server's layout */
+} ct_shm_client_t;
+
+/*===========================================================================*/
+/* Server                                                                     */
+/*===========================================================================*/
+
+/**
+ * @brief Bytes of shared memory a ring with these parameters occupies.
+ * @param params Ring layout
+ * @return Region size, or 0 if the layout is invalid or does not fit size_t
+ */
+size_t ct_shm_region_size(const ct_shm_params_t *params);
+
+/**
+ * @brief Create and map a new shared-memory ring.
+ * @param server Handle to initialise
+ * @param name POSIX object name ("/name"); must not already exist
+ * @param params Ring layout and dataset/config commitments
+ * @return CT_SHM_OK or CT_SHM_ERROR
+ * @note The object is created with mode 0600, so clients must run as the
+ *       same user.
+ * @traceability CT-STRUCT-001 §20
+ */
+int ct_shm_server_create(ct_shm_server_t *server,
+                         const char *name,
+                         const ct_shm_params_t *params);
+
+/**
+ * @brief Copy a filled batch into the next ring slot.
+ * @param server Server handle
+ * @param batch Batch from ct_batch_fill (and any augmentation/normalisation)
+ * @param epoch Epoch the batch belongs to
+ * @return CT_SHM_OK, CT_SHM_AGAIN if a live client still holds the oldest
+ *         slot or the lock is busy, or CT_SHM_ERROR if the batch does not
+ *         fit the layout
+ * @note Sample hashes and the batch hash are published as computed by the
+ *       server; clients never re-hash unless they choose to verify.
+ * @traceability CT-STRUCT-001 §20
+ */
+int ct_shm_server_publish(ct_shm_server_t *server,
+                          const ct_batch_t *batch,
+                          uint32_t epoch);
+
+/**
+ * @brief Publish the provenance chain head.
+ * @param server Server handle
+ * @param prov Chain state after ct_provenance_advance
+ * @return CT_SHM_OK, or CT_SHM_AGAIN if the lock is busy
+ * @traceability CT-MATH-001 §10.7, CT-STRUCT-001 §20
+ */
+int ct_shm_server_set_provenance(ct_shm_server_t *server,
+                                 const ct_provenance_t *prov);
+
+/**
+ * @brief Evict every client whose process has exited without detaching.
+ * @param server Server handle
+ * @param evicted Receives the number of entries freed (may be NULL)
+ * @return CT_SHM_OK, or CT_SHM_AGAIN if the lock is busy
+ * @note Publish already evicts a dead client that blocks it; reaping
+ *       eagerly frees client entries for new attaches.
+ * @traceability CT-STRUCT-001 §20
+ */
+int ct_shm_server_reap(ct_shm_server_t *server, uint32_t *evicted);
+
+/**
+ * @brief Mark the stream finished; clients drain then see CT_SHM_CLOSED.
+ * @param server Server handle
+ */
+void ct_shm_server_close(ct_shm_server_t *server);
+
+/**
+ * @brief Close, unmap and unlink the ring.
+ * @param server Server handle
+ * @note Clients that are still attached keep their mapping until detach.
+ */
+void ct_shm_server_destroy(ct_shm_server_t *server);
+
+/*===========================================================================*/
+/* Client                                                                     */
+/*===========================================================================*/
+
+/**
+ * @brief Attach to an existing ring.
+ * @param client Handle to initialise
+ * @param name POSIX object name used by the server
+ * @return CT_SHM_OK, CT_SHM_AGAIN if the lock is busy or the server is
+ *         still inside ct_shm_server_create, or CT_SHM_ERROR if the object
+ *         is missing, has an unknown layout, or all client slots are taken
+ *         by live processes
+ * @note A client sees batches published after it attaches. A client
+ *       started alongside the server retries on CT_SHM_AGAIN; it sees
+ *       CT_SHM_ERROR until the object exists.
+ * @traceability CT-STRUCT-001 §20
+ */
+int ct_shm_client_attach(ct_shm_client_t *client, const char *name);
+
+/**
+ * @brief Borrow the next batch as a zero-copy view.
+ * @param client Client handle
+ * @param view Batch to point at the slot
+ * @param samples Caller array of batch_size sample headers; data pointers
+ *                refer into shared memory
+ * @param epoch Receives the batch's epoch (may be NULL)
+ * @return CT_SHM_OK, CT_SHM_AGAIN if nothing new is published yet,
+ *         CT_SHM_CLOSED at end of stream, or CT_SHM_ERROR if a view is
+ *         already held
+ * @note The view stays valid until ct_shm_client_release. Treat the sample
+ *       data as read-only; other clients share it.
+ * @traceability CT-STRUCT-001 §20
+ */
+int ct_shm_client_acquire(ct_shm_client_t *client,
+                          ct_batch_t *view,
+                          ct_sample_t *samples,
+                          uint32_t *epoch);
+
+/**
+ * @brief Return the held view so the server may reuse its slot.
+ * @param client Client handle
+ */
+void ct_shm_client_release(ct_shm_client_t *client);
+
+/**
+ * @brief Read the published commitments.
+ * @param client Client handle
+ * @param dataset_hash Receives the dataset hash (may be NULL)
+ * @param config_hash Receives the config hash (may be NULL)
+ * @param prov Receives the latest provenance chain head (may be NULL)
+ * @return CT_SHM_OK, or CT_SHM_AGAIN if the lock is busy
+ * @traceability CT-MATH-001 §10.7, CT-STRUCT-001 §20
+ */
+int ct_shm_client_commitments(ct_shm_client_t *client,
+                              ct_hash_t dataset_hash,
+                              ct_hash_t config_hash,
+                              ct_provenance_t *prov);
+
+/**
+ * @brief Re-hash every sample of a view and check the batch commitment.
+ * @param view View from ct_shm_client_acquire
+ * @return 1 if every sample hash and the batch hash match, 0 otherwise
+ * @note ct_batch_verify only checks the batch hash against the published
+ *       sample hashes; this also checks the sample data against them.
+ * @traceability CT-MATH-001 §10.2, §10.5
+ */
+int ct_shm_view_verify(const ct_batch_t *view);
+
+/**
+ * @brief Give up the client slot and unmap.
+ * @param client Client handle
+ */
+void ct_shm_client_detach(ct_shm_client_t *client);
+
+#endif /* CT_SHM_H */
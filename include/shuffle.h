@@ -28,6 +28,128 @@
  */
 uint32_t ct_permute_index(uint32_t index, uint32_t N, uint64_t seed, uint32_t epoch);
 
+/**
+ * @brief Permute a contiguous range of indices (batched ct_permute_index).
+ * @param start First index
+ * @param count Number of indices
+ * @param N Dataset size
+ * @param seed Random seed
+ * @param epoch Current epoch
+ * @param out Output array [count]: out[j] = ct_permute_index(start + j, N, seed, epoch)
+ * @traceability CT-MATH-001 §7.2, REQ-SHUF-001
+ */
+void ct_permute_range(uint32_t start,
+                      uint32_t count,
+                      uint32_t N,
+                      uint64_t seed,
+                      uint32_t epoch,
+                      uint32_t *out);
+
+/*===========================================================================*/
+/* Weighted sampling (CT-MATH-001 §7.6)                                      */
+/*===========================================================================*/
+
+/**
+ * @brief Build an alias table from integer weights (Vose's method).
+ * @param table Receives the table; its arrays are prob and alias
+ * @param weights Weight of each sample, n entries (0 = never drawn)
+ * @param n Number of samples
+ * @param prob Storage for n acceptance thresholds
+ * @param alias Storage for n alias indices
+ * @param work Scratch for n indices
+ * @return 0 on success, -1 if n is 0 or the weights sum to 0 or above
+ *         2^32 − 1 (table untouched)
+ * @note O(n) and exact: integer arithmetic only, so draw probabilities are
+ *       exactly weight / Σ weights. Sets table_hash (ct_hash_alias_table).
+ * @traceability CT-MATH-001 §7.6
+ */
+int ct_alias_build(ct_alias_table_t *table,
+                   const uint32_t *weights,
+                   uint32_t n,
+                   uint32_t *prob,
+                   uint32_t *alias,
+                   uint32_t *work);
+
+/**
+ * @brief Draw one dataset index from an alias table.
+ * @param table Table from ct_alias_build
+ * @param seed Random seed
+ * @param epoch Current epoch
+ * @param draw Position in the epoch's sequence (below 2^31)
+ * @return Index in [0, num_samples), with replacement across draws
+ * @note O(1): one column draw and one coin, both version 2 bounded draws.
+ * @traceability CT-MATH-001 §7.6
+ */
+uint32_t ct_alias_draw(const ct_alias_table_t *table, uint64_t seed, uint32_t epoch,
+                       uint32_t draw);
+
+/**
+ * @brief Draw a contiguous range of an epoch's sequence (batched ct_alias_draw).
+ * @param out Output array [count]: out[j] = ct_alias_draw(table, seed, epoch, start + j)
+ * @traceability CT-MATH-001 §7.6
+ */
+void ct_alias_draw_range(const ct_alias_table_t *table,
+                         uint64_t seed,
+                         uint32_t epoch,
+                         uint32_t start,
+                         uint32_t count,
+                         uint32_t *out);
+
+/*===========================================================================*/
+/* Stratified ordering (CT-MATH-001 §7.7)                                    */
+/*===========================================================================*/
+
+/**
+ * @brief Group a dataset by class and fix each class's batch slots.
+ * @param strata Receives the strata; its arrays are offsets, members, slots
+ * @param labels Class of each sample, n entries in [0, num_classes)
+ * @param n Number of samples
+ * @param quota Samples of each class per batch, num_classes entries; must
+ *              outlive strata
+ * @param num_classes Number of classes
+ * @param offsets Storage for num_classes + 1 class boundaries
+ * @param members Storage for n dataset indices
+ * @param slots Storage for Σ quota slot numbers
+ * @param work Scratch for num_classes counters
+ * @return 0 on success, -1 if n or num_classes is 0, a label is out of
+ *         range, the quotas sum to 0 or above 2^31 − 1, or a class with a
+ *         quota has no samples (strata untouched)
+ * @note Stable counting sort, O(n + num_classes); the slot schedule costs
+ *       O(batch_size × num_classes) once. Sets strata_hash (ct_hash_strata).
+ * @traceability CT-MATH-001 §7.7
+ */
+int ct_strata_build(ct_strata_t *strata,
+                    const uint32_t *labels,
+                    uint32_t n,
+                    const uint32_t *quota,
+                    uint32_t num_classes,
+                    uint32_t *offsets,
+                    uint32_t *members,
+                    uint32_t *slots,
+                    uint32_t *work);
+
+/**
+ * @brief Dataset indices at a run of positions in one class's stream.
+ * @param strata Strata from ct_strata_build
+ * @param seed Random seed
+ * @param epoch Current epoch
+ * @param class_id Class
+ * @param position First stream position; batch b starts at b × quota[class_id]
+ * @param count Number of positions
+ * @param out Output array [count], indices of samples of class_id
+ * @note Position p is pass p / n_c, slot p mod n_c of the class's n_c
+ *       members, so each pass visits every member once in a fresh order.
+ *       Cost is that of ct_permute_range over n_c.
+ * @traceability CT-MATH-001 §7.7
+ */
+void ct_strata_class_range(const ct_strata_t *strata,
+                           uint64_t seed,
+                           uint32_t epoch,
+                           uint32_t class_id,
+                           uint64_t position,
+                           uint32_t count,
+                           uint32_t *out);
+
 /**
  * @brief Initialize shuffle context.
  * @param ctx Shuffle context
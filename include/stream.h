@@ -0,0 +1,102 @@
+/**
+ * @file stream.h
+ * @project Certifiable Data Pipeline
+ * @brief Framed batch streaming over a local stream socket.
+ *
+ * @details For consumers that cannot map the shared-memory ring (shm.h), a
+ *          batch is sent as a sequence of frames on a Unix-domain stream
+ *          socket (or any connected stream descriptor):
+ *
+ *            BEGIN  { epoch, batch_index, batch_size }
+ *            SAMPLE { header, sample_hash, data }   × batch_size
+ *            END    { batch_hash }
+ *
+ *          The sender gathers frame headers and sample data straight from
+ *          the batch with sendmsg; the receiver reads each payload directly
+ *          into the caller's buffer. Verification is incremental: each
+ *          sample hash is folded into a streaming Merkle root as its frame
+ *          arrives (and, optionally, checked against the received data), so
+ *          the batch commitment is settled the moment END is read.
+ *
+ * @traceability CT-STRUCT-001 §21
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#ifndef CT_STREAM_H
+#define CT_STREAM_H
+
+#include "ct_types.h"
+
+/*===========================================================================*/
+/* Wire format and status codes                                               */
+/*===========================================================================*/
+
+#define CT_STREAM_MAGIC          0x46535443U   /* "CTSF" */
+
+#define CT_STREAM_FRAME_BEGIN    1U
+#define CT_STREAM_FRAME_SAMPLE   2U
+#define CT_STREAM_FRAME_END      3U
+
+#define CT_STREAM_FRAME_HEADER   12U   /* magic, type, payload length */
+#define CT_STREAM_BEGIN_BYTES    12U   /* epoch, batch_index, batch_size */
+#define CT_STREAM_SAMPLE_META    64U   /* 8 × u32 sample header + sample hash */
+#define CT_STREAM_END_BYTES      32U   /* batch hash */
+
+/* Receiver options */
+#define CT_STREAM_VERIFY_SAMPLES (1U << 0)   /* Re-hash each sample's data */
+
+#define CT_STREAM_OK             0     /* Batch received and verified */
+#define CT_STREAM_EOF            1     /* Peer closed cleanly between batches */
+#define CT_STREAM_ERROR          (-1)  /* I/O failure, bad framing or buffer too small */
+#define CT_STREAM_CORRUPT        (-2)  /* Framing intact but a hash does not match */
+
+/*===========================================================================*/
+/* Sender                                                                     */
+/*===========================================================================*/
+
+/**
+ * @brief Send one batch as BEGIN, batch_size SAMPLE frames and END.
+ * @param fd Connected stream socket
+ * @param batch Filled batch (padding slots are sent as empty samples)
+ * @param epoch Epoch the batch belongs to
+ * @return CT_STREAM_OK or CT_STREAM_ERROR
+ * @note Blocks until every byte is queued. Sample data is gathered from the
+ *       batch in place; nothing is staged in an intermediate buffer. Uses
+ *       MSG_NOSIGNAL, so a vanished peer is an error, not SIGPIPE.
+ * @traceability CT-STRUCT-001 §21
+ */
+int ct_stream_send_batch(int fd, const ct_batch_t *batch, uint32_t epoch);
+
+/*===========================================================================*/
+/* Receiver                                                                   */
+/*===========================================================================*/
+
+/**
+ * @brief Receive and verify one batch.
+ * @param fd Connected stream socket
+ * @param batch Batch from ct_batch_init; batch_size must match the sender's
+ * @param data_buf Storage for the sample data of the whole batch
+ * @param capacity data_buf size in elements
+ * @param flags CT_STREAM_VERIFY_SAMPLES or 0
+ * @param epoch Receives the batch's epoch (may be NULL)
+ * @return CT_STREAM_OK, CT_STREAM_EOF, CT_STREAM_ERROR or CT_STREAM_CORRUPT
+ * @note Without CT_STREAM_VERIFY_SAMPLES the check equals ct_batch_verify:
+ *       the received sample hashes must produce the received batch hash.
+ *       With it, every sample's data must also match its hash. Once a
+ *       mismatch is seen the rest of the batch is drained without hashing,
+ *       so after CT_STREAM_CORRUPT the stream is aligned on the next batch.
+ * @traceability CT-MATH-001 §10.2, §10.5, CT-STRUCT-001 §21
+ */
+int ct_stream_recv_batch(int fd,
+                         ct_batch_t *batch,
+                         int32_t *data_buf,
+                         uint32_t capacity,
+                         uint32_t flags,
+                         uint32_t *epoch);
+
+#endif /* CT_STREAM_H */
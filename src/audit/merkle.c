@@ -102,51 +102,248 @@ void ct_hash_internal(const ct_hash_t left, const ct_hash_t right, ct_hash_t out
 /* ct_merkle_root (CT-MATH-001 §10.3)                                        */
 /*===========================================================================*/
 
-void ct_merkle_root(const ct_hash_t *leaves, uint32_t count, ct_hash_t out_root)
+/* Streaming accumulator: level[k] holds a complete subtree of 2^k leaves
+ * whenever bit k of count is set. Folding the partial subtrees from the
+ * lowest level up reproduces the level-by-level construction in which an
+ * odd last node is promoted unchanged. */
+
+void ct_merkle_acc_init(ct_merkle_acc_t *acc)
+{
+    acc->count = 0;
+}
+
+void ct_merkle_acc_push(ct_merkle_acc_t *acc, const ct_hash_t leaf)
 {
-    if (count == 0) {
+    ct_hash_t carry;
+    uint32_t lvl = 0;
+    
+    memcpy(carry, leaf, 32);
+    while ((acc->count & (1U << lvl)) != 0) {
+        ct_hash_internal(acc->level[lvl], carry, carry);
+        lvl++;
+    }
+    memcpy(acc->level[lvl], carry, 32);
+    acc->count++;
+}
+
+void ct_merkle_acc_finish(const ct_merkle_acc_t *acc, ct_hash_t out_root)
+{
+    if (acc->count == 0) {
         memset(out_root, 0, 32);
         return;
     }
     
-    if (count == 1) {
-        memcpy(out_root, leaves[0], 32);
-        return;
+    ct_hash_t carry;
+    uint32_t lvl = 0;
+    while ((acc->count & (1U << lvl)) == 0) {
+        lvl++;
     }
+    memcpy(carry, acc->level[lvl], 32);
     
-    /* Build tree bottom-up using temporary storage */
-    /* Maximum tree depth for 2^20 samples is 20 levels */
-    ct_hash_t tree[2048];  /* Support up to 1024 leaves in this pass */
-    
-    uint32_t current_level = count;
-    uint32_t next_level;
-    
-    /* Copy leaves to tree */
-    for (uint32_t i = 0; i < count && i < 1024; i++) {
-        memcpy(tree[i], leaves[i], 32);
-    }
-    
-    /* Build tree upward */
-    while (current_level > 1) {
-        next_level = (current_level + 1) / 2;
-        
-        for (uint32_t i = 0; i < next_level; i++) {
-            uint32_t left_idx = i * 2;
-            uint32_t right_idx = left_idx + 1;
-            
-            if (right_idx < current_level) {
-                /* Both children exist */
-                ct_hash_internal(tree[left_idx], tree[right_idx], tree[i]);
-            } else {
-                /* Odd number of nodes - promote last node */
-                memcpy(tree[i], tree[left_idx], 32);
-            }
+    for (lvl++; lvl < 32; lvl++) {
+        if ((acc->count & (1U << lvl)) != 0) {
+            ct_hash_internal(acc->level[lvl], carry, carry);
         }
-        
-        current_level = next_level;
     }
+    memcpy(out_root, carry, 32);
+}
+
+void ct_merkle_root(const ct_hash_t *leaves, uint32_t count, ct_hash_t out_root)
+{
+    /* O(log n) state, so any leaf count is supported */
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
     
-    memcpy(out_root, tree[0], 32);
+    for (uint32_t i = 0; i < count; i++) {
+        ct_merkle_acc_push(&acc, leaves[i]);
+    }
+    ct_merkle_acc_finish(&acc, out_root);
+}
+
+/*===========================================================================*/
+/* Retained tree (CT-MATH-001 §10.9)                                         */
+/*===========================================================================*/
+
+#define TREE_MAX_LEVELS 33U
+
+/* Offset of each level in nodes[]; returns the number of levels */
+static uint32_t tree_levels(uint32_t n, size_t offsets[TREE_MAX_LEVELS])
+{
+    size_t offset = 0;
+    uint32_t count = n;
+    uint32_t k = 0;
+    for (;;) {
+        offsets[k++] = offset;
+        if (count <= 1U) {
+            return k;
+        }
+        offset += count;
+        count = count / 2U + (count & 1U);
+    }
+}
+
+int ct_merkle_tree_build(ct_merkle_tree_t *tree,
+                         const ct_hash_t *leaves,
+                         uint32_t n,
+                         ct_hash_t *nodes)
+{
+    if (n == 0) {
+        return -1;
+    }
+    size_t offsets[TREE_MAX_LEVELS];
+    uint32_t levels = tree_levels(n, offsets);
+    memcpy(nodes, leaves, (size_t)n * 32U);
+
+    /* Level by level; an odd last node is promoted unchanged (§10.3) */
+    uint32_t count = n;
+    for (uint32_t k = 1; k < levels; k++) {
+        ct_hash_t *below = &nodes[offsets[k - 1U]];
+        ct_hash_t *level = &nodes[offsets[k]];
+        uint32_t pairs = count / 2U;
+        for (uint32_t j = 0; j < pairs; j++) {
+            ct_hash_internal(below[2U * j], below[2U * j + 1U], level[j]);
+        }
+        if ((count & 1U) != 0) {
+            memcpy(level[pairs], below[count - 1U], 32);
+        }
+        count = pairs + (count & 1U);
+    }
+
+    tree->nodes = nodes;
+    tree->num_leaves = n;
+    tree->num_levels = levels;
+    return 0;
+}
+
+void ct_merkle_tree_root(const ct_merkle_tree_t *tree, ct_hash_t out_root)
+{
+    size_t offsets[TREE_MAX_LEVELS];
+    (void)tree_levels(tree->num_leaves, offsets);
+    memcpy(out_root, tree->nodes[offsets[tree->num_levels - 1U]], 32);
+}
+
+int ct_merkle_tree_update(ct_merkle_tree_t *tree, uint32_t index, const ct_hash_t leaf)
+{
+    if (index >= tree->num_leaves) {
+        return -1;
+    }
+    size_t offsets[TREE_MAX_LEVELS];
+    (void)tree_levels(tree->num_leaves, offsets);
+    memcpy(tree->nodes[index], leaf, 32);
+
+    uint32_t j = index;
+    uint32_t count = tree->num_leaves;
+    for (uint32_t k = 1; k < tree->num_levels; k++) {
+        ct_hash_t *below = &tree->nodes[offsets[k - 1U]];
+        ct_hash_t *parent = &tree->nodes[offsets[k] + j / 2U];
+        uint32_t left = j & ~1U;
+        if (left + 1U < count) {
+            ct_hash_internal(below[left], below[left + 1U], *parent);
+        } else {
+            memcpy(*parent, below[left], 32);
+        }
+        j /= 2U;
+        count = count / 2U + (count & 1U);
+    }
+    return 0;
+}
+
+/* Node k levels up at position j: the root of leaves [j·2^k, (j+1)·2^k)
+ * clipped to N. Above the top level only position 0 exists, as the root */
+static const uint8_t *tree_node(const ct_merkle_tree_t *tree,
+                                const size_t *offsets,
+                                uint32_t k,
+                                uint32_t j)
+{
+    if (k >= tree->num_levels) {
+        return tree->nodes[offsets[tree->num_levels - 1U]];
+    }
+    return tree->nodes[offsets[k] + j];
+}
+
+/* Whether subtree (k, j) holds a leaf that differs or exists in only one
+ * version. Nodes are comparable only when both clip it at the same leaf */
+static int subtree_differs(const ct_merkle_tree_t *a, const size_t *off_a,
+                           const ct_merkle_tree_t *b, const size_t *off_b,
+                           uint32_t k, uint32_t j)
+{
+    uint64_t na = a->num_leaves;
+    uint64_t nb = b->num_leaves;
+    uint64_t lo = (uint64_t)j << k;
+    uint64_t hi = (uint64_t)(j + 1U) << k;
+    if (lo >= ((na > nb) ? na : nb)) {
+        return 0;
+    }
+    uint64_t end_a = (hi < na) ? hi : na;
+    uint64_t end_b = (hi < nb) ? hi : nb;
+    return end_a != end_b ||
+           memcmp(tree_node(a, off_a, k, j), tree_node(b, off_b, k, j), 32) != 0;
+}
+
+uint32_t ct_merkle_diff(const ct_merkle_tree_t *a,
+                        const ct_merkle_tree_t *b,
+                        uint32_t *out,
+                        uint32_t max_out)
+{
+    size_t off_a[TREE_MAX_LEVELS];
+    size_t off_b[TREE_MAX_LEVELS];
+    (void)tree_levels(a->num_leaves, off_a);
+    (void)tree_levels(b->num_leaves, off_b);
+
+    /* Depth-first, left child on top, so leaves come out ascending */
+    uint32_t stack_level[2U * TREE_MAX_LEVELS];
+    uint32_t stack_index[2U * TREE_MAX_LEVELS];
+    uint32_t sp = 0;
+    stack_level[sp] = ((a->num_levels > b->num_levels) ? a->num_levels : b->num_levels) - 1U;
+    stack_index[sp++] = 0;
+
+    uint32_t changed = 0;
+    while (sp > 0) {
+        sp--;
+        uint32_t k = stack_level[sp];
+        uint32_t j = stack_index[sp];
+        if (!subtree_differs(a, off_a, b, off_b, k, j)) {
+            continue;
+        }
+
+        if (k == 0) {
+            if (changed < max_out) {
+                out[changed] = j;
+            }
+            changed++;
+            continue;
+        }
+        stack_level[sp] = k - 1U;
+        stack_index[sp++] = 2U * j + 1U;
+        stack_level[sp] = k - 1U;
+        stack_index[sp++] = 2U * j;
+    }
+    return changed;
+}
+
+uint32_t ct_merkle_first_diff(const ct_merkle_tree_t *a, const ct_merkle_tree_t *b)
+{
+    size_t off_a[TREE_MAX_LEVELS];
+    size_t off_b[TREE_MAX_LEVELS];
+    (void)tree_levels(a->num_leaves, off_a);
+    (void)tree_levels(b->num_leaves, off_b);
+
+    uint32_t k = ((a->num_levels > b->num_levels) ? a->num_levels : b->num_levels) - 1U;
+    uint32_t j = 0;
+    if (!subtree_differs(a, off_a, b, off_b, k, j)) {
+        return (a->num_leaves > b->num_leaves) ? a->num_leaves : b->num_leaves;
+    }
+
+    /* A differing node has a differing child: take the left one if it
+     * differs, else the right. One comparison per level */
+    while (k > 0) {
+        k--;
+        j *= 2U;
+        if (!subtree_differs(a, off_a, b, off_b, k, j)) {
+            j++;
+        }
+    }
+    return j;
 }
 
 /*===========================================================================*/
@@ -159,6 +356,400 @@ void ct_hash_batch(const ct_batch_t *batch, ct_hash_t out_hash)
     ct_merkle_root((const ct_hash_t *)batch->sample_hashes, batch->batch_size, out_hash);
 }
 
+/*===========================================================================*/
+/* ct_hash_dataset_leaves / ct_hash_batch_refs (CT-STRUCT-001 §10.1)         */
+/*===========================================================================*/
+
+void ct_hash_dataset_leaves(const ct_dataset_t *dataset, ct_hash_t *out_leaves)
+{
+    for (uint32_t i = 0; i < dataset->num_samples; i++) {
+        ct_hash_sample(&dataset->samples[i], out_leaves[i]);
+    }
+}
+
+void ct_hash_dataset(const ct_hash_t *leaves, uint32_t num_samples, ct_hash_t out_hash)
+{
+    ct_merkle_root(leaves, num_samples, out_hash);
+}
+
+static void put_u32_le(uint8_t *buf, uint32_t v)
+{
+    buf[0] = (uint8_t)(v & 0xFF);
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);
+    buf[2] = (uint8_t)((v >> 16) & 0xFF);
+    buf[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+void ct_hash_batch_refs(const ct_batch_ref_t *batch,
+                        const ct_hash_t *leaf_hashes,
+                        ct_hash_t out_hash)
+{
+    static const ct_hash_t zero_leaf = {0};
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+    
+    /* Content mode matches ct_hash_batch: padding slots are zero leaves.
+     * Reference mode commits to filled slots only. */
+    uint32_t slots = (batch->hash_mode == CT_BATCH_HASH_REFERENCE) ?
+                     batch->count : batch->batch_size;
+    for (uint32_t i = 0; i < slots; i++) {
+        uint32_t idx = batch->refs[i].shuffled_index;
+        ct_merkle_acc_push(&acc, (idx == CT_SAMPLE_REF_NONE) ? zero_leaf : leaf_hashes[idx]);
+    }
+    
+    if (batch->hash_mode != CT_BATCH_HASH_REFERENCE) {
+        ct_merkle_acc_finish(&acc, out_hash);
+        return;
+    }
+    
+    /* H = SHA256(0x05 || mode || dataset_hash || root || epoch || batch_index || count) */
+    ct_hash_t root;
+    ct_merkle_acc_finish(&acc, root);
+    
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    
+    uint8_t prefix = CT_DOMAIN_BATCH_REF;
+    ct_sha256_update(&ctx, &prefix, 1);
+    
+    uint8_t buf[4];
+    put_u32_le(buf, batch->hash_mode);
+    ct_sha256_update(&ctx, buf, 4);
+    ct_sha256_update(&ctx, batch->dataset_hash, 32);
+    ct_sha256_update(&ctx, root, 32);
+    put_u32_le(buf, batch->epoch);
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, batch->batch_index);
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, batch->count);
+    ct_sha256_update(&ctx, buf, 4);
+    
+    ct_sha256_final(&ctx, out_hash);
+}
+
+/*===========================================================================*/
+/* ct_hash_alias_table (CT-MATH-001 §7.6)                                    */
+/*===========================================================================*/
+
+#define ALIAS_LEAF_COLUMNS 64U
+
+void ct_hash_alias_table(const ct_alias_table_t *table, ct_hash_t out_hash)
+{
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+
+    /* Leaf: prefix || first column || (prob, alias) per column */
+    uint8_t buf[8 * ALIAS_LEAF_COLUMNS];
+    for (uint32_t base = 0; base < table->num_samples; base += ALIAS_LEAF_COLUMNS) {
+        uint32_t len = table->num_samples - base;
+        if (len > ALIAS_LEAF_COLUMNS) {
+            len = ALIAS_LEAF_COLUMNS;
+        }
+        ct_sha256_ctx_t ctx;
+        ct_sha256_init(&ctx);
+        uint8_t prefix = CT_DOMAIN_ALIAS;
+        ct_sha256_update(&ctx, &prefix, 1);
+        put_u32_le(buf, base);
+        ct_sha256_update(&ctx, buf, 4);
+        for (uint32_t j = 0; j < len; j++) {
+            put_u32_le(&buf[8 * j], table->prob[base + j]);
+            put_u32_le(&buf[8 * j + 4], table->alias[base + j]);
+        }
+        ct_sha256_update(&ctx, buf, 8 * len);
+
+        ct_hash_t leaf;
+        ct_sha256_final(&ctx, leaf);
+        ct_merkle_acc_push(&acc, leaf);
+    }
+    ct_merkle_acc_finish(&acc, out_hash);
+}
+
+/*===========================================================================*/
+/* ct_hash_strata (CT-MATH-001 §7.7)                                         */
+/*===========================================================================*/
+
+#define STRATA_LEAF_MEMBERS 64U
+
+void ct_hash_strata(const ct_strata_t *strata, ct_hash_t out_hash)
+{
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+
+    /* Leaf: prefix || first position || members */
+    uint8_t buf[4 * STRATA_LEAF_MEMBERS];
+    uint8_t prefix = CT_DOMAIN_STRATA;
+    for (uint32_t base = 0; base < strata->num_samples; base += STRATA_LEAF_MEMBERS) {
+        uint32_t len = strata->num_samples - base;
+        if (len > STRATA_LEAF_MEMBERS) {
+            len = STRATA_LEAF_MEMBERS;
+        }
+        ct_sha256_ctx_t ctx;
+        ct_sha256_init(&ctx);
+        ct_sha256_update(&ctx, &prefix, 1);
+        put_u32_le(buf, base);
+        ct_sha256_update(&ctx, buf, 4);
+        for (uint32_t j = 0; j < len; j++) {
+            put_u32_le(&buf[4 * j], strata->members[base + j]);
+        }
+        ct_sha256_update(&ctx, buf, 4 * len);
+
+        ct_hash_t leaf;
+        ct_sha256_final(&ctx, leaf);
+        ct_merkle_acc_push(&acc, leaf);
+    }
+    ct_hash_t root;
+    ct_merkle_acc_finish(&acc, root);
+
+    /* prefix || C || N || (quota, end offset) per class || member root */
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, &prefix, 1);
+    put_u32_le(buf, strata->num_classes);
+    put_u32_le(buf + 4, strata->num_samples);
+    ct_sha256_update(&ctx, buf, 8);
+    for (uint32_t c = 0; c < strata->num_classes; c++) {
+        put_u32_le(buf, strata->quota[c]);
+        put_u32_le(buf + 4, strata->offsets[c + 1]);
+        ct_sha256_update(&ctx, buf, 8);
+    }
+    ct_sha256_update(&ctx, root, 32);
+    ct_sha256_final(&ctx, out_hash);
+}
+
+/*===========================================================================*/
+/* ct_hash_exclusion (CT-MATH-001 §7.9)                                      */
+/*===========================================================================*/
+
+#define EXCLUSION_LEAF_WORDS 64U
+
+void ct_hash_exclusion(const ct_exclusion_t *exclusion, ct_hash_t out_hash)
+{
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+
+    /* Leaf: prefix || first word || words, little-endian */
+    uint8_t buf[8 * EXCLUSION_LEAF_WORDS];
+    uint8_t prefix = CT_DOMAIN_EXCLUSION;
+    uint32_t num_words = (exclusion->num_samples + 63U) / 64U;
+    for (uint32_t base = 0; base < num_words; base += EXCLUSION_LEAF_WORDS) {
+        uint32_t len = num_words - base;
+        if (len > EXCLUSION_LEAF_WORDS) {
+            len = EXCLUSION_LEAF_WORDS;
+        }
+        ct_sha256_ctx_t ctx;
+        ct_sha256_init(&ctx);
+        ct_sha256_update(&ctx, &prefix, 1);
+        put_u32_le(buf, base);
+        ct_sha256_update(&ctx, buf, 4);
+        for (uint32_t j = 0; j < len; j++) {
+            uint64_t w = exclusion->words[base + j];
+            put_u32_le(&buf[8 * j], (uint32_t)w);
+            put_u32_le(&buf[8 * j + 4], (uint32_t)(w >> 32));
+        }
+        ct_sha256_update(&ctx, buf, 8 * len);
+
+        ct_hash_t leaf;
+        ct_sha256_final(&ctx, leaf);
+        ct_merkle_acc_push(&acc, leaf);
+    }
+    ct_merkle_acc_finish(&acc, out_hash);
+}
+
+void ct_hash_dataset_excluding(const ct_hash_t dataset_hash,
+                               const ct_exclusion_t *exclusion,
+                               ct_hash_t out_hash)
+{
+    /* prefix || dataset root || N || kept || bitmap root */
+    uint8_t buf[8];
+    uint8_t prefix = CT_DOMAIN_EXCLUSION;
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, &prefix, 1);
+    ct_sha256_update(&ctx, dataset_hash, 32);
+    put_u32_le(buf, exclusion->num_samples);
+    put_u32_le(buf + 4, exclusion->num_kept);
+    ct_sha256_update(&ctx, buf, 8);
+    ct_sha256_update(&ctx, exclusion->bitmap_hash, 32);
+    ct_sha256_final(&ctx, out_hash);
+}
+
+/*===========================================================================*/
+/* ct_hash_mixture (CT-MATH-001 §7.10)                                       */
+/*===========================================================================*/
+
+void ct_hash_mixture(const ct_mixture_t *mixture, ct_hash_t out_hash)
+{
+    /* prefix || S || W || M || (weight, size, root) per source */
+    uint8_t buf[12];
+    uint8_t prefix = CT_DOMAIN_MIXTURE;
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, &prefix, 1);
+    put_u32_le(buf, mixture->num_sources);
+    put_u32_le(buf + 4, mixture->total_weight);
+    put_u32_le(buf + 8, mixture->epoch_samples);
+    ct_sha256_update(&ctx, buf, 12);
+    for (uint32_t s = 0; s < mixture->num_sources; s++) {
+        put_u32_le(buf, mixture->weights[s]);
+        put_u32_le(buf + 4, mixture->datasets[s].num_samples);
+        ct_sha256_update(&ctx, buf, 8);
+        ct_sha256_update(&ctx, mixture->datasets[s].dataset_hash, 32);
+    }
+    ct_sha256_final(&ctx, out_hash);
+}
+
+void ct_hash_mixture_leaf(uint32_t source, const ct_hash_t sample_hash, ct_hash_t out_hash)
+{
+    /* prefix || source || sample hash: one SHA-256 block */
+    uint8_t buf[37];
+    buf[0] = CT_DOMAIN_MIXTURE;
+    put_u32_le(buf + 1, source);
+    memcpy(buf + 5, sample_hash, 32);
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, buf, sizeof(buf));
+    ct_sha256_final(&ctx, out_hash);
+}
+
+/*===========================================================================*/
+/* ct_hash_config (CT-MATH-001 §11.4)                                        */
+/*===========================================================================*/
+
+void ct_hash_config(const ct_config_t *config, ct_hash_t out_hash)
+{
+    ct_sha256_ctx_t ctx;
+    ct_sha256_init(&ctx);
+    
+    /* Version 1 layout; version 2 appends the batch hash mode; version 3
+     * (any geometry flag set) appends it and the geometry parameters;
+     * version 4 (cutout set) appends all of these and the cutout parameters;
+     * version 5 (mixup or cutmix set) appends those and the mixing parameters;
+     * version 6 (weighted sampler set) appends those and the sampler table;
+     * version 7 (strata set) appends those and the strata; version 8
+     * (epoch subsampling) appends those and the epoch size.
+     * Appended augmentation and sampler fields read as zero when absent */
+    static const ct_augment_ctx_t no_augment;
+    static const ct_alias_table_t no_sampler;
+    static const ct_strata_t no_strata;
+    const ct_augment_ctx_t *aug = config->augment;
+    uint8_t version = (config->batch_hash_mode == CT_BATCH_HASH_CONTENT) ? 1 : 2;
+    if (aug != NULL && (aug->flags.rot90 | aug->flags.affine | aug->flags.resize) != 0U) {
+        version = 3;
+    }
+    if (aug != NULL && aug->flags.cutout) {
+        version = 4;
+    }
+    if (aug != NULL && (aug->flags.mixup | aug->flags.cutmix) != 0U) {
+        version = 5;
+    }
+    if (config->sampler != NULL) {
+        version = 6;
+    }
+    if (config->strata != NULL) {
+        version = 7;
+    }
+    if (config->epoch_samples != 0) {
+        version = 8;
+    }
+    ct_sha256_update(&ctx, &version, 1);
+    
+    uint8_t buf[8];
+    put_u32_le(buf, config->batch_size);
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, (uint32_t)(config->seed & 0xFFFFFFFFU));
+    put_u32_le(buf + 4, (uint32_t)(config->seed >> 32));
+    ct_sha256_update(&ctx, buf, 8);
+    
+    uint8_t flags = 0;
+    if (aug != NULL) {
+        flags = (uint8_t)(aug->flags.h_flip | (aug->flags.v_flip << 1) |
+                          (aug->flags.random_crop << 2) | (aug->flags.gaussian_noise << 3) |
+                          (aug->flags.rot90 << 4) | (aug->flags.affine << 5) |
+                          (aug->flags.resize << 6) | (aug->flags.cutout << 7));
+    }
+    ct_sha256_update(&ctx, &flags, 1);
+    put_u32_le(buf, (aug != NULL) ? aug->crop_height : 0);
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, (aug != NULL) ? aug->crop_width : 0);
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, 0);  /* brightness_delta: not implemented */
+    ct_sha256_update(&ctx, buf, 4);
+    put_u32_le(buf, (aug != NULL) ? (uint32_t)aug->noise_std : 0);
+    ct_sha256_update(&ctx, buf, 4);
+    
+    /* serialize(stats) */
+    const ct_normalize_ctx_t *norm = config->normalize;
+    uint8_t stats_version = 1;
+    ct_sha256_update(&ctx, &stats_version, 1);
+    uint32_t num_features = (norm != NULL) ? norm->num_features : 0;
+    put_u32_le(buf, num_features);
+    ct_sha256_update(&ctx, buf, 4);
+    for (uint32_t i = 0; i < num_features; i++) {
+        put_u32_le(buf, (uint32_t)norm->means[i]);
+        put_u32_le(buf + 4, (uint32_t)norm->inv_stds[i]);
+        ct_sha256_update(&ctx, buf, 8);
+    }
+    
+    if (version >= 2) {
+        put_u32_le(buf, config->batch_hash_mode);
+        ct_sha256_update(&ctx, buf, 4);
+    }
+    if (aug == NULL) {
+        aug = &no_augment;
+    }
+    if (version >= 3) {
+        const uint32_t geometry[5] = {
+            aug->resize_height, aug->resize_width, (uint32_t)aug->affine_max_angle,
+            (uint32_t)aug->affine_scale_min, (uint32_t)aug->affine_scale_max
+        };
+        for (uint32_t i = 0; i < 5; i++) {
+            put_u32_le(buf, geometry[i]);
+            ct_sha256_update(&ctx, buf, 4);
+        }
+    }
+    if (version >= 4) {
+        const uint32_t erase[5] = {
+            aug->cutout_count, aug->cutout_height, aug->cutout_width,
+            (uint32_t)aug->cutout_value, aug->cutout_noise
+        };
+        for (uint32_t i = 0; i < 5; i++) {
+            put_u32_le(buf, erase[i]);
+            ct_sha256_update(&ctx, buf, 4);
+        }
+    }
+    if (version >= 5) {
+        /* The flags byte is full: batch-level flags get their own word */
+        const uint32_t mix[3] = {
+            aug->flags.mixup | (aug->flags.cutmix << 1),
+            (uint32_t)aug->mix_lambda_min, (uint32_t)aug->mix_lambda_max
+        };
+        for (uint32_t i = 0; i < 3; i++) {
+            put_u32_le(buf, mix[i]);
+            ct_sha256_update(&ctx, buf, 4);
+        }
+    }
+    if (version >= 6) {
+        const ct_alias_table_t *sampler = (config->sampler != NULL) ? config->sampler : &no_sampler;
+        put_u32_le(buf, sampler->num_samples);
+        put_u32_le(buf + 4, sampler->total_weight);
+        ct_sha256_update(&ctx, buf, 8);
+        ct_sha256_update(&ctx, sampler->table_hash, 32);
+    }
+    if (version >= 7) {
+        const ct_strata_t *strata = (config->strata != NULL) ? config->strata : &no_strata;
+        put_u32_le(buf, strata->num_classes);
+        put_u32_le(buf + 4, strata->batch_size);
+        ct_sha256_update(&ctx, buf, 8);
+        ct_sha256_update(&ctx, strata->strata_hash, 32);
+    }
+    if (version >= 8) {
+        put_u32_le(buf, config->epoch_samples);
+        ct_sha256_update(&ctx, buf, 4);
+    }
+    
+    ct_sha256_final(&ctx, out_hash);
+}
+
 /*===========================================================================*/
 /* ct_hash_epoch (CT-MATH-001 §10.5)                                         */
 /*===========================================================================*/
@@ -241,3 +832,26 @@ void ct_provenance_advance(ct_provenance_t *prov, const ct_hash_t epoch_hash)
     prov->current_epoch++;
     prov->total_epochs++;
 }
+
+/*===========================================================================*/
+/* ct_provenance_first_diff (CT-MATH-001 §10.10)                             */
+/*===========================================================================*/
+
+uint32_t ct_provenance_first_diff(const ct_hash_t *heads_a,
+                                  const ct_hash_t *heads_b,
+                                  uint32_t num_heads)
+{
+    /* Each head hashes the one before, so once the chains differ they
+     * differ at every later head: the first difference is a boundary */
+    uint32_t lo = 0;
+    uint32_t hi = num_heads;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2U;
+        if (memcmp(heads_a[mid], heads_b[mid], 32) == 0) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
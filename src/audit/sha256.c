@@ -4,8 +4,9 @@
  * @brief SHA-256 cryptographic hash implementation.
  *
  * @details Standard SHA-256 for Merkle trees and provenance chains.
+ *          Block compression is dispatched: scalar reference or SHA-NI.
  *
- * @traceability SRS-006-MERKLE
+ * @traceability SRS-006-MERKLE, CT-MATH-001 §14.4
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
  *
  * @author William Murray
@@ -15,8 +16,13 @@
  */
 
 #include "sha256.h"
+#include "kernels.h"
 #include <string.h>
 
+#if CT_HAVE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
 /* SHA-256 constants */
 static const uint32_t K[64] = {
     0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
@@ -49,62 +55,127 @@ static const uint32_t K[64] = {
 #define SIG1(x) (ROTR(x, 17) ^ ROTR(x, 19) ^ ((x) >> 10))
 
 /*===========================================================================*/
-/* Transform block                                                            */
+/* Transform blocks (scalar reference)                                        */
 /*===========================================================================*/
 
-static void sha256_transform(ct_sha256_ctx_t *ctx, const uint8_t data[64])
+void ct_sha256_blocks_scalar(uint32_t state[8], const uint8_t *data, size_t nblocks)
 {
     uint32_t m[64];
     uint32_t a, b, c, d, e, f, g, h, t1, t2;
     uint32_t i;
-    
-    /* Prepare message schedule */
-    for (i = 0; i < 16; i++) {
-        m[i] = ((uint32_t)data[i * 4] << 24) |
-               ((uint32_t)data[i * 4 + 1] << 16) |
-               ((uint32_t)data[i * 4 + 2] << 8) |
-               ((uint32_t)data[i * 4 + 3]);
-    }
-    
-    for (i = 16; i < 64; i++) {
-        m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+    for (size_t blk = 0; blk < nblocks; blk++, data += 64) {
+        /* Prepare message schedule */
+        for (i = 0; i < 16; i++) {
+            m[i] = ((uint32_t)data[i * 4] << 24) |
+                   ((uint32_t)data[i * 4 + 1] << 16) |
+                   ((uint32_t)data[i * 4 + 2] << 8) |
+                   ((uint32_t)data[i * 4 + 3]);
+        }
+
+        for (i = 16; i < 64; i++) {
+            m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+        }
+
+        /* Initialize working variables */
+        a = state[0];
+        b = state[1];
+        c = state[2];
+        d = state[3];
+        e = state[4];
+        f = state[5];
+        g = state[6];
+        h = state[7];
+
+        /* Main loop */
+        for (i = 0; i < 64; i++) {
+            t1 = h + EP1(e) + CH(e, f, g) + K[i] + m[i];
+            t2 = EP0(a) + MAJ(a, b, c);
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        /* Add to state */
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
     }
-    
-    /* Initialize working variables */
-    a = ctx->state[0];
-    b = ctx->state[1];
-    c = ctx->state[2];
-    d = ctx->state[3];
-    e = ctx->state[4];
-    f = ctx->state[5];
-    g = ctx->state[6];
-    h = ctx->state[7];
-    
-    /* Main loop */
-    for (i = 0; i < 64; i++) {
-        t1 = h + EP1(e) + CH(e, f, g) + K[i] + m[i];
-        t2 = EP0(a) + MAJ(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + t1;
-        d = c;
-        c = b;
-        b = a;
-        a = t1 + t2;
+}
+
+#if CT_HAVE_X86_KERNELS
+
+/*===========================================================================*/
+/* Transform blocks (SHA-NI)                                                  */
+/*===========================================================================*/
+
+__attribute__((target("sha,sse4.1")))
+void ct_sha256_blocks_shani(uint32_t state[8], const uint8_t *data, size_t nblocks)
+{
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i tmp, msg, msgs[4];
+
+    /* Load state as ABEF / CDGH */
+    tmp = _mm_loadu_si128((const __m128i *)(const void *)&state[0]);
+    __m128i state1 = _mm_loadu_si128((const __m128i *)(const void *)&state[4]);
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (size_t blk = 0; blk < nblocks; blk++, data += 64) {
+        __m128i abef_save = state0;
+        __m128i cdgh_save = state1;
+
+        /* 16 groups of 4 rounds, message schedule in a rotating window */
+        for (uint32_t grp = 0; grp < 16; grp++) {
+            uint32_t cur = grp & 3;
+            if (grp < 4) {
+                msgs[cur] = _mm_shuffle_epi8(
+                    _mm_loadu_si128((const __m128i *)(const void *)&data[grp * 16]), mask);
+            }
+            msg = _mm_add_epi32(msgs[cur],
+                                _mm_loadu_si128((const __m128i *)(const void *)&K[grp * 4]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            if (grp >= 3 && grp < 15) {
+                uint32_t next = (grp + 1) & 3;
+                tmp = _mm_alignr_epi8(msgs[cur], msgs[(grp + 3) & 3], 4);
+                msgs[next] = _mm_add_epi32(msgs[next], tmp);
+                msgs[next] = _mm_sha256msg2_epu32(msgs[next], msgs[cur]);
+            }
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+            if (grp >= 1 && grp < 13) {
+                uint32_t prev = (grp + 3) & 3;
+                msgs[prev] = _mm_sha256msg1_epu32(msgs[prev], msgs[cur]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
     }
-    
-    /* Add to state */
-    ctx->state[0] += a;
-    ctx->state[1] += b;
-    ctx->state[2] += c;
-    ctx->state[3] += d;
-    ctx->state[4] += e;
-    ctx->state[5] += f;
-    ctx->state[6] += g;
-    ctx->state[7] += h;
+
+    /* Store ABEF / CDGH back as ABCD / EFGH */
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i *)(void *)&state[0], state0);
+    _mm_storeu_si128((__m128i *)(void *)&state[4], state1);
 }
 
+#endif /* CT_HAVE_X86_KERNELS */
+
 /*===========================================================================*/
 /* ct_sha256_init                                                             */
 /*===========================================================================*/
@@ -129,15 +200,33 @@ void ct_sha256_init(ct_sha256_ctx_t *ctx)
 
 void ct_sha256_update(ct_sha256_ctx_t *ctx, const uint8_t data[], size_t len)
 {
-    for (size_t i = 0; i < len; i++) {
-        ctx->data[ctx->datalen] = data[i];
-        ctx->datalen++;
-        
-        if (ctx->datalen == 64) {
-            sha256_transform(ctx, ctx->data);
-            ctx->bitlen += 512;
-            ctx->datalen = 0;
+    ct_kernel_sha256_fn blocks = ct_dispatch_get()->sha256_blocks;
+    size_t i = 0;
+
+    /* Top up a partially filled block */
+    if (ctx->datalen > 0) {
+        while (i < len && ctx->datalen < 64) {
+            ctx->data[ctx->datalen++] = data[i++];
+        }
+        if (ctx->datalen < 64) {
+            return;
         }
+        blocks(ctx->state, ctx->data, 1);
+        ctx->bitlen += 512;
+        ctx->datalen = 0;
+    }
+
+    /* Compress whole blocks straight from the input */
+    size_t nblocks = (len - i) / 64;
+    if (nblocks > 0) {
+        blocks(ctx->state, &data[i], nblocks);
+        ctx->bitlen += 512 * (uint64_t)nblocks;
+        i += nblocks * 64;
+    }
+
+    /* Buffer the remainder */
+    while (i < len) {
+        ctx->data[ctx->datalen++] = data[i++];
     }
 }
 
@@ -147,6 +236,7 @@ void ct_sha256_update(ct_sha256_ctx_t *ctx, const uint8_t data[], size_t len)
 
 void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[32])
 {
+    ct_kernel_sha256_fn blocks = ct_dispatch_get()->sha256_blocks;
     uint32_t i = ctx->datalen;
     
     /* Pad with 0x80 byte */
@@ -160,7 +250,7 @@ void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[32])
         while (i < 64) {
             ctx->data[i++] = 0x00;
         }
-        sha256_transform(ctx, ctx->data);
+        blocks(ctx->state, ctx->data, 1);
         memset(ctx->data, 0, 56);
     }
     
@@ -175,7 +265,7 @@ void ct_sha256_final(ct_sha256_ctx_t *ctx, uint8_t hash[32])
     ctx->data[57] = (uint8_t)(ctx->bitlen >> 48);
     ctx->data[56] = (uint8_t)(ctx->bitlen >> 56);
     
-    sha256_transform(ctx, ctx->data);
+    blocks(ctx->state, ctx->data, 1);
     
     /* Extract hash (big-endian) */
     for (i = 0; i < 8; i++) {
@@ -3,9 +3,14 @@
  * @project Certifiable Data Pipeline
  * @brief Deterministic data augmentation.
  *
- * @details Applies deterministic transformations (flip, crop, noise) using PRNG.
+ * @details Applies deterministic transformations (flip, crop, noise,
+ *          cutout, and the geometric warp) using PRNG, and the batch-level
+ *          mixup and cutmix that blend samples pairwise. The per-sample
+ *          flip, crop and geometry decisions are drawn for a run of samples
+ *          at once (ct_augment_plan_batch), one strided PRNG fill per
+ *          decision, and the transforms then execute the plan.
  *
- * @traceability SRS-003-AUGMENT, CT-MATH-001 §6
+ * @traceability SRS-003-AUGMENT, CT-MATH-001 §3.10, §6, §8.7, §8.8, §8.9, §8.10
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
  *
  * @author William Murray
@@ -16,6 +21,7 @@
 
 #include "augment.h"
 #include "prng.h"
+#include "dispatch.h"
 #include "dvm.h"
 #include <string.h>
 
@@ -31,6 +37,51 @@ void ct_augment_init(ct_augment_ctx_t *ctx,
     ctx->seed = seed;
     ctx->epoch = epoch;
     ctx->flags = flags;
+    ctx->noise_plan_std = 0;
+    ctx->resize_width = 0;
+    ctx->resize_height = 0;
+    ctx->affine_max_angle = 0;
+    ctx->affine_scale_min = FIXED_ONE;
+    ctx->affine_scale_max = FIXED_ONE;
+    ctx->cutout_count = 0;
+    ctx->cutout_height = 0;
+    ctx->cutout_width = 0;
+    ctx->cutout_value = 0;
+    ctx->cutout_noise = 0;
+    ctx->mix_lambda_min = 0;
+    ctx->mix_lambda_max = FIXED_ONE;
+}
+
+/*===========================================================================*/
+/* ct_augment_plan (CT-MATH-001 §14.5)                                       */
+/*===========================================================================*/
+
+int ct_augment_plan(ct_augment_ctx_t *ctx, ct_range_t data_range)
+{
+    ctx->noise_plan_std = 0;
+    if (ctx->noise_std <= 0) {
+        return 0;
+    }
+
+    /* u_fixed spans [INT32_MIN, 0x7FFF0000]; with std > 0 the noise term is
+     * monotonic in it, so the extremes bound every noise value. */
+    ct_fault_flags_t scratch = {0};
+    int32_t lo = dvm_sub32(INT32_MIN, FIXED_HALF, &scratch);
+    int32_t hi = dvm_sub32((int32_t)0x7FFF0000, FIXED_HALF, &scratch);
+    lo = dvm_mul_q16(ctx->noise_std, lo, &scratch);
+    hi = dvm_mul_q16(ctx->noise_std, hi, &scratch);
+    lo = dvm_add32(lo, lo, &scratch);
+    hi = dvm_add32(hi, hi, &scratch);
+
+    if (data_range.min <= data_range.max) {
+        if ((int64_t)data_range.min + lo < INT32_MIN ||
+            (int64_t)data_range.max + hi > INT32_MAX) {
+            return 0;
+        }
+    }
+
+    ctx->noise_plan_std = ctx->noise_std;
+    return 1;
 }
 
 /*===========================================================================*/
@@ -56,25 +107,27 @@ static void horizontal_flip(ct_sample_t *sample, uint32_t width, uint32_t height
 /* ct_augment_random_crop (CT-MATH-001 §6.2)                                 */
 /*===========================================================================*/
 
+static void crop_origin(uint32_t max_x,
+                        uint32_t max_y,
+                        const ct_augment_decision_t *d,
+                        uint32_t *crop_x,
+                        uint32_t *crop_y)
+{
+    /* Bound the planned draws by rejection sampling */
+    *crop_x = ct_prng_bound(d->crop_x, max_x + 1);
+    *crop_y = ct_prng_bound(d->crop_y, max_y + 1);
+}
+
 static void random_crop(ct_sample_t *input,
                         ct_sample_t *output,
                         uint32_t src_width,
                         uint32_t src_height,
                         uint32_t crop_width,
                         uint32_t crop_height,
-                        uint64_t seed,
-                        uint32_t epoch,
-                        uint32_t sample_idx)
+                        const ct_augment_decision_t *d)
 {
-    /* Generate random crop position using rejection sampling */
-    uint32_t max_x = src_width - crop_width;
-    uint32_t max_y = src_height - crop_height;
-    
-    uint32_t op_id = (sample_idx << 16) | 0x0001;  /* Crop X */
-    uint32_t crop_x = ct_prng_uniform(seed, epoch, op_id, max_x + 1);
-    
-    op_id = (sample_idx << 16) | 0x0002;  /* Crop Y */
-    uint32_t crop_y = ct_prng_uniform(seed, epoch, op_id, max_y + 1);
+    uint32_t crop_x, crop_y;
+    crop_origin(src_width - crop_width, src_height - crop_height, d, &crop_x, &crop_y);
     
     /* Copy cropped region */
     for (uint32_t y = 0; y < crop_height; y++) {
@@ -95,38 +148,211 @@ static void random_crop(ct_sample_t *input,
 /* ct_augment_gaussian_noise (CT-MATH-001 §6.3)                              */
 /*===========================================================================*/
 
+#define NOISE_CHUNK 256
+
 static void gaussian_noise(ct_sample_t *sample,
                            int32_t noise_std,
                            uint64_t seed,
                            uint32_t epoch,
                            uint32_t sample_idx,
+                           int unchecked,
                            ct_fault_flags_t *faults)
 {
-    /* Add deterministic Gaussian noise using Box-Muller transform */
-    for (uint32_t i = 0; i < sample->total_elements; i += 2) {
-        /* Generate two uniform random numbers */
-        uint32_t op_id_1 = (sample_idx << 16) | (0x1000 + i);
-        uint32_t op_id_2 = (sample_idx << 16) | (0x1000 + i + 1);
-        
-        uint64_t u1 = ct_prng(seed, epoch, op_id_1);
-        uint64_t u2 = ct_prng(seed, epoch, op_id_2);
-        
-        /* Map to [0, 1) in Q16.16 */
-        int32_t u1_fixed = (int32_t)((u1 >> 32) & 0xFFFF0000);
-        int32_t u2_fixed = (int32_t)((u2 >> 32) & 0xFFFF0000);
+    const ct_dispatch_t *k = ct_dispatch_get();
+    ct_kernel_binop_fn accumulate = unchecked ? k->add32_unchecked : k->add32;
+    uint64_t u[NOISE_CHUNK];
+    int32_t noise[NOISE_CHUNK];
+    
+    /* Element i draws op_id (sample_idx << 16) | (0x1000 + i).
+     * Noise is generated in pairs, so for an odd element count the final
+     * unused partner is still computed: its faults are part of the result. */
+    uint32_t total = sample->total_elements;
+    uint32_t padded = total + (total & 1U);
+    
+    for (uint32_t base = 0; base < padded; base += NOISE_CHUNK) {
+        uint32_t len = (padded - base < NOISE_CHUNK) ? padded - base : NOISE_CHUNK;
         
         /* Simplified noise: n = std * (u - 0.5) * 2 */
         /* This gives uniform noise in [-std, +std] as approximation */
-        int32_t noise_1 = dvm_mul_q16(noise_std, dvm_sub32(u1_fixed, FIXED_HALF, faults), faults);
-        noise_1 = dvm_add32(noise_1, noise_1, faults);  /* × 2 */
-        
-        int32_t noise_2 = dvm_mul_q16(noise_std, dvm_sub32(u2_fixed, FIXED_HALF, faults), faults);
-        noise_2 = dvm_add32(noise_2, noise_2, faults);  /* × 2 */
+        k->prng_fill(u, len, seed, epoch, sample_idx << 16, 0x1000U + base);
+        k->noise(u, noise, len, noise_std, faults);
         
         /* Add noise to samples */
-        sample->data[i] = dvm_add32(sample->data[i], noise_1, faults);
-        if (i + 1 < sample->total_elements) {
-            sample->data[i + 1] = dvm_add32(sample->data[i + 1], noise_2, faults);
+        uint32_t apply = (total - base < len) ? total - base : len;
+        accumulate(&sample->data[base], noise, &sample->data[base], apply, faults);
+    }
+}
+
+/*===========================================================================*/
+/* ct_augment_cutout (CT-MATH-001 §8.8)                                      */
+/*===========================================================================*/
+
+/* Constant fill of a rows × cols block; memset when the value is one byte
+ * repeated (0 and −1 among them), otherwise a store loop */
+static void fill_block(int32_t *data, uint32_t stride, uint32_t rows, uint32_t cols,
+                       int32_t value)
+{
+    uint32_t bits = (uint32_t)value;
+    int bytewise = (bits == (bits & 0xFFU) * 0x01010101U);
+    for (uint32_t y = 0; y < rows; y++) {
+        int32_t *row = &data[(size_t)y * stride];
+        if (bytewise) {
+            memset(row, (int)(bits & 0xFFU), (size_t)cols * sizeof(int32_t));
+        } else {
+            for (uint32_t x = 0; x < cols; x++) {
+                row[x] = value;
+            }
+        }
+    }
+}
+
+/* Noise fill of a rows × cols block: element j (row-major over the block)
+ * is amplitude × q, q the top 16 bits of PRNG op_id j from the rectangle's
+ * own seed as a Q1.15 uniform in [−1, 1) */
+static void noise_block(int32_t *data, uint32_t stride, uint32_t rows, uint32_t cols,
+                        int32_t amplitude, uint64_t seed, uint32_t epoch,
+                        uint32_t first, ct_fault_flags_t *faults)
+{
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint64_t u[NOISE_CHUNK];
+    int32_t q[NOISE_CHUNK];
+    int32_t amp[NOISE_CHUNK];
+    for (uint32_t i = 0; i < NOISE_CHUNK; i++) {
+        amp[i] = amplitude;
+    }
+    for (uint32_t y = 0; y < rows; y++) {
+        int32_t *row = &data[(size_t)y * stride];
+        for (uint32_t base = 0; base < cols; base += NOISE_CHUNK) {
+            uint32_t len = (cols - base < NOISE_CHUNK) ? cols - base : NOISE_CHUNK;
+            k->prng_fill(u, len, seed, epoch, 0, first + y * cols + base);
+            for (uint32_t i = 0; i < len; i++) {
+                q[i] = (int32_t)(int16_t)(uint16_t)(u[i] >> 48) * 2;  /* Q1.15 as Q16.16 */
+            }
+            k->mul_q16(amp, q, &row[base], len, faults);
+        }
+    }
+}
+
+static void cutout(ct_sample_t *sample,
+                   const ct_augment_ctx_t *ctx,
+                   uint32_t sample_idx,
+                   ct_fault_flags_t *faults)
+{
+    /* [H], [H, W] or [C, H, W] */
+    uint32_t planes = (sample->ndims == 3) ? sample->dims[0] : 1U;
+    uint32_t height = (sample->ndims == 3) ? sample->dims[1] : sample->dims[0];
+    uint32_t width = (sample->ndims == 3) ? sample->dims[2] :
+                     (sample->ndims == 2) ? sample->dims[1] : 1U;
+    if (ctx->cutout_count > CT_AUGMENT_MAX_CUTOUTS || sample->ndims == 0 ||
+        sample->ndims > 3 || sample->data == NULL ||
+        (uint64_t)sample->total_elements != (uint64_t)planes * height * width) {
+        faults->domain = 1;
+        return;
+    }
+    if (ctx->cutout_count == 0 || ctx->cutout_height == 0 || ctx->cutout_width == 0 ||
+        sample->total_elements == 0) {
+        return;
+    }
+
+    uint32_t max_h = (ctx->cutout_height < height) ? ctx->cutout_height : height;
+    uint32_t max_w = (ctx->cutout_width < width) ? ctx->cutout_width : width;
+    uint32_t op_id = (sample_idx << 16) | 0x0300;  /* Rectangle count */
+    uint32_t count = ct_prng_uniform(ctx->seed, ctx->epoch, op_id, ctx->cutout_count) + 1U;
+
+    for (uint32_t r = 0; r < count; r++) {
+        /* Rectangle r: op_ids 0x0400 + 4r + {height, width, top, left} */
+        uint32_t base_id = (sample_idx << 16) | (0x0400U + 4U * r);
+        uint32_t h = ct_prng_uniform(ctx->seed, ctx->epoch, base_id, max_h) + 1U;
+        uint32_t w = ct_prng_uniform(ctx->seed, ctx->epoch, base_id + 1U, max_w) + 1U;
+        uint32_t top = ct_prng_uniform(ctx->seed, ctx->epoch, base_id + 2U, height - h + 1U);
+        uint32_t left = ct_prng_uniform(ctx->seed, ctx->epoch, base_id + 3U, width - w + 1U);
+
+        uint64_t noise_seed = 0;
+        if (ctx->cutout_noise) {
+            op_id = (sample_idx << 16) | (0x0500U + r);  /* Rectangle noise seed */
+            noise_seed = ct_prng(ctx->seed, ctx->epoch, op_id);
+        }
+        for (uint32_t c = 0; c < planes; c++) {
+            int32_t *origin = &sample->data[((size_t)c * height + top) * width + left];
+            if (ctx->cutout_noise) {
+                noise_block(origin, width, h, w, ctx->cutout_value, noise_seed,
+                            ctx->epoch, c * h * w, faults);
+            } else {
+                fill_block(origin, width, h, w, ctx->cutout_value);
+            }
+        }
+    }
+}
+
+/*===========================================================================*/
+/* ct_augment_plan_batch (CT-MATH-001 §8.10)                                 */
+/*===========================================================================*/
+
+#define PLAN_CHUNK 64U
+
+static int affine_params_valid(const ct_augment_ctx_t *ctx)
+{
+    return ctx->affine_max_angle >= 0 && ctx->affine_max_angle <= CT_AUGMENT_MAX_ANGLE &&
+           ctx->affine_scale_min >= CT_AUGMENT_SCALE_MIN &&
+           ctx->affine_scale_max <= CT_AUGMENT_SCALE_MAX &&
+           ctx->affine_scale_min <= ctx->affine_scale_max;
+}
+
+void ct_augment_plan_batch(const ct_augment_ctx_t *ctx,
+                           uint32_t first_idx,
+                           uint32_t count,
+                           ct_augment_decision_t *plan)
+{
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint64_t u[PLAN_CHUNK];
+
+    for (uint32_t base = 0; base < count; base += PLAN_CHUNK) {
+        uint32_t len = (count - base < PLAN_CHUNK) ? count - base : PLAN_CHUNK;
+        ct_augment_decision_t *d = &plan[base];
+        /* Draw op of sample s is (s << 16) | op: one strided fill per op */
+        uint32_t first_op = (first_idx + base) << 16;
+
+        for (uint32_t i = 0; i < len; i++) {
+            memset(&d[i], 0, sizeof(d[i]));
+            d[i].sample_idx = first_idx + base + i;
+            d[i].scale = FIXED_ONE;
+        }
+
+        if (ctx->flags.h_flip) {
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0100U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].h_flip = (uint8_t)(u[i] & 1U);
+            }
+        }
+        if (ctx->flags.random_crop && ctx->crop_height > 0 && ctx->crop_width > 0) {
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0001U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].crop_x = u[i];
+            }
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0002U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].crop_y = u[i];
+            }
+        }
+        if (ctx->flags.rot90) {
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0200U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].turns = (uint8_t)(u[i] & 3U);
+            }
+        }
+        /* Invalid affine parameters are a domain fault at execution */
+        if (ctx->flags.affine && affine_params_valid(ctx)) {
+            int32_t max = ctx->affine_max_angle;
+            int32_t lo = ctx->affine_scale_min;
+            uint32_t span = (uint32_t)(ctx->affine_scale_max - lo) + 1U;
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0201U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].angle = (int32_t)ct_prng_bound(u[i], 2U * (uint32_t)max + 1U) - max;
+            }
+            k->prng_stride(u, len, ctx->seed, ctx->epoch, first_op | 0x0202U, 1U << 16);
+            for (uint32_t i = 0; i < len; i++) {
+                d[i].scale = lo + (int32_t)ct_prng_bound(u[i], span);
+            }
         }
     }
 }
@@ -135,12 +361,14 @@ static void gaussian_noise(ct_sample_t *sample,
 /* ct_augment_sample (CT-MATH-001 §6)                                        */
 /*===========================================================================*/
 
-void ct_augment_sample(const ct_augment_ctx_t *ctx,
-                       const ct_sample_t *input,
-                       ct_sample_t *output,
-                       uint32_t sample_idx,
-                       ct_fault_flags_t *faults)
+void ct_augment_sample_planned(const ct_augment_ctx_t *ctx,
+                               const ct_augment_decision_t *decision,
+                               const ct_sample_t *input,
+                               ct_sample_t *output,
+                               ct_fault_flags_t *faults)
 {
+    uint32_t sample_idx = decision->sample_idx;
+
     /* Copy input to output first */
     memcpy(output, input, sizeof(ct_sample_t));
     
@@ -148,13 +376,9 @@ void ct_augment_sample(const ct_augment_ctx_t *ctx,
     uint32_t height = input->dims[0];
     uint32_t width = (input->ndims > 1) ? input->dims[1] : 1;
     
-    /* Apply horizontal flip? */
-    if (ctx->flags.h_flip) {
-        uint32_t op_id = (sample_idx << 16) | 0x0100;  /* Flip decision */
-        uint64_t rand = ct_prng(ctx->seed, ctx->epoch, op_id);
-        if ((rand & 0x1) == 1) {  /* 50% probability */
-            horizontal_flip(output, width, height);
-        }
+    /* Apply horizontal flip? (50% probability) */
+    if (ctx->flags.h_flip && decision->h_flip) {
+        horizontal_flip(output, width, height);
     }
     
     /* Apply random crop? */
@@ -162,16 +386,33 @@ void ct_augment_sample(const ct_augment_ctx_t *ctx,
         ct_sample_t temp;
         memcpy(&temp, output, sizeof(ct_sample_t));
         random_crop(&temp, output, width, height,
-                    ctx->crop_width, ctx->crop_height,
-                    ctx->seed, ctx->epoch, sample_idx);
+                    ctx->crop_width, ctx->crop_height, decision);
     }
     
     /* Apply Gaussian noise? */
     if (ctx->flags.gaussian_noise && ctx->noise_std > 0) {
-        gaussian_noise(output, ctx->noise_std, ctx->seed, ctx->epoch, sample_idx, faults);
+        int unchecked = (ctx->noise_plan_std != 0 && ctx->noise_plan_std == ctx->noise_std);
+        gaussian_noise(output, ctx->noise_std, ctx->seed, ctx->epoch, sample_idx,
+                       unchecked, faults);
+    }
+    
+    /* Apply cutout? */
+    if (ctx->flags.cutout) {
+        cutout(output, ctx, sample_idx, faults);
     }
 }
 
+void ct_augment_sample(const ct_augment_ctx_t *ctx,
+                       const ct_sample_t *input,
+                       ct_sample_t *output,
+                       uint32_t sample_idx,
+                       ct_fault_flags_t *faults)
+{
+    ct_augment_decision_t d;
+    ct_augment_plan_batch(ctx, sample_idx, 1, &d);
+    ct_augment_sample_planned(ctx, &d, input, output, faults);
+}
+
 /*===========================================================================*/
 /* ct_augment_batch                                                           */
 /*===========================================================================*/
@@ -181,12 +422,486 @@ void ct_augment_batch(const ct_augment_ctx_t *ctx,
                       ct_batch_t *output,
                       ct_fault_flags_t *faults)
 {
-    for (uint32_t i = 0; i < input->batch_size; i++) {
-        uint32_t global_idx = input->batch_index * input->batch_size + i;
-        ct_augment_sample(ctx, &input->samples[i], &output->samples[i], global_idx, faults);
+    ct_augment_decision_t plan[PLAN_CHUNK];
+    uint32_t first_idx = input->batch_index * input->batch_size;
+
+    /* Decide a chunk of samples at once, then execute the plan */
+    for (uint32_t base = 0; base < input->batch_size; base += PLAN_CHUNK) {
+        uint32_t len = input->batch_size - base;
+        if (len > PLAN_CHUNK) {
+            len = PLAN_CHUNK;
+        }
+        ct_augment_plan_batch(ctx, first_idx + base, len, plan);
+        for (uint32_t i = 0; i < len; i++) {
+            ct_augment_sample_planned(ctx, &plan[i], &input->samples[base + i],
+                                      &output->samples[base + i], faults);
+        }
     }
     
     output->batch_size = input->batch_size;
     output->batch_index = input->batch_index;
     memcpy(output->batch_hash, input->batch_hash, 32);
 }
+
+/*===========================================================================*/
+/* ct_augment_geometry (CT-MATH-001 §8.7)                                    */
+/*===========================================================================*/
+
+/* Largest |source coordinate| at any output pixel, Q16.16 */
+#define GEOMETRY_COORD_LIMIT  (1LL << 30)
+
+typedef struct {
+    int32_t m00, m01;              /* Source step per output x / y (Q16.16) */
+    int32_t m10, m11;
+    int64_t ox, oy;                /* Source coordinate of output pixel (0, 0) */
+    uint32_t out_w, out_h;
+    uint32_t border;               /* CT_WARP_* */
+} geometry_t;
+
+/* num / den rounded to nearest, ties to even; den > 0 */
+static int64_t div_rne(int64_t num, int64_t den)
+{
+    int64_t q = num / den;
+    int64_t r = num % den;
+    int64_t twice = (r < 0) ? -2 * r : 2 * r;
+    if (twice > den || (twice == den && (q & 1) != 0)) {
+        q += (num < 0) ? -1 : 1;
+    }
+    return q;
+}
+
+/* sin and cos of |θ| ≤ π/4 (Q16.16) by Horner's rule on the Taylor series
+ * to θ^7 and θ^6; truncation error is below 2^-16 on that interval */
+static void fixed_sincos(int32_t theta, int32_t *sin_out, int32_t *cos_out)
+{
+    ct_fault_flags_t none = {0};
+    int32_t t2 = dvm_mul_q16(theta, theta, &none);
+
+    int32_t s = FIXED_ONE - dvm_mul_q16(t2, 1560, &none);             /* 1/42 */
+    s = FIXED_ONE - dvm_mul_q16(dvm_mul_q16(t2, 3277, &none), s, &none);  /* 1/20 */
+    s = FIXED_ONE - dvm_mul_q16(dvm_mul_q16(t2, 10923, &none), s, &none); /* 1/6 */
+    *sin_out = dvm_mul_q16(theta, s, &none);
+
+    int32_t c = FIXED_ONE - dvm_mul_q16(t2, 2185, &none);             /* 1/30 */
+    c = FIXED_ONE - dvm_mul_q16(dvm_mul_q16(t2, 5461, &none), c, &none);  /* 1/12 */
+    *cos_out = FIXED_ONE - dvm_mul_q16(dvm_mul_q16(t2, FIXED_HALF, &none), c, &none);
+}
+
+/* m = RNE16(a × step); 0 if it leaves the coordinate range */
+static int scaled_entry(int64_t a, int64_t step, int32_t *m)
+{
+    int64_t v = div_rne(a * step, FIXED_ONE);
+    if (v > GEOMETRY_COORD_LIMIT || v < -GEOMETRY_COORD_LIMIT) {
+        return 0;
+    }
+    *m = (int32_t)v;
+    return 1;
+}
+
+static int coord_in_range(int64_t origin, int64_t step_x, int64_t step_y,
+                          uint32_t out_w, uint32_t out_h)
+{
+    /* Linear in (x, y), so the corners bound every pixel */
+    for (uint32_t corner = 0; corner < 4; corner++) {
+        int64_t v = origin + ((corner & 1U) ? (int64_t)(out_w - 1U) * step_x : 0) +
+                    ((corner & 2U) ? (int64_t)(out_h - 1U) * step_y : 0);
+        if (v > GEOMETRY_COORD_LIMIT || v < -GEOMETRY_COORD_LIMIT) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Build the sample's output → source map from its planned transform */
+static int plan_geometry(const ct_augment_ctx_t *ctx,
+                         const ct_augment_decision_t *d,
+                         uint32_t in_w,
+                         uint32_t in_h,
+                         geometry_t *g)
+{
+    uint32_t turns = ctx->flags.rot90 ? (uint32_t)d->turns : 0U;
+    uint32_t turned_w = (turns & 1U) ? in_h : in_w;
+    uint32_t turned_h = (turns & 1U) ? in_w : in_h;
+
+    g->out_w = turned_w;
+    g->out_h = turned_h;
+    if (ctx->flags.resize) {
+        if (ctx->resize_width == 0 || ctx->resize_width > CT_AUGMENT_MAX_EXTENT ||
+            ctx->resize_height == 0 || ctx->resize_height > CT_AUGMENT_MAX_EXTENT) {
+            return 0;
+        }
+        g->out_w = ctx->resize_width;
+        g->out_h = ctx->resize_height;
+    }
+
+    int32_t theta = 0;
+    int32_t scale = FIXED_ONE;
+    if (ctx->flags.affine) {
+        if (!affine_params_valid(ctx)) {
+            return 0;
+        }
+        theta = d->angle;
+        scale = d->scale;
+    }
+
+    /* (a, b) = (cos, sin)(θ + turns·90°) / s: the inverse map rotates and
+     * shrinks where the output rotates and zooms */
+    int32_t sin_t, cos_t;
+    fixed_sincos(theta, &sin_t, &cos_t);
+    int64_t a = div_rne((int64_t)cos_t * FIXED_ONE, scale);
+    int64_t b = div_rne((int64_t)sin_t * FIXED_ONE, scale);
+    for (uint32_t k = 0; k < turns; k++) {
+        int64_t t = a;
+        a = -b;
+        b = t;
+    }
+
+    /* Source pixels per output pixel along the turned axes */
+    int64_t step_x = div_rne((int64_t)turned_w * FIXED_ONE, g->out_w);
+    int64_t step_y = div_rne((int64_t)turned_h * FIXED_ONE, g->out_h);
+    if (!scaled_entry(a, step_x, &g->m00) || !scaled_entry(-b, step_y, &g->m01) ||
+        !scaled_entry(b, step_x, &g->m10) || !scaled_entry(a, step_y, &g->m11)) {
+        return 0;
+    }
+
+    /* Output centre maps to input centre */
+    g->ox = (int64_t)(in_w - 1U) * FIXED_HALF -
+            div_rne((int64_t)(g->out_w - 1U) * g->m00 + (int64_t)(g->out_h - 1U) * g->m01, 2);
+    g->oy = (int64_t)(in_h - 1U) * FIXED_HALF -
+            div_rne((int64_t)(g->out_w - 1U) * g->m10 + (int64_t)(g->out_h - 1U) * g->m11, 2);
+    if (!coord_in_range(g->ox, g->m00, g->m01, g->out_w, g->out_h) ||
+        !coord_in_range(g->oy, g->m10, g->m11, g->out_w, g->out_h)) {
+        return 0;
+    }
+
+    /* Rotation leaves corners outside the source: fill them with zero. Turns
+     * and resizing only reach half a pixel out, where the edge is replicated */
+    g->border = ctx->flags.affine ? CT_WARP_ZERO : CT_WARP_REPLICATE;
+    return 1;
+}
+
+void ct_augment_geometry_planned(const ct_augment_ctx_t *ctx,
+                                 const ct_augment_decision_t *decision,
+                                 const ct_sample_t *input,
+                                 ct_sample_t *output,
+                                 ct_fault_flags_t *faults)
+{
+    /* [H, W] or [C, H, W] */
+    uint32_t planes = (input->ndims == 3) ? input->dims[0] : 1U;
+    uint32_t in_h = (input->ndims == 3) ? input->dims[1] : input->dims[0];
+    uint32_t in_w = (input->ndims == 3) ? input->dims[2] : input->dims[1];
+
+    geometry_t g;
+    if (input->dtype != CT_DTYPE_Q16_16 || (input->ndims != 2 && input->ndims != 3) ||
+        input->data == NULL || output->data == NULL ||
+        in_w == 0 || in_w > CT_AUGMENT_MAX_EXTENT ||
+        in_h == 0 || in_h > CT_AUGMENT_MAX_EXTENT ||
+        (uint64_t)input->total_elements != (uint64_t)planes * in_h * in_w ||
+        !plan_geometry(ctx, decision, in_w, in_h, &g) ||
+        (uint64_t)planes * g.out_h * g.out_w > CT_MAX_SAMPLE_SIZE) {
+        faults->domain = 1;
+        return;
+    }
+
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint32_t in_plane = in_h * in_w;
+    uint32_t out_plane = g.out_h * g.out_w;
+    for (uint32_t c = 0; c < planes; c++) {
+        const int32_t *src = &input->data[(size_t)c * in_plane];
+        int32_t *dst = &output->data[(size_t)c * out_plane];
+        for (uint32_t y = 0; y < g.out_h; y++) {
+            k->warp_row(src, in_w, in_h, g.border,
+                        (int32_t)(g.ox + (int64_t)y * g.m01),
+                        (int32_t)(g.oy + (int64_t)y * g.m11),
+                        g.m00, g.m10, &dst[(size_t)y * g.out_w], g.out_w);
+        }
+    }
+
+    int32_t *data = output->data;
+    memcpy(output, input, sizeof(ct_sample_t));
+    output->data = data;
+    output->dims[output->ndims - 2U] = g.out_h;
+    output->dims[output->ndims - 1U] = g.out_w;
+    output->total_elements = planes * out_plane;
+}
+
+void ct_augment_geometry(const ct_augment_ctx_t *ctx,
+                         const ct_sample_t *input,
+                         ct_sample_t *output,
+                         uint32_t sample_idx,
+                         ct_fault_flags_t *faults)
+{
+    ct_augment_decision_t d;
+    ct_augment_plan_batch(ctx, sample_idx, 1, &d);
+    ct_augment_geometry_planned(ctx, &d, input, output, faults);
+}
+
+/*===========================================================================*/
+/* ct_augment_mix_batch (CT-MATH-001 §8.9)                                   */
+/*===========================================================================*/
+
+static int same_sample_shape(const ct_sample_t *a, const ct_sample_t *b)
+{
+    if (a->dtype != b->dtype || a->ndims != b->ndims ||
+        a->total_elements != b->total_elements || b->data == NULL) {
+        return 0;
+    }
+    for (uint32_t d = 0; d < a->ndims; d++) {
+        if (a->dims[d] != b->dims[d]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* ⌊√v⌋, bit by bit */
+static uint32_t isqrt64(uint64_t v)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > v) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)root;
+}
+
+/* Paste a rectangle of the partner, at the same place in every plane, over
+ * a copy of the sample; returns the share of pixels left as they were */
+static int32_t cutmix(const ct_augment_ctx_t *ctx,
+                      const ct_sample_t *self,
+                      const ct_sample_t *partner,
+                      int32_t lambda,
+                      uint32_t sample_idx,
+                      int32_t *dst)
+{
+    uint32_t planes = (self->ndims == 3) ? self->dims[0] : 1U;
+    uint32_t height = (self->ndims == 3) ? self->dims[1] : self->dims[0];
+    uint32_t width = (self->ndims == 3) ? self->dims[2] :
+                     (self->ndims == 2) ? self->dims[1] : 1U;
+
+    memcpy(dst, self->data, (size_t)self->total_elements * sizeof(int32_t));
+
+    /* Sides scale by √(1 − λ), so the rectangle covers about 1 − λ */
+    ct_fault_flags_t none = {0};
+    uint32_t side = isqrt64((uint64_t)(uint32_t)(FIXED_ONE - lambda) << 16);
+    uint32_t h = (uint32_t)dvm_round_shift_rne((int64_t)height * side, 16, &none);
+    uint32_t w = (uint32_t)dvm_round_shift_rne((int64_t)width * side, 16, &none);
+    if (h == 0 || w == 0) {
+        return FIXED_ONE;
+    }
+
+    uint32_t op_id = (sample_idx << 16) | 0x0603;  /* Rectangle top */
+    uint32_t top = ct_prng_uniform(ctx->seed, ctx->epoch, op_id, height - h + 1U);
+    op_id = (sample_idx << 16) | 0x0604;           /* Rectangle left */
+    uint32_t left = ct_prng_uniform(ctx->seed, ctx->epoch, op_id, width - w + 1U);
+
+    for (uint32_t c = 0; c < planes; c++) {
+        for (uint32_t y = 0; y < h; y++) {
+            size_t at = ((size_t)c * height + top + y) * width + left;
+            memcpy(&dst[at], &partner->data[at], (size_t)w * sizeof(int32_t));
+        }
+    }
+
+    int64_t area = (int64_t)height * width;
+    return (int32_t)div_rne((area - (int64_t)h * w) * FIXED_ONE, area);
+}
+
+int ct_augment_mix_batch(const ct_augment_ctx_t *ctx,
+                         const ct_batch_t *input,
+                         ct_batch_t *output,
+                         int32_t *buf,
+                         uint32_t capacity,
+                         ct_mix_label_t *labels)
+{
+    /* Filled samples lead; ct_batch_fill pads only at the end */
+    uint32_t count = 0;
+    while (count < input->batch_size && input->samples[count].total_elements != 0) {
+        count++;
+    }
+
+    const ct_sample_t *first = &input->samples[0];
+    uint32_t total = (count > 0) ? first->total_elements : 0U;
+    if (ctx->mix_lambda_min < 0 || ctx->mix_lambda_min > ctx->mix_lambda_max ||
+        ctx->mix_lambda_max > FIXED_ONE || (uint64_t)count * total > capacity ||
+        (count > 0 && first->dtype != CT_DTYPE_Q16_16)) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!same_sample_shape(first, &input->samples[i])) {
+            return -1;
+        }
+    }
+    if (ctx->flags.cutmix && count > 0) {
+        uint64_t planes = (first->ndims == 3) ? first->dims[0] : 1U;
+        uint64_t height = (first->ndims == 3) ? first->dims[1] : first->dims[0];
+        uint64_t width = (first->ndims == 3) ? first->dims[2] :
+                         (first->ndims == 2) ? first->dims[1] : 1U;
+        if (first->ndims == 0 || first->ndims > 3 || total != planes * height * width) {
+            return -1;
+        }
+    }
+
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint32_t span = (uint32_t)(ctx->mix_lambda_max - ctx->mix_lambda_min) + 1U;
+
+    for (uint32_t i = 0; i < input->batch_size; i++) {
+        const ct_sample_t *s = &input->samples[i];
+        ct_sample_t *o = &output->samples[i];
+        memcpy(o, s, sizeof(ct_sample_t));
+        memcpy(output->sample_hashes[i], input->sample_hashes[i], 32);
+        labels[i].partner = i;
+        labels[i].weight = FIXED_ONE;
+        if (i >= count) {
+            continue;
+        }
+
+        int32_t *dst = &buf[(size_t)i * total];
+        o->data = dst;
+
+        if (count < 2 || (!ctx->flags.mixup && !ctx->flags.cutmix)) {
+            memcpy(dst, s->data, (size_t)total * sizeof(int32_t));
+            continue;
+        }
+
+        uint32_t sample_idx = input->batch_index * input->batch_size + i;
+        uint32_t op_id = (sample_idx << 16) | 0x0600;  /* Mixup or cutmix */
+        int use_cutmix = (int)ctx->flags.cutmix;
+        if (ctx->flags.mixup && ctx->flags.cutmix) {
+            use_cutmix = (int)(ct_prng(ctx->seed, ctx->epoch, op_id) & 1U);
+        }
+
+        /* Partner among the other filled slots, then the own weight */
+        op_id = (sample_idx << 16) | 0x0601;
+        uint32_t j = (i + 1U + ct_prng_uniform(ctx->seed, ctx->epoch, op_id, count - 1U)) % count;
+        op_id = (sample_idx << 16) | 0x0602;
+        int32_t lambda = ctx->mix_lambda_min +
+                         (int32_t)ct_prng_uniform(ctx->seed, ctx->epoch, op_id, span);
+
+        labels[i].partner = j;
+        if (use_cutmix) {
+            labels[i].weight = cutmix(ctx, s, &input->samples[j], lambda, sample_idx, dst);
+        } else {
+            k->lerp_q16(s->data, input->samples[j].data, FIXED_ONE - lambda, dst, total);
+            labels[i].weight = lambda;
+        }
+    }
+
+    output->batch_size = input->batch_size;
+    output->batch_index = input->batch_index;
+    memcpy(output->batch_hash, input->batch_hash, 32);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_augment_sample16 (CT-MATH-001 §3.10)                                   */
+/*===========================================================================*/
+
+static void horizontal_flip16(ct_sample16_t *sample, uint32_t width, uint32_t height)
+{
+    for (uint32_t row = 0; row < height; row++) {
+        for (uint32_t col = 0; col < width / 2; col++) {
+            uint32_t left_idx = row * width + col;
+            uint32_t right_idx = row * width + (width - 1 - col);
+            
+            int16_t temp = sample->data[left_idx];
+            sample->data[left_idx] = sample->data[right_idx];
+            sample->data[right_idx] = temp;
+        }
+    }
+}
+
+static void random_crop16(const ct_sample16_t *input,
+                          ct_sample16_t *output,
+                          uint32_t src_width,
+                          uint32_t src_height,
+                          uint32_t crop_width,
+                          uint32_t crop_height,
+                          const ct_augment_decision_t *d)
+{
+    uint32_t crop_x, crop_y;
+    crop_origin(src_width - crop_width, src_height - crop_height, d, &crop_x, &crop_y);
+    
+    for (uint32_t y = 0; y < crop_height; y++) {
+        for (uint32_t x = 0; x < crop_width; x++) {
+            uint32_t src_idx = (crop_y + y) * src_width + (crop_x + x);
+            uint32_t dst_idx = y * crop_width + x;
+            output->data[dst_idx] = input->data[src_idx];
+        }
+    }
+    
+    output->dims[0] = crop_height;
+    output->dims[1] = crop_width;
+    output->total_elements = crop_width * crop_height;
+}
+
+static void uniform_noise16(ct_sample16_t *sample,
+                            int16_t noise_std,
+                            uint64_t seed,
+                            uint32_t epoch,
+                            uint32_t sample_idx,
+                            ct_fault_flags_t *faults)
+{
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint64_t u[NOISE_CHUNK];
+    int16_t noise[NOISE_CHUNK];
+    
+    /* Element i draws op_id (sample_idx << 16) | (0x1000 + i); the narrow
+     * map is per element, so no pair padding is needed. */
+    uint32_t total = sample->total_elements;
+    
+    for (uint32_t base = 0; base < total; base += NOISE_CHUNK) {
+        uint32_t len = (total - base < NOISE_CHUNK) ? total - base : NOISE_CHUNK;
+        
+        /* n = std * r, r = top 16 bits of u as Q1.15 in [-1, 1) */
+        k->prng_fill(u, len, seed, epoch, sample_idx << 16, 0x1000U + base);
+        k->noise16(u, noise, len, noise_std, faults);
+        k->add16(&sample->data[base], noise, &sample->data[base], len, faults);
+    }
+}
+
+void ct_augment_sample16(const ct_augment_ctx_t *ctx,
+                         const ct_sample16_t *input,
+                         ct_sample16_t *output,
+                         uint32_t sample_idx,
+                         ct_fault_flags_t *faults)
+{
+    uint32_t frac_bits = ct_dtype_frac_bits(input->dtype);
+    if (frac_bits == 0 || frac_bits > 15) {
+        faults->domain = 1;
+        return;
+    }
+
+    /* Copy input to output first */
+    memcpy(output, input, sizeof(ct_sample16_t));
+    
+    uint32_t height = input->dims[0];
+    uint32_t width = (input->ndims > 1) ? input->dims[1] : 1;
+    
+    /* Same plan as the Q16.16 path for the same sample_idx */
+    ct_augment_decision_t d;
+    ct_augment_plan_batch(ctx, sample_idx, 1, &d);
+    if (ctx->flags.h_flip && d.h_flip) {
+        horizontal_flip16(output, width, height);
+    }
+    
+    if (ctx->flags.random_crop && ctx->crop_height > 0 && ctx->crop_width > 0) {
+        ct_sample16_t temp;
+        memcpy(&temp, output, sizeof(ct_sample16_t));
+        random_crop16(&temp, output, width, height,
+                      ctx->crop_width, ctx->crop_height, &d);
+    }
+    
+    if (ctx->flags.gaussian_noise && ctx->noise_std > 0) {
+        int16_t std16 = dvm_narrow16(ctx->noise_std, frac_bits, faults);
+        uniform_noise16(output, std16, ctx->seed, ctx->epoch, sample_idx, faults);
+    }
+}
@@ -6,7 +6,7 @@
  * @details Constructs batches from shuffled dataset with cryptographic
  *          commitment to batch contents.
  *
- * @traceability SRS-005-BATCH, CT-MATH-001 §9
+ * @traceability SRS-005-BATCH, CT-MATH-001 §7.6–§7.10, §9, CT-STRUCT-001 §10.1
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
  *
  * @author William Murray
@@ -17,9 +17,13 @@
 
 #include "batch.h"
 #include "shuffle.h"
+#include "exclusion.h"
+#include "mixture.h"
 #include "merkle.h"
 #include <string.h>
 
+#define BATCH_PERMUTE_CHUNK 64
+
 /*===========================================================================*/
 /* ct_batch_init                                                              */
 /*===========================================================================*/
@@ -36,15 +40,46 @@ void ct_batch_init(ct_batch_t *batch,
     memset(batch->batch_hash, 0, 32);
 }
 
+/*===========================================================================*/
+/* Epoch ordering                                                             */
+/*===========================================================================*/
+
+/* Dataset indices for epoch positions [start, start + len): the permutation,
+ * draws from the sampler, or the permutation of the survivors of an
+ * exclusion mapped back to original indices */
+static void select_range(const ct_alias_table_t *sampler,
+                         const ct_exclusion_t *exclusion,
+                         uint32_t start,
+                         uint32_t len,
+                         uint32_t num_samples,
+                         uint64_t seed,
+                         uint32_t epoch,
+                         uint32_t *out)
+{
+    if (sampler != NULL) {
+        ct_alias_draw_range(sampler, seed, epoch, start, len, out);
+    } else if (exclusion != NULL) {
+        ct_permute_range(start, len, exclusion->num_kept, seed, epoch, out);
+        for (uint32_t j = 0; j < len; j++) {
+            out[j] = ct_exclusion_select(exclusion, out[j]);
+        }
+    } else {
+        ct_permute_range(start, len, num_samples, seed, epoch, out);
+    }
+}
+
 /*===========================================================================*/
 /* ct_batch_fill (CT-MATH-001 §9.1)                                          */
 /*===========================================================================*/
 
-void ct_batch_fill(ct_batch_t *batch,
-                   const ct_dataset_t *dataset,
-                   uint32_t batch_index,
-                   uint32_t epoch,
-                   uint64_t seed)
+static void fill_samples(ct_batch_t *batch,
+                         const ct_dataset_t *dataset,
+                         const ct_alias_table_t *sampler,
+                         const ct_exclusion_t *exclusion,
+                         uint32_t epoch_samples,
+                         uint32_t batch_index,
+                         uint32_t epoch,
+                         uint64_t seed)
 {
     batch->batch_index = batch_index;
     
@@ -52,23 +87,28 @@ void ct_batch_fill(ct_batch_t *batch,
     uint32_t samples_in_batch = batch->batch_size;
     
     /* Last batch may be partial */
-    if (start_idx + samples_in_batch > dataset->num_samples) {
-        samples_in_batch = dataset->num_samples - start_idx;
+    if (start_idx + samples_in_batch > epoch_samples) {
+        samples_in_batch = epoch_samples - start_idx;
     }
     
     /* Fill batch with shuffled samples */
-    for (uint32_t i = 0; i < samples_in_batch; i++) {
-        uint32_t global_idx = start_idx + i;
-        uint32_t shuffled_idx = ct_permute_index(global_idx,
-                                                  dataset->num_samples,
-                                                  seed,
-                                                  epoch);
-        
-        /* Copy sample (shallow copy - data pointer remains) */
-        batch->samples[i] = dataset->samples[shuffled_idx];
+    uint32_t shuffled[BATCH_PERMUTE_CHUNK];
+    for (uint32_t base = 0; base < samples_in_batch; base += BATCH_PERMUTE_CHUNK) {
+        uint32_t len = samples_in_batch - base;
+        if (len > BATCH_PERMUTE_CHUNK) {
+            len = BATCH_PERMUTE_CHUNK;
+        }
+        select_range(sampler, exclusion, start_idx + base, len, dataset->num_samples, seed, epoch, shuffled);
         
-        /* Compute and store sample hash */
-        ct_hash_sample(&batch->samples[i], batch->sample_hashes[i]);
+        for (uint32_t j = 0; j < len; j++) {
+            uint32_t i = base + j;
+            
+            /* Copy sample (shallow copy - data pointer remains) */
+            batch->samples[i] = dataset->samples[shuffled[j]];
+            
+            /* Compute and store sample hash */
+            ct_hash_sample(&batch->samples[i], batch->sample_hashes[i]);
+        }
     }
     
     /* Pad remaining slots with zeros if partial batch */
@@ -81,6 +121,152 @@ void ct_batch_fill(ct_batch_t *batch,
     ct_hash_batch(batch, batch->batch_hash);
 }
 
+void ct_batch_fill(ct_batch_t *batch,
+                   const ct_dataset_t *dataset,
+                   uint32_t batch_index,
+                   uint32_t epoch,
+                   uint64_t seed)
+{
+    fill_samples(batch, dataset, NULL, NULL, dataset->num_samples, batch_index, epoch, seed);
+}
+
+int ct_batch_fill_subset(ct_batch_t *batch,
+                         const ct_dataset_t *dataset,
+                         uint32_t epoch_samples,
+                         uint32_t batch_index,
+                         uint32_t epoch,
+                         uint64_t seed)
+{
+    if (epoch_samples == 0 || epoch_samples > dataset->num_samples) {
+        return -1;
+    }
+    fill_samples(batch, dataset, NULL, NULL, epoch_samples, batch_index, epoch, seed);
+    return 0;
+}
+
+int ct_batch_fill_excluding(ct_batch_t *batch,
+                            const ct_dataset_t *dataset,
+                            const ct_exclusion_t *exclusion,
+                            uint32_t batch_index,
+                            uint32_t epoch,
+                            uint64_t seed)
+{
+    if (exclusion->num_samples != dataset->num_samples || exclusion->num_kept == 0) {
+        return -1;
+    }
+    fill_samples(batch, dataset, NULL, exclusion, exclusion->num_kept, batch_index, epoch, seed);
+    return 0;
+}
+
+int ct_batch_fill_weighted(ct_batch_t *batch,
+                           const ct_dataset_t *dataset,
+                           const ct_alias_table_t *sampler,
+                           uint32_t batch_index,
+                           uint32_t epoch,
+                           uint64_t seed)
+{
+    if (sampler->num_samples != dataset->num_samples) {
+        return -1;
+    }
+    fill_samples(batch, dataset, sampler, NULL, dataset->num_samples, batch_index, epoch, seed);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_batch_fill_stratified (CT-MATH-001 §7.7)                               */
+/*===========================================================================*/
+
+int ct_batch_fill_stratified(ct_batch_t *batch,
+                             const ct_dataset_t *dataset,
+                             const ct_strata_t *strata,
+                             uint32_t batch_index,
+                             uint32_t epoch,
+                             uint64_t seed)
+{
+    if (strata->batch_size != batch->batch_size ||
+        strata->num_samples != dataset->num_samples) {
+        return -1;
+    }
+    batch->batch_index = batch_index;
+    
+    /* Each class fills its own slots; every batch is full */
+    uint32_t idx[BATCH_PERMUTE_CHUNK];
+    uint32_t grouped = 0;
+    for (uint32_t c = 0; c < strata->num_classes; c++) {
+        uint32_t quota = strata->quota[c];
+        for (uint32_t base = 0; base < quota; base += BATCH_PERMUTE_CHUNK) {
+            uint32_t len = quota - base;
+            if (len > BATCH_PERMUTE_CHUNK) {
+                len = BATCH_PERMUTE_CHUNK;
+            }
+            ct_strata_class_range(strata, seed, epoch, c,
+                                  (uint64_t)batch_index * quota + base, len, idx);
+            
+            for (uint32_t j = 0; j < len; j++) {
+                uint32_t i = strata->slots[grouped + base + j];
+                batch->samples[i] = dataset->samples[idx[j]];
+                ct_hash_sample(&batch->samples[i], batch->sample_hashes[i]);
+            }
+        }
+        grouped += quota;
+    }
+    
+    ct_hash_batch(batch, batch->batch_hash);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_batch_fill_mixture (CT-MATH-001 §7.10)                                 */
+/*===========================================================================*/
+
+int ct_batch_fill_mixture(ct_batch_t *batch,
+                          const ct_mixture_t *mixture,
+                          uint32_t batch_index,
+                          uint32_t epoch,
+                          uint64_t seed)
+{
+    uint64_t start = (uint64_t)batch_index * batch->batch_size;
+    if (start >= mixture->epoch_samples) {
+        return -1;
+    }
+    batch->batch_index = batch_index;
+    
+    /* Last batch may be partial */
+    uint32_t start_idx = (uint32_t)start;
+    uint32_t samples_in_batch = mixture->epoch_samples - start_idx;
+    if (samples_in_batch > batch->batch_size) {
+        samples_in_batch = batch->batch_size;
+    }
+    
+    uint32_t source[BATCH_PERMUTE_CHUNK];
+    uint32_t idx[BATCH_PERMUTE_CHUNK];
+    for (uint32_t base = 0; base < samples_in_batch; base += BATCH_PERMUTE_CHUNK) {
+        uint32_t len = samples_in_batch - base;
+        if (len > BATCH_PERMUTE_CHUNK) {
+            len = BATCH_PERMUTE_CHUNK;
+        }
+        ct_mixture_range(mixture, seed, epoch, start_idx + base, len, source, idx);
+        
+        for (uint32_t j = 0; j < len; j++) {
+            uint32_t i = base + j;
+            batch->samples[i] = mixture->datasets[source[j]].samples[idx[j]];
+            
+            /* Leaf binds the sample to its source */
+            ct_hash_t sample_hash;
+            ct_hash_sample(&batch->samples[i], sample_hash);
+            ct_hash_mixture_leaf(source[j], sample_hash, batch->sample_hashes[i]);
+        }
+    }
+    
+    for (uint32_t i = samples_in_batch; i < batch->batch_size; i++) {
+        memset(&batch->samples[i], 0, sizeof(ct_sample_t));
+        memset(batch->sample_hashes[i], 0, 32);
+    }
+    
+    ct_hash_batch(batch, batch->batch_hash);
+    return 0;
+}
+
 /*===========================================================================*/
 /* ct_batch_get_sample                                                        */
 /*===========================================================================*/
@@ -104,3 +290,229 @@ int ct_batch_verify(const ct_batch_t *batch)
     
     return (memcmp(computed_hash, batch->batch_hash, 32) == 0) ? 1 : 0;
 }
+
+/*===========================================================================*/
+/* ct_batch_pack                                                              */
+/*===========================================================================*/
+
+int ct_batch_pack(ct_batch_t *batch, int32_t *buf, uint32_t capacity)
+{
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        if (batch->samples[i].total_elements > capacity - total) {
+            return -1;
+        }
+        total += batch->samples[i].total_elements;
+    }
+    
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        ct_sample_t *s = &batch->samples[i];
+        if (s->total_elements == 0) {
+            continue;
+        }
+        memmove(&buf[offset], s->data, (size_t)s->total_elements * sizeof(int32_t));
+        s->data = &buf[offset];
+        offset += s->total_elements;
+    }
+    return 0;
+}
+
+/*===========================================================================*/
+/* Compact batches (CT-STRUCT-001 §10.1)                                     */
+/*===========================================================================*/
+
+void ct_batch_ref_init(ct_batch_ref_t *batch,
+                       ct_sample_ref_t *refs,
+                       uint32_t batch_size)
+{
+    batch->refs = refs;
+    batch->batch_size = batch_size;
+    batch->batch_index = 0;
+    batch->epoch = 0;
+    batch->count = 0;
+    batch->hash_mode = CT_BATCH_HASH_CONTENT;
+    memset(batch->dataset_hash, 0, 32);
+    memset(batch->batch_hash, 0, 32);
+}
+
+int ct_batch_ref_set_hash_mode(ct_batch_ref_t *batch,
+                               uint32_t hash_mode,
+                               const ct_hash_t dataset_hash)
+{
+    if (hash_mode == CT_BATCH_HASH_CONTENT) {
+        memset(batch->dataset_hash, 0, 32);
+    } else if (hash_mode == CT_BATCH_HASH_REFERENCE) {
+        memcpy(batch->dataset_hash, dataset_hash, 32);
+    } else {
+        return -1;
+    }
+    batch->hash_mode = hash_mode;
+    return 0;
+}
+
+static void fill_refs(ct_batch_ref_t *batch,
+                      uint32_t num_samples,
+                      const ct_hash_t *leaf_hashes,
+                      const ct_alias_table_t *sampler,
+                      const ct_exclusion_t *exclusion,
+                      uint32_t epoch_samples,
+                      uint32_t batch_index,
+                      uint32_t epoch,
+                      uint64_t seed)
+{
+    batch->batch_index = batch_index;
+    batch->epoch = epoch;
+    
+    uint32_t start_idx = batch_index * batch->batch_size;
+    uint32_t samples_in_batch = 0;
+    
+    /* Last batch may be partial */
+    if (start_idx < epoch_samples) {
+        samples_in_batch = epoch_samples - start_idx;
+        if (samples_in_batch > batch->batch_size) {
+            samples_in_batch = batch->batch_size;
+        }
+    }
+    batch->count = samples_in_batch;
+    
+    uint32_t shuffled[BATCH_PERMUTE_CHUNK];
+    for (uint32_t base = 0; base < samples_in_batch; base += BATCH_PERMUTE_CHUNK) {
+        uint32_t len = samples_in_batch - base;
+        if (len > BATCH_PERMUTE_CHUNK) {
+            len = BATCH_PERMUTE_CHUNK;
+        }
+        select_range(sampler, exclusion, start_idx + base, len, num_samples, seed, epoch, shuffled);
+        
+        for (uint32_t j = 0; j < len; j++) {
+            batch->refs[base + j].original_index = start_idx + base + j;
+            batch->refs[base + j].shuffled_index = shuffled[j];
+        }
+    }
+    
+    /* Padding slots reference nothing and hash as zero leaves */
+    for (uint32_t i = samples_in_batch; i < batch->batch_size; i++) {
+        batch->refs[i].original_index = start_idx + i;
+        batch->refs[i].shuffled_index = CT_SAMPLE_REF_NONE;
+    }
+    
+    ct_hash_batch_refs(batch, leaf_hashes, batch->batch_hash);
+}
+
+void ct_batch_ref_fill(ct_batch_ref_t *batch,
+                       uint32_t num_samples,
+                       const ct_hash_t *leaf_hashes,
+                       uint32_t batch_index,
+                       uint32_t epoch,
+                       uint64_t seed)
+{
+    fill_refs(batch, num_samples, leaf_hashes, NULL, NULL, num_samples, batch_index, epoch, seed);
+}
+
+int ct_batch_ref_fill_subset(ct_batch_ref_t *batch,
+                             uint32_t num_samples,
+                             const ct_hash_t *leaf_hashes,
+                             uint32_t epoch_samples,
+                             uint32_t batch_index,
+                             uint32_t epoch,
+                             uint64_t seed)
+{
+    if (epoch_samples == 0 || epoch_samples > num_samples) {
+        return -1;
+    }
+    fill_refs(batch, num_samples, leaf_hashes, NULL, NULL, epoch_samples, batch_index, epoch, seed);
+    return 0;
+}
+
+int ct_batch_ref_fill_excluding(ct_batch_ref_t *batch,
+                                uint32_t num_samples,
+                                const ct_hash_t *leaf_hashes,
+                                const ct_exclusion_t *exclusion,
+                                uint32_t batch_index,
+                                uint32_t epoch,
+                                uint64_t seed)
+{
+    if (exclusion->num_samples != num_samples || exclusion->num_kept == 0) {
+        return -1;
+    }
+    fill_refs(batch, num_samples, leaf_hashes, NULL, exclusion, exclusion->num_kept,
+              batch_index, epoch, seed);
+    return 0;
+}
+
+int ct_batch_ref_fill_weighted(ct_batch_ref_t *batch,
+                               uint32_t num_samples,
+                               const ct_hash_t *leaf_hashes,
+                               const ct_alias_table_t *sampler,
+                               uint32_t batch_index,
+                               uint32_t epoch,
+                               uint64_t seed)
+{
+    if (sampler->num_samples != num_samples) {
+        return -1;
+    }
+    fill_refs(batch, num_samples, leaf_hashes, sampler, NULL, num_samples, batch_index, epoch, seed);
+    return 0;
+}
+
+int ct_batch_ref_fill_stratified(ct_batch_ref_t *batch,
+                                  const ct_hash_t *leaf_hashes,
+                                  const ct_strata_t *strata,
+                                  uint32_t batch_index,
+                                  uint32_t epoch,
+                                  uint64_t seed)
+{
+    if (strata->batch_size != batch->batch_size) {
+        return -1;
+    }
+    batch->batch_index = batch_index;
+    batch->epoch = epoch;
+    batch->count = batch->batch_size;
+    
+    uint32_t idx[BATCH_PERMUTE_CHUNK];
+    uint32_t grouped = 0;
+    for (uint32_t c = 0; c < strata->num_classes; c++) {
+        uint32_t quota = strata->quota[c];
+        for (uint32_t base = 0; base < quota; base += BATCH_PERMUTE_CHUNK) {
+            uint32_t len = quota - base;
+            if (len > BATCH_PERMUTE_CHUNK) {
+                len = BATCH_PERMUTE_CHUNK;
+            }
+            ct_strata_class_range(strata, seed, epoch, c,
+                                  (uint64_t)batch_index * quota + base, len, idx);
+            
+            for (uint32_t j = 0; j < len; j++) {
+                uint32_t i = strata->slots[grouped + base + j];
+                batch->refs[i].original_index = batch_index * batch->batch_size + i;
+                batch->refs[i].shuffled_index = idx[j];
+            }
+        }
+        grouped += quota;
+    }
+    
+    ct_hash_batch_refs(batch, leaf_hashes, batch->batch_hash);
+    return 0;
+}
+
+const ct_sample_t* ct_batch_ref_resolve(const ct_batch_ref_t *batch,
+                                        const ct_dataset_t *dataset,
+                                        uint32_t index)
+{
+    if (index >= batch->count) {
+        return NULL;
+    }
+    
+    uint32_t idx = batch->refs[index].shuffled_index;
+    if (idx >= dataset->num_samples) {
+        return NULL;
+    }
+    return &dataset->samples[idx];
+}
+
+int ct_batch_ref_verify(const ct_batch_ref_t *batch, const ct_hash_t *leaf_hashes)
+{
+    ct_hash_t computed_hash;
+    ct_hash_batch_refs(batch, leaf_hashes, computed_hash);
+    
+    return (memcmp(computed_hash, batch->batch_hash, 32) == 0) ? 1 : 0;
+}
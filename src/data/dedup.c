@@ -0,0 +1,148 @@
+/**
+ * @file dedup.c
+ * @project Certifiable Data Pipeline
+ * @brief Finding duplicate samples by their leaf hashes.
+ *
+ * @details SHA-256 digests are uniform, so the table needs no further
+ *          hashing: digest bytes 0–3 pick the partition and bytes 4–7 the
+ *          home slot. A slot keeps the whole digest, so the pass never reads
+ *          leaves again and inputs can be streamed from storage.
+ *
+ * @traceability CT-MATH-001 §7.11, CT-STRUCT-001 §26
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "dedup.h"
+#include "exclusion.h"
+#include <string.h>
+
+static uint32_t get_u32_le(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) |
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+/*===========================================================================*/
+/* Partitioned table (CT-MATH-001 §7.11)                                     */
+/*===========================================================================*/
+
+uint32_t ct_dedup_partition_of(const ct_hash_t hash, uint32_t num_partitions)
+{
+    return (uint32_t)(((uint64_t)get_u32_le(hash) * num_partitions) >> 32);
+}
+
+int ct_dedup_init(ct_dedup_t *dedup,
+                  ct_dedup_slot_t *slots,
+                  uint32_t capacity,
+                  ct_dedup_pair_t *pairs,
+                  uint32_t max_pairs,
+                  uint32_t num_partitions,
+                  uint32_t partition)
+{
+    if (capacity == 0 || (capacity & (capacity - 1U)) != 0 || partition >= num_partitions) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < capacity; i++) {
+        slots[i].index = CT_DEDUP_EMPTY;
+    }
+    dedup->slots = slots;
+    dedup->pairs = pairs;
+    dedup->capacity = capacity;
+    dedup->max_pairs = max_pairs;
+    dedup->num_partitions = num_partitions;
+    dedup->partition = partition;
+    dedup->next_index = 0;
+    dedup->num_unique = 0;
+    dedup->num_duplicates = 0;
+    return 0;
+}
+
+int ct_dedup_add(ct_dedup_t *dedup, const ct_hash_t *leaves, uint32_t count)
+{
+    if (count > CT_DEDUP_EMPTY - dedup->next_index) {
+        return -1;
+    }
+    uint32_t mask = dedup->capacity - 1U;
+    /* At most 7/8 full, and never full, so every probe ends at a free slot */
+    uint32_t reserve = (dedup->capacity < 8U) ? 1U : dedup->capacity / 8U;
+    uint32_t limit = dedup->capacity - reserve;
+
+    for (uint32_t j = 0; j < count; j++) {
+        const uint8_t *hash = leaves[j];
+        uint32_t index = dedup->next_index++;
+        if (ct_dedup_partition_of(hash, dedup->num_partitions) != dedup->partition) {
+            continue;
+        }
+
+        /* Probe from the home slot to the digest or the first free slot */
+        uint32_t s = get_u32_le(hash + 4) & mask;
+        while (dedup->slots[s].index != CT_DEDUP_EMPTY &&
+               memcmp(dedup->slots[s].hash, hash, 32) != 0) {
+            s = (s + 1U) & mask;
+        }
+
+        ct_dedup_slot_t *slot = &dedup->slots[s];
+        if (slot->index != CT_DEDUP_EMPTY) {
+            if (dedup->num_duplicates == dedup->max_pairs) {
+                return -1;
+            }
+            dedup->pairs[dedup->num_duplicates].index = index;
+            dedup->pairs[dedup->num_duplicates].canonical = slot->index;
+            dedup->num_duplicates++;
+        } else {
+            if (dedup->num_unique == limit) {
+                return -1;
+            }
+            memcpy(slot->hash, hash, 32);
+            slot->index = index;
+            dedup->num_unique++;
+        }
+    }
+    return 0;
+}
+
+/*===========================================================================*/
+/* Results (CT-MATH-001 §7.11)                                               */
+/*===========================================================================*/
+
+int ct_dedup_exclude(const ct_dedup_t *parts, uint32_t num_parts, ct_exclusion_t *exclusion)
+{
+    for (uint32_t p = 0; p < num_parts; p++) {
+        for (uint32_t j = 0; j < parts[p].num_duplicates; j++) {
+            if (parts[p].pairs[j].index >= exclusion->num_samples) {
+                return -1;
+            }
+        }
+    }
+    for (uint32_t p = 0; p < num_parts; p++) {
+        for (uint32_t j = 0; j < parts[p].num_duplicates; j++) {
+            uint32_t i = parts[p].pairs[j].index;
+            exclusion->words[i / 64U] |= 1ULL << (i % 64U);
+        }
+    }
+    ct_exclusion_rebuild(exclusion);
+    return 0;
+}
+
+uint32_t ct_dedup_unique(const ct_exclusion_t *exclusion, uint32_t *out)
+{
+    uint32_t k = 0;
+    for (uint32_t w = 0; w < CT_EXCLUSION_WORDS(exclusion->num_samples); w++) {
+        uint64_t excluded = exclusion->words[w];
+        uint32_t end = exclusion->num_samples - w * 64U;
+        if (end > 64U) {
+            end = 64U;
+        }
+        for (uint32_t b = 0; b < end; b++) {
+            if (((excluded >> b) & 1U) == 0) {
+                out[k++] = w * 64U + b;
+            }
+        }
+    }
+    return k;
+}
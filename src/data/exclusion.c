@@ -0,0 +1,193 @@
+/**
+ * @file exclusion.c
+ * @project Certifiable Data Pipeline
+ * @brief Removing samples from a dataset in place (exclusion bitmap).
+ *
+ * @details The rank directory follows rank9: per block, one word holds the
+ *          survivors before it and one packs seven 9-bit running counts
+ *          for its words. Bit counts use portable SWAR popcount, and select
+ *          within a word is branch-free on running byte counts.
+ *
+ * @traceability CT-MATH-001 §7.9, CT-STRUCT-001 §24
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "exclusion.h"
+#include "merkle.h"
+#include <string.h>
+
+#define BLOCK_SAMPLES  512U
+#define BLOCK_WORDS    8U
+#define HINT_STRIDE    512U
+
+/*===========================================================================*/
+/* Bit helpers                                                                */
+/*===========================================================================*/
+
+static uint32_t popcount64(uint64_t x)
+{
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (uint32_t)((x * 0x0101010101010101ULL) >> 56);
+}
+
+#define ONES_8   0x0101010101010101ULL
+#define HIGHS_8  0x8080808080808080ULL
+
+/* Bytes of prefix (each at most 64) that are at most r (below 64) */
+static uint32_t count_at_most(uint64_t prefix, uint32_t r)
+{
+    uint64_t le = (((uint64_t)r * ONES_8 | HIGHS_8) - prefix) & HIGHS_8;
+    return (uint32_t)(((le >> 7) * ONES_8) >> 56);
+}
+
+/* Position of the r-th set bit of x (r below popcount64(x)), branch-free:
+ * find the byte from running byte counts, then the bit the same way */
+static uint32_t select64(uint64_t x, uint32_t r)
+{
+    uint64_t s = x - ((x >> 1) & 0x5555555555555555ULL);
+    s = (s & 0x3333333333333333ULL) + ((s >> 2) & 0x3333333333333333ULL);
+    s = ((s + (s >> 4)) & 0x0F0F0F0F0F0F0F0FULL) * ONES_8;
+
+    uint32_t shift = 8U * count_at_most(s, r);
+    r -= (uint32_t)(((s << 8) >> shift) & 0xFFU);
+
+    /* Spread the byte's bits one per byte, then count the same way */
+    uint64_t byte = (x >> shift) & 0xFFU;
+    uint64_t spread = (byte * ONES_8) & 0x8040201008040201ULL;
+    uint64_t bits = ((spread + 0x7F7F7F7F7F7F7F7FULL) & HIGHS_8) >> 7;
+    return shift + count_at_most(bits * ONES_8, r);
+}
+
+/*===========================================================================*/
+/* Construction                                                               */
+/*===========================================================================*/
+
+void ct_exclusion_init(ct_exclusion_t *exclusion,
+                       uint32_t n,
+                       uint64_t *words,
+                       uint64_t *blocks,
+                       uint32_t *hints)
+{
+    memset(words, 0, (size_t)CT_EXCLUSION_WORDS(n) * sizeof(uint64_t));
+    exclusion->words = words;
+    exclusion->blocks = blocks;
+    exclusion->hints = hints;
+    exclusion->num_samples = n;
+    ct_exclusion_rebuild(exclusion);
+}
+
+int ct_exclusion_add(ct_exclusion_t *exclusion, const uint32_t *indices, uint32_t count)
+{
+    for (uint32_t j = 0; j < count; j++) {
+        if (indices[j] >= exclusion->num_samples) {
+            return -1;
+        }
+    }
+    for (uint32_t j = 0; j < count; j++) {
+        exclusion->words[indices[j] / 64U] |= 1ULL << (indices[j] % 64U);
+    }
+    ct_exclusion_rebuild(exclusion);
+    return 0;
+}
+
+void ct_exclusion_rebuild(ct_exclusion_t *exclusion)
+{
+    uint32_t n = exclusion->num_samples;
+    uint32_t num_words = CT_EXCLUSION_WORDS(n);
+    uint32_t num_blocks = (n + BLOCK_SAMPLES - 1U) / BLOCK_SAMPLES;
+
+    /* Rank directory: survivors before each block, and field k − 1 of
+     * its second word counts those in the block's words 0 … k − 1 */
+    uint32_t kept = 0;
+    for (uint32_t b = 0; b < num_blocks; b++) {
+        uint32_t in_block = 0;
+        uint64_t packed = 0;
+        for (uint32_t k = 0; k < BLOCK_WORDS; k++) {
+            uint32_t w = b * BLOCK_WORDS + k;
+            if (k > 0) {
+                packed |= (uint64_t)in_block << (9U * (k - 1U));
+            }
+            if (w < num_words) {
+                uint32_t bits = (n - w * 64U < 64U) ? n - w * 64U : 64U;
+                in_block += bits - popcount64(exclusion->words[w]);
+            }
+        }
+        exclusion->blocks[2U * b] = kept;
+        exclusion->blocks[2U * b + 1U] = packed;
+        kept += in_block;
+    }
+    exclusion->blocks[2U * num_blocks] = kept;
+    exclusion->blocks[2U * num_blocks + 1U] = 0;
+    exclusion->num_kept = kept;
+
+    /* Select directory: the block holding survivor 512j, and a last entry
+     * that bounds the search for the final stretch */
+    uint32_t j = 0;
+    for (uint32_t b = 0; b < num_blocks; b++) {
+        while (j * HINT_STRIDE < exclusion->blocks[2U * (b + 1U)]) {
+            exclusion->hints[j++] = b;
+        }
+    }
+    exclusion->hints[j] = (num_blocks > 0) ? num_blocks - 1U : 0U;
+
+    ct_hash_exclusion(exclusion, exclusion->bitmap_hash);
+}
+
+/*===========================================================================*/
+/* Rank and select                                                            */
+/*===========================================================================*/
+
+/* Survivors in words 0 … k − 1 of block b (k below 8) */
+static uint32_t in_block(const ct_exclusion_t *exclusion, uint32_t b, uint32_t k)
+{
+    /* k = 0 reads bit 63, which is always clear */
+    uint32_t field = (k + 7U) % 8U;
+    return (uint32_t)((exclusion->blocks[2U * b + 1U] >> (9U * field)) & 0x1FFU);
+}
+
+uint32_t ct_exclusion_rank(const ct_exclusion_t *exclusion, uint32_t i)
+{
+    uint32_t b = i / BLOCK_SAMPLES;
+    uint32_t w = i / 64U;
+    uint32_t rank = (uint32_t)exclusion->blocks[2U * b] + in_block(exclusion, b, w % BLOCK_WORDS);
+    uint32_t bits = i % 64U;
+    if (bits != 0) {
+        rank += bits - popcount64(exclusion->words[w] & ((1ULL << bits) - 1ULL));
+    }
+    return rank;
+}
+
+uint32_t ct_exclusion_select(const ct_exclusion_t *exclusion, uint32_t k)
+{
+    /* Last block in [lo, hi] that starts at or before survivor k */
+    uint32_t lo = exclusion->hints[k / HINT_STRIDE];
+    uint32_t hi = exclusion->hints[k / HINT_STRIDE + 1U];
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo + 1U) / 2U;
+        if (exclusion->blocks[2U * mid] <= k) {
+            lo = mid;
+        } else {
+            hi = mid - 1U;
+        }
+    }
+
+    /* Word: the running counts at or below r */
+    uint32_t r = k - (uint32_t)exclusion->blocks[2U * lo];
+    uint64_t packed = exclusion->blocks[2U * lo + 1U];
+    uint32_t word = 0;
+    for (uint32_t f = 0; f < BLOCK_WORDS - 1U; f++) {
+        word += (((packed >> (9U * f)) & 0x1FFU) <= r) ? 1U : 0U;
+    }
+    r -= in_block(exclusion, lo, word);
+
+    /* Padding bits read as kept, but survivor k comes before them */
+    uint32_t w = lo * BLOCK_WORDS + word;
+    return w * 64U + select64(~exclusion->words[w], r);
+}
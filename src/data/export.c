@@ -0,0 +1,211 @@
+/**
+ * @file export.c
+ * @project Certifiable Data Pipeline
+ * @brief Zero-copy batch export to tensor runtimes.
+ *
+ * @details The converting exports gather each sample straight from the batch
+ *          into the caller's buffer through the dispatched export kernel,
+ *          so conversion and packing are a single pass over the data.
+ *
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "export.h"
+#include "dispatch.h"
+#include <stddef.h>
+#include <string.h>
+
+/*===========================================================================*/
+/* Helpers                                                                    */
+/*===========================================================================*/
+
+static int same_shape(const ct_sample_t *a, const ct_sample_t *b)
+{
+    if (a->dtype != b->dtype || a->ndims != b->ndims ||
+        a->total_elements != b->total_elements) {
+        return 0;
+    }
+    for (uint32_t d = 0; d < a->ndims; d++) {
+        if (a->dims[d] != b->dims[d]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Number of leading filled samples if they share one valid Q16.16 shape, else 0 */
+static uint32_t uniform_count(const ct_batch_t *batch)
+{
+    /* Filled samples lead; ct_batch_fill pads only at the end */
+    uint32_t count = 0;
+    while (count < batch->batch_size && batch->samples[count].total_elements != 0) {
+        count++;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    const ct_sample_t *first = &batch->samples[0];
+    if (first->dtype != CT_DTYPE_Q16_16 || first->ndims == 0 || first->ndims > CT_MAX_DIMS) {
+        return 0;
+    }
+    for (uint32_t i = 1; i < count; i++) {
+        if (!same_shape(first, &batch->samples[i])) {
+            return 0;
+        }
+    }
+    return count;
+}
+
+static void export_deleter(ct_dl_managed_tensor_t *self)
+{
+    ct_batch_export_t *e = (ct_batch_export_t *)self->manager_ctx;
+    ct_export_release_fn release = e->release;
+
+    /* A second call is harmless */
+    e->release = NULL;
+    if (release != NULL) {
+        release(e->release_ctx);
+    }
+}
+
+/*===========================================================================*/
+/* Tensor description                                                         */
+/*===========================================================================*/
+
+static void describe_tensor(ct_batch_export_t *out, const ct_sample_t *first,
+                            uint32_t count, int64_t sample_stride, void *data,
+                            uint8_t code, uint8_t bits,
+                            ct_export_release_fn release, void *release_ctx)
+{
+    memset(out, 0, sizeof(*out));
+    out->shape[0] = (int64_t)count;
+    out->strides[0] = sample_stride;
+
+    /* Row-major within a sample */
+    int64_t inner = 1;
+    for (uint32_t d = first->ndims; d > 0; d--) {
+        out->shape[d] = (int64_t)first->dims[d - 1];
+        out->strides[d] = inner;
+        inner *= (int64_t)first->dims[d - 1];
+    }
+
+    ct_dl_tensor_t *t = &out->managed.dl_tensor;
+    t->data = data;
+    t->device.device_type = CT_DL_DEVICE_CPU;
+    t->device.device_id = 0;
+    t->ndim = (int32_t)first->ndims + 1;
+    t->dtype.code = code;
+    t->dtype.bits = bits;
+    t->dtype.lanes = 1;
+    t->shape = out->shape;
+    t->strides = out->strides;
+    t->byte_offset = 0;
+
+    out->managed.manager_ctx = out;
+    out->managed.deleter = export_deleter;
+    out->release = release;
+    out->release_ctx = release_ctx;
+}
+
+/*===========================================================================*/
+/* ct_batch_export_dlpack                                                     */
+/*===========================================================================*/
+
+int ct_batch_export_dlpack(const ct_batch_t *batch,
+                           ct_batch_export_t *out,
+                           ct_export_release_fn release,
+                           void *release_ctx)
+{
+    uint32_t count = uniform_count(batch);
+    if (count == 0) {
+        return -1;
+    }
+
+    /* Constant stride between consecutive samples, in whole elements */
+    const ct_sample_t *first = &batch->samples[0];
+    uintptr_t base = (uintptr_t)first->data;
+    uintptr_t step = first->total_elements * sizeof(int32_t);
+    if (count > 1) {
+        uintptr_t second = (uintptr_t)batch->samples[1].data;
+        if (second < base + step || ((second - base) % sizeof(int32_t)) != 0) {
+            return -1;
+        }
+        step = second - base;
+    }
+    for (uint32_t i = 1; i < count; i++) {
+        if ((uintptr_t)batch->samples[i].data != base + i * step) {
+            return -1;
+        }
+    }
+
+    describe_tensor(out, first, count, (int64_t)(step / sizeof(int32_t)), first->data,
+                    CT_DL_CODE_INT, 32, release, release_ctx);
+    return 0;
+}
+
+/*===========================================================================*/
+/* Converting export (CT-MATH-001 §3.11)                                     */
+/*===========================================================================*/
+
+static int export_converted(const ct_batch_t *batch, void *buf, uint32_t capacity,
+                            uint8_t code, uint8_t bits, ct_batch_export_t *out,
+                            ct_export_release_fn release, void *release_ctx)
+{
+    uint32_t count = uniform_count(batch);
+    if (count == 0) {
+        return -1;
+    }
+    const ct_sample_t *first = &batch->samples[0];
+    uint32_t total = first->total_elements;
+    if ((uint64_t)count * total > capacity) {
+        return -1;
+    }
+
+    const ct_dispatch_t *k = ct_dispatch_get();
+    for (uint32_t i = 0; i < count; i++) {
+        const int32_t *src = batch->samples[i].data;
+        size_t offset = (size_t)i * total;
+        if (code == CT_DL_CODE_BFLOAT) {
+            k->to_bf16(src, (uint16_t *)buf + offset, total);
+        } else if (bits == 64) {
+            k->to_f64(src, (double *)buf + offset, total);
+        } else {
+            k->to_f32(src, (float *)buf + offset, total);
+        }
+    }
+
+    describe_tensor(out, first, count, (int64_t)total, buf, code, bits,
+                    release, release_ctx);
+    return 0;
+}
+
+int ct_batch_export_f32(const ct_batch_t *batch, float *buf, uint32_t capacity,
+                        ct_batch_export_t *out, ct_export_release_fn release,
+                        void *release_ctx)
+{
+    return export_converted(batch, buf, capacity, CT_DL_CODE_FLOAT, 32, out,
+                            release, release_ctx);
+}
+
+int ct_batch_export_f64(const ct_batch_t *batch, double *buf, uint32_t capacity,
+                        ct_batch_export_t *out, ct_export_release_fn release,
+                        void *release_ctx)
+{
+    return export_converted(batch, buf, capacity, CT_DL_CODE_FLOAT, 64, out,
+                            release, release_ctx);
+}
+
+int ct_batch_export_bf16(const ct_batch_t *batch, uint16_t *buf, uint32_t capacity,
+                         ct_batch_export_t *out, ct_export_release_fn release,
+                         void *release_ctx)
+{
+    return export_converted(batch, buf, capacity, CT_DL_CODE_BFLOAT, 16, out,
+                            release, release_ctx);
+}
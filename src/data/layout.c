@@ -0,0 +1,116 @@
+/**
+ * @file layout.c
+ * @project Certifiable Data Pipeline
+ * @brief Tensor layout conversion (CHW ↔ HWC, NCHW ↔ NHWC).
+ *
+ * @traceability CT-STRUCT-001 §23
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "layout.h"
+#include "dispatch.h"
+#include <string.h>
+
+/*===========================================================================*/
+/* Helpers                                                                    */
+/*===========================================================================*/
+
+static int valid_layout(ct_layout_t layout)
+{
+    return layout == CT_LAYOUT_CHW || layout == CT_LAYOUT_HWC;
+}
+
+static int convertible(const ct_sample_t *s)
+{
+    return s->dtype == CT_DTYPE_Q16_16 && s->ndims == 3 && s->data != NULL &&
+           (uint64_t)s->total_elements ==
+               (uint64_t)s->dims[0] * s->dims[1] * s->dims[2];
+}
+
+/* Write input's data into data in layout to, and its header into output */
+static void convert(const ct_sample_t *input, ct_layout_t from, ct_layout_t to,
+                    int32_t *data, ct_sample_t *output)
+{
+    uint32_t d0 = input->dims[0];
+    uint32_t d1 = input->dims[1];
+    uint32_t d2 = input->dims[2];
+    ct_sample_t header = *input;
+    header.data = data;
+
+    if (from == to) {
+        memcpy(data, input->data, (size_t)input->total_elements * sizeof(int32_t));
+    } else if (from == CT_LAYOUT_CHW) {
+        /* [C][H·W] → [H·W][C] */
+        ct_dispatch_get()->transpose32(input->data, d1 * d2, data, d0, d0, d1 * d2);
+        header.dims[0] = d1;
+        header.dims[1] = d2;
+        header.dims[2] = d0;
+    } else {
+        /* [H·W][C] → [C][H·W] */
+        ct_dispatch_get()->transpose32(input->data, d2, data, d0 * d1, d0 * d1, d2);
+        header.dims[0] = d2;
+        header.dims[1] = d0;
+        header.dims[2] = d1;
+    }
+    *output = header;
+}
+
+/*===========================================================================*/
+/* ct_layout_sample                                                           */
+/*===========================================================================*/
+
+int ct_layout_sample(const ct_sample_t *input,
+                     ct_layout_t from,
+                     ct_layout_t to,
+                     ct_sample_t *output)
+{
+    if (!valid_layout(from) || !valid_layout(to) || !convertible(input) ||
+        output->data == NULL) {
+        return -1;
+    }
+    convert(input, from, to, output->data, output);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_batch_pack_layout                                                       */
+/*===========================================================================*/
+
+int ct_batch_pack_layout(ct_batch_t *batch,
+                         int32_t *buf,
+                         uint32_t capacity,
+                         ct_layout_t from,
+                         ct_layout_t to)
+{
+    if (!valid_layout(from) || !valid_layout(to)) {
+        return -1;
+    }
+
+    uint32_t total = 0;
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        const ct_sample_t *s = &batch->samples[i];
+        if (s->total_elements == 0) {
+            continue;
+        }
+        if (!convertible(s) || s->total_elements > capacity - total) {
+            return -1;
+        }
+        total += s->total_elements;
+    }
+
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        ct_sample_t *s = &batch->samples[i];
+        if (s->total_elements == 0) {
+            continue;
+        }
+        convert(s, from, to, &buf[offset], s);
+        offset += s->total_elements;
+    }
+    return 0;
+}
@@ -1,12 +1,12 @@
 /**
- * @file batch.c
+ * @file loader.c
  * @project Certifiable Data Pipeline
- * @brief Batch construction with Merkle commitment.
+ * @brief Dataset loading.
  *
- * @details Constructs batches from shuffled dataset with cryptographic
- *          commitment to batch contents.
+ * @details Dataset descriptors over caller-provided sample arrays, and the
+ *          load-time range scan used to plan unchecked kernels.
  *
- * @traceability SRS-005-BATCH, CT-MATH-001 §9
+ * @traceability SRS-001-LOADER, CT-STRUCT-001 §11, CT-MATH-001 §3.10, §14.5
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
  *
  * @author William Murray
@@ -15,92 +15,122 @@
  *          For commercial licensing: william@fstopify.com
  */
 
-#include "batch.h"
-#include "shuffle.h"
-#include "merkle.h"
+#include "loader.h"
+#include "dvm.h"
 #include <string.h>
 
 /*===========================================================================*/
-/* ct_batch_init                                                              */
+/* ct_dataset_init                                                            */
 /*===========================================================================*/
 
-void ct_batch_init(ct_batch_t *batch,
-                   ct_sample_t *samples,
-                   ct_hash_t *sample_hashes,
-                   uint32_t batch_size)
+void ct_dataset_init(ct_dataset_t *dataset,
+                     ct_sample_t *samples,
+                     uint32_t num_samples)
 {
-    batch->samples = samples;
-    batch->sample_hashes = sample_hashes;
-    batch->batch_size = batch_size;
-    batch->batch_index = 0;
-    memset(batch->batch_hash, 0, 32);
+    dataset->samples = samples;
+    dataset->num_samples = num_samples;
+    memset(dataset->dataset_hash, 0, 32);
 }
 
 /*===========================================================================*/
-/* ct_batch_fill (CT-MATH-001 §9.1)                                          */
+/* ct_dataset_scan_ranges (CT-MATH-001 §14.5)                                */
 /*===========================================================================*/
 
-void ct_batch_fill(ct_batch_t *batch,
-                   const ct_dataset_t *dataset,
-                   uint32_t batch_index,
-                   uint32_t epoch,
-                   uint64_t seed)
+void ct_dataset_scan_ranges(const ct_dataset_t *dataset,
+                            ct_range_t *ranges,
+                            uint32_t num_features)
 {
-    batch->batch_index = batch_index;
-    
-    uint32_t start_idx = batch_index * batch->batch_size;
-    uint32_t samples_in_batch = batch->batch_size;
-    
-    /* Last batch may be partial */
-    if (start_idx + samples_in_batch > dataset->num_samples) {
-        samples_in_batch = dataset->num_samples - start_idx;
+    for (uint32_t f = 0; f < num_features; f++) {
+        ranges[f].min = INT32_MAX;
+        ranges[f].max = INT32_MIN;
     }
-    
-    /* Fill batch with shuffled samples */
-    for (uint32_t i = 0; i < samples_in_batch; i++) {
-        uint32_t global_idx = start_idx + i;
-        uint32_t shuffled_idx = ct_permute_index(global_idx,
-                                                  dataset->num_samples,
-                                                  seed,
-                                                  epoch);
-        
-        /* Copy sample (shallow copy - data pointer remains) */
-        batch->samples[i] = dataset->samples[shuffled_idx];
-        
-        /* Compute and store sample hash */
-        ct_hash_sample(&batch->samples[i], batch->sample_hashes[i]);
-    }
-    
-    /* Pad remaining slots with zeros if partial batch */
-    for (uint32_t i = samples_in_batch; i < batch->batch_size; i++) {
-        memset(&batch->samples[i], 0, sizeof(ct_sample_t));
-        memset(batch->sample_hashes[i], 0, 32);
+
+    for (uint32_t s = 0; s < dataset->num_samples; s++) {
+        const ct_sample_t *sample = &dataset->samples[s];
+        uint32_t n = (sample->total_elements < num_features) ?
+                     sample->total_elements : num_features;
+
+        for (uint32_t f = 0; f < n; f++) {
+            int32_t v = sample->data[f];
+            if (v < ranges[f].min) {
+                ranges[f].min = v;
+            }
+            if (v > ranges[f].max) {
+                ranges[f].max = v;
+            }
+        }
     }
-    
-    /* Compute batch Merkle root */
-    ct_hash_batch(batch, batch->batch_hash);
 }
 
 /*===========================================================================*/
-/* ct_batch_get_sample                                                        */
+/* ct_range_union                                                             */
 /*===========================================================================*/
 
-const ct_sample_t* ct_batch_get_sample(const ct_batch_t *batch, uint32_t index)
+ct_range_t ct_range_union(const ct_range_t *ranges, uint32_t count)
 {
-    if (index >= batch->batch_size) {
-        return NULL;
+    ct_range_t u = { INT32_MAX, INT32_MIN };
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (ranges[i].min > ranges[i].max) {
+            continue;
+        }
+        if (ranges[i].min < u.min) {
+            u.min = ranges[i].min;
+        }
+        if (ranges[i].max > u.max) {
+            u.max = ranges[i].max;
+        }
     }
-    return &batch->samples[index];
+    return u;
 }
 
 /*===========================================================================*/
-/* ct_batch_verify                                                            */
+/* Narrow sample conversion (CT-MATH-001 §3.10)                              */
 /*===========================================================================*/
 
-int ct_batch_verify(const ct_batch_t *batch)
+void ct_sample_narrow(const ct_sample_t *input,
+                      ct_sample16_t *output,
+                      uint32_t dtype,
+                      ct_fault_flags_t *faults)
 {
-    ct_hash_t computed_hash;
-    ct_hash_batch(batch, computed_hash);
-    
-    return (memcmp(computed_hash, batch->batch_hash, 32) == 0) ? 1 : 0;
+    uint32_t frac_bits = ct_dtype_frac_bits(dtype);
+    if (frac_bits == 0 || frac_bits > 15) {
+        faults->domain = 1;
+        return;
+    }
+
+    output->version = input->version;
+    output->dtype = dtype;
+    output->ndims = input->ndims;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        output->dims[i] = input->dims[i];
+    }
+    output->total_elements = input->total_elements;
+
+    for (uint32_t i = 0; i < input->total_elements; i++) {
+        output->data[i] = dvm_narrow16(input->data[i], frac_bits, faults);
+    }
+}
+
+void ct_sample_widen(const ct_sample16_t *input,
+                     ct_sample_t *output,
+                     ct_fault_flags_t *faults)
+{
+    uint32_t frac_bits = ct_dtype_frac_bits(input->dtype);
+    if (frac_bits == 0 || frac_bits > 15) {
+        faults->domain = 1;
+        return;
+    }
+
+    output->version = input->version;
+    output->dtype = CT_DTYPE_Q16_16;
+    output->ndims = input->ndims;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        output->dims[i] = input->dims[i];
+    }
+    output->total_elements = input->total_elements;
+
+    for (uint32_t i = 0; i < input->total_elements; i++) {
+        output->data[i] = dvm_widen16(input->data[i], frac_bits);
+    }
 }
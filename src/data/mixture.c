@@ -0,0 +1,171 @@
+/**
+ * @file mixture.c
+ * @project Certifiable Data Pipeline
+ * @brief Weighted mixtures of several datasets.
+ *
+ * @details The cycle schedule uses the slot rule of the stratified ordering
+ *          (CT-MATH-001 §7.7) over sources instead of classes. ranks[] turns
+ *          a position into its source's stream position without counting.
+ *
+ * @traceability CT-MATH-001 §7.10, CT-STRUCT-001 §25
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "mixture.h"
+#include "merkle.h"
+#include "prng.h"
+#include "shuffle.h"
+#include <string.h>
+
+/* Separates source streams from the other keys derived from the same seed */
+#define MIXTURE_SEED_KEY 0x4D49585455524553ULL   /* "MIXTURES" */
+#define MIXTURE_CHUNK    64U
+
+/*===========================================================================*/
+/* ct_mixture_build (CT-MATH-001 §7.10)                                      */
+/*===========================================================================*/
+
+int ct_mixture_build(ct_mixture_t *mixture,
+                     const ct_dataset_t *datasets,
+                     const uint32_t *weights,
+                     uint32_t num_sources,
+                     uint32_t epoch_samples,
+                     uint32_t *schedule,
+                     uint32_t *ranks,
+                     uint32_t *work)
+{
+    if (num_sources == 0 || epoch_samples == 0) {
+        return -1;
+    }
+    uint64_t total = 0;
+    for (uint32_t s = 0; s < num_sources; s++) {
+        if (weights[s] != 0 && datasets[s].num_samples == 0) {
+            return -1;
+        }
+        total += weights[s];
+    }
+    if (total == 0 || total > 0x7FFFFFFFU) {
+        return -1;
+    }
+    uint32_t w = (uint32_t)total;
+
+    /* Slot i goes to the source furthest behind its share, (i + 1) ×
+     * weights[s] / W, lowest source on ties */
+    memset(work, 0, (size_t)num_sources * sizeof(uint32_t));
+    for (uint32_t i = 0; i < w; i++) {
+        int64_t best = INT64_MIN;
+        uint32_t best_source = 0;
+        for (uint32_t s = 0; s < num_sources; s++) {
+            if (weights[s] != 0) {
+                int64_t credit = (int64_t)((uint64_t)(i + 1U) * weights[s]) -
+                                 (int64_t)((uint64_t)w * work[s]);
+                if (credit > best) {
+                    best = credit;
+                    best_source = s;
+                }
+            }
+        }
+        schedule[i] = best_source;
+        ranks[i] = work[best_source]++;
+    }
+
+    mixture->datasets = datasets;
+    mixture->weights = weights;
+    mixture->schedule = schedule;
+    mixture->ranks = ranks;
+    mixture->num_sources = num_sources;
+    mixture->total_weight = w;
+    mixture->epoch_samples = epoch_samples;
+    ct_hash_mixture(mixture, mixture->mixture_hash);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_mixture_range (CT-MATH-001 §7.10)                                      */
+/*===========================================================================*/
+
+/* Sample indices at stream positions [position, position + count) of one
+ * source: one permutation per (epoch, source), re-keyed by pass */
+static void source_range(const ct_mixture_t *mixture,
+                         uint64_t seed,
+                         uint32_t epoch,
+                         uint32_t source,
+                         uint32_t position,
+                         uint32_t count,
+                         uint32_t *out)
+{
+    uint32_t size = mixture->datasets[source].num_samples;
+    uint64_t key = ct_prng(seed ^ MIXTURE_SEED_KEY, epoch, source);
+
+    uint32_t done = 0;
+    while (done < count) {
+        uint32_t p = position + done;
+        uint32_t pos = p % size;
+        uint32_t len = size - pos;
+        if (len > count - done) {
+            len = count - done;
+        }
+        ct_permute_range(pos, len, size, key, p / size, &out[done]);
+        done += len;
+    }
+}
+
+void ct_mixture_range(const ct_mixture_t *mixture,
+                      uint64_t seed,
+                      uint32_t epoch,
+                      uint32_t start,
+                      uint32_t count,
+                      uint32_t *out_source,
+                      uint32_t *out_index)
+{
+    uint32_t w = mixture->total_weight;
+    uint32_t idx[MIXTURE_CHUNK];
+    uint8_t resolved[MIXTURE_CHUNK];
+
+    for (uint32_t base = 0; base < count; base += MIXTURE_CHUNK) {
+        uint32_t len = (count - base < MIXTURE_CHUNK) ? count - base : MIXTURE_CHUNK;
+        uint32_t *source = &out_source[base];
+        uint32_t *index = &out_index[base];
+
+        /* Source and stream position: position p is cycle p / W, slot p mod W */
+        uint32_t cycle = (start + base) / w;
+        uint32_t slot = (start + base) % w;
+        for (uint32_t j = 0; j < len; j++) {
+            uint32_t s = mixture->schedule[slot];
+            source[j] = s;
+            index[j] = cycle * mixture->weights[s] + mixture->ranks[slot];
+            if (++slot == w) {
+                slot = 0;
+                cycle++;
+            }
+        }
+
+        /* A source's positions in the chunk are a run of its stream,
+         * starting at its first one */
+        memset(resolved, 0, len);
+        for (uint32_t j = 0; j < len; j++) {
+            if (resolved[j]) {
+                continue;
+            }
+            uint32_t s = source[j];
+            uint32_t run = 0;
+            for (uint32_t t = j; t < len; t++) {
+                run += (source[t] == s) ? 1U : 0U;
+            }
+            source_range(mixture, seed, epoch, s, index[j], run, idx);
+
+            uint32_t next = 0;
+            for (uint32_t t = j; t < len; t++) {
+                if (source[t] == s) {
+                    index[t] = idx[next++];
+                    resolved[t] = 1;
+                }
+            }
+        }
+    }
+}
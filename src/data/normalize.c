@@ -16,6 +16,7 @@
  */
 
 #include "normalize.h"
+#include "dispatch.h"
 #include "dvm.h"
 #include <string.h>
 
@@ -31,6 +32,45 @@ void ct_normalize_init(ct_normalize_ctx_t *ctx,
     ctx->means = means;
     ctx->inv_stds = inv_stds;
     ctx->num_features = num_features;
+    ctx->unchecked = 0;
+}
+
+/*===========================================================================*/
+/* ct_normalize_plan (CT-MATH-001 §14.5)                                     */
+/*===========================================================================*/
+
+int ct_normalize_plan(ct_normalize_ctx_t *ctx,
+                      const ct_range_t *ranges,
+                      ct_range_t *out_ranges)
+{
+    int safe = 1;
+
+    for (uint32_t f = 0; f < ctx->num_features; f++) {
+        ct_range_t out = { INT32_MAX, INT32_MIN };
+
+        if (ranges[f].min <= ranges[f].max) {
+            /* Both steps are monotonic in x, so the endpoints bound every
+             * element: if neither saturates, no element in range can. */
+            ct_fault_flags_t faults = {0};
+            int32_t lo = dvm_sub32(ranges[f].min, ctx->means[f], &faults);
+            int32_t hi = dvm_sub32(ranges[f].max, ctx->means[f], &faults);
+            lo = dvm_mul_q16(lo, ctx->inv_stds[f], &faults);
+            hi = dvm_mul_q16(hi, ctx->inv_stds[f], &faults);
+
+            if (faults.overflow || faults.underflow) {
+                safe = 0;
+            }
+            out.min = (lo < hi) ? lo : hi;
+            out.max = (lo < hi) ? hi : lo;
+        }
+
+        if (out_ranges != NULL) {
+            out_ranges[f] = out;
+        }
+    }
+
+    ctx->unchecked = (uint32_t)safe;
+    return safe;
 }
 
 /*===========================================================================*/
@@ -52,19 +92,11 @@ void ct_normalize_sample(const ct_normalize_ctx_t *ctx,
     output->total_elements = input->total_elements;
     
     /* Normalize each element: y = (x - mean) * inv_std */
-    for (uint32_t i = 0; i < input->total_elements && i < ctx->num_features; i++) {
-        int32_t x = input->data[i];
-        int32_t mean = ctx->means[i];
-        int32_t inv_std = ctx->inv_stds[i];
-        
-        /* Subtract mean (saturating) */
-        int32_t centered = dvm_sub32(x, mean, faults);
-        
-        /* Multiply by inverse std (Q16.16 × Q16.16 → Q16.16) */
-        int32_t normalized = dvm_mul_q16(centered, inv_std, faults);
-        
-        output->data[i] = normalized;
-    }
+    uint32_t n = (input->total_elements < ctx->num_features) ?
+                 input->total_elements : ctx->num_features;
+    const ct_dispatch_t *k = ct_dispatch_get();
+    ct_kernel_normalize_fn normalize = ctx->unchecked ? k->normalize_unchecked : k->normalize;
+    normalize(input->data, ctx->means, ctx->inv_stds, output->data, n, faults);
     
     /* Copy remaining elements unchanged */
     for (uint32_t i = ctx->num_features; i < input->total_elements; i++) {
@@ -89,3 +121,51 @@ void ct_normalize_batch(const ct_normalize_ctx_t *ctx,
     output->batch_index = input->batch_index;
     memcpy(output->batch_hash, input->batch_hash, 32);
 }
+
+/*===========================================================================*/
+/* Narrow normalization (CT-MATH-001 §3.10)                                  */
+/*===========================================================================*/
+
+void ct_normalize16_init(ct_normalize16_ctx_t *ctx,
+                         const int16_t *means,
+                         const int16_t *inv_stds,
+                         uint32_t num_features,
+                         uint32_t dtype)
+{
+    ctx->means = means;
+    ctx->inv_stds = inv_stds;
+    ctx->num_features = num_features;
+    ctx->dtype = dtype;
+}
+
+void ct_normalize16_sample(const ct_normalize16_ctx_t *ctx,
+                           const ct_sample16_t *input,
+                           ct_sample16_t *output,
+                           ct_fault_flags_t *faults)
+{
+    uint32_t frac_bits = ct_dtype_frac_bits(ctx->dtype);
+    if (input->dtype != ctx->dtype || frac_bits == 0 || frac_bits > 15) {
+        faults->domain = 1;
+        return;
+    }
+
+    /* Copy metadata */
+    output->version = input->version;
+    output->dtype = input->dtype;
+    output->ndims = input->ndims;
+    for (uint32_t i = 0; i < CT_MAX_DIMS; i++) {
+        output->dims[i] = input->dims[i];
+    }
+    output->total_elements = input->total_elements;
+
+    /* y = (x - mean) * inv_std, all in the sample's own format */
+    uint32_t n = (input->total_elements < ctx->num_features) ?
+                 input->total_elements : ctx->num_features;
+    ct_dispatch_get()->normalize16(input->data, ctx->means, ctx->inv_stds,
+                                   output->data, n, frac_bits, faults);
+
+    /* Copy remaining elements unchanged */
+    for (uint32_t i = ctx->num_features; i < input->total_elements; i++) {
+        output->data[i] = input->data[i];
+    }
+}
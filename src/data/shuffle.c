@@ -3,7 +3,9 @@
  * @project Certifiable Data Pipeline
  * @brief Deterministic data shuffling via Feistel permutation.
  *
- * @details Implements bijective permutation using cycle-walking Feistel network.
+ * @details Implements bijective permutation using cycle-walking Feistel network,
+ *          weighted sampling with replacement from an alias table, and
+ *          stratified batches drawn from per-class permutations.
  *
  * @traceability SRS-004-SHUFFLE, CT-MATH-001 §7
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
@@ -16,8 +18,16 @@
 
 #include "shuffle.h"
 #include "sha256.h"
+#include "merkle.h"
+#include "prng.h"
+#include "dispatch.h"
 #include <string.h>
 
+/* Separates sampler draws from the augmentation op_ids of the same seed */
+#define ALIAS_SEED_KEY  0x53414D504C455253ULL   /* "SAMPLERS" */
+#define ALIAS_CHUNK     64U
+#define STRATA_SEED_KEY 0x5354524154494649ULL   /* "STRATIFI" */
+
 /*===========================================================================*/
 /* Helper: ceil_log2                                                          */
 /*===========================================================================*/
@@ -148,6 +158,333 @@ uint32_t ct_permute_index(uint32_t index, uint32_t N, uint64_t seed, uint32_t ep
     }
 }
 
+/*===========================================================================*/
+/* ct_permute_range (CT-MATH-001 §7.2, batched)                              */
+/*===========================================================================*/
+
+/*
+ * The round-function message seed || epoch || R || round_num is 17 bytes,
+ * so its SHA-256 is exactly one padded block. The block is built once per
+ * range; each round patches R and round_num and runs a single compression.
+ */
+static void feistel_block_init(uint8_t block[64], uint64_t seed, uint32_t epoch)
+{
+    memset(block, 0, 64);
+    for (uint32_t b = 0; b < 8; b++) {
+        block[b] = (uint8_t)((seed >> (8 * b)) & 0xFF);
+    }
+    for (uint32_t b = 0; b < 4; b++) {
+        block[8 + b] = (uint8_t)((epoch >> (8 * b)) & 0xFF);
+    }
+    block[17] = 0x80;          /* Padding marker */
+    block[63] = 17 * 8;        /* Message length in bits (big-endian) */
+}
+
+static uint32_t feistel_round_block(uint8_t block[64], ct_kernel_sha256_fn blocks,
+                                    uint32_t R, uint8_t round_num)
+{
+    uint32_t state[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+    block[12] = (uint8_t)(R & 0xFF);
+    block[13] = (uint8_t)((R >> 8) & 0xFF);
+    block[14] = (uint8_t)((R >> 16) & 0xFF);
+    block[15] = (uint8_t)((R >> 24) & 0xFF);
+    block[16] = round_num;
+
+    blocks(state, block, 1);
+
+    /* First 4 digest bytes, read little-endian */
+    return ((state[0] >> 24) & 0xFF) |
+           ((state[0] >> 8) & 0xFF00) |
+           ((state[0] << 8) & 0xFF0000) |
+           ((state[0] << 24) & 0xFF000000);
+}
+
+void ct_permute_range(uint32_t start,
+                      uint32_t count,
+                      uint32_t N,
+                      uint64_t seed,
+                      uint32_t epoch,
+                      uint32_t *out)
+{
+    if (N <= 1) {
+        memset(out, 0, (size_t)count * sizeof(uint32_t));
+        return;
+    }
+
+    ct_kernel_sha256_fn blocks = ct_dispatch_get()->sha256_blocks;
+    uint8_t block[64];
+    feistel_block_init(block, seed, epoch);
+
+    uint32_t k = ceil_log2(N);
+    uint32_t range = 1U << k;
+    uint32_t half_bits = (k + 1) / 2;
+    uint32_t half_mask = (1U << half_bits) - 1;
+
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t index = start + j;
+        if (index >= N) {
+            out[j] = index % N;
+            continue;
+        }
+
+        /* Same bounded cycle-walk as ct_permute_index */
+        uint32_t i = index;
+        uint32_t result = index % N;
+        for (uint32_t iterations = 0; iterations < range; iterations++) {
+            uint32_t L = i & half_mask;
+            uint32_t R = (i >> half_bits) & half_mask;
+
+            for (uint8_t round = 0; round < 4; round++) {
+                uint32_t F = feistel_round_block(block, blocks, R, round) & half_mask;
+                uint32_t new_L = R;
+                uint32_t new_R = L ^ F;
+                L = new_L;
+                R = new_R;
+            }
+
+            i = (R << half_bits) | L;
+            if (i < N) {
+                result = i;
+                break;
+            }
+        }
+        out[j] = result;
+    }
+}
+
+/*===========================================================================*/
+/* ct_alias_build (CT-MATH-001 §7.6)                                         */
+/*===========================================================================*/
+
+int ct_alias_build(ct_alias_table_t *table,
+                   const uint32_t *weights,
+                   uint32_t n,
+                   uint32_t *prob,
+                   uint32_t *alias,
+                   uint32_t *work)
+{
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        total += weights[i];
+    }
+    if (n == 0 || total == 0 || total > 0xFFFFFFFFU) {
+        return -1;
+    }
+    uint64_t w = total;
+
+    /* Column i holds mass weights[i] × n against a capacity of w. Until a
+     * column is settled its mass sits in (alias, prob) as (high, low). The
+     * small stack grows up from work[0], the large one down from work[n−1] */
+    uint32_t small = 0;
+    uint32_t large = n;
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t mass = (uint64_t)weights[i] * n;
+        prob[i] = (uint32_t)mass;
+        alias[i] = (uint32_t)(mass >> 32);
+        if (mass < w) {
+            work[small++] = i;
+        } else {
+            work[--large] = i;
+        }
+    }
+
+    /* Fill each under-full column from the top large one */
+    while (small > 0 && large < n) {
+        uint32_t s = work[--small];
+        uint32_t l = work[large];
+        alias[s] = l;
+
+        uint64_t mass = (((uint64_t)alias[l] << 32) | prob[l]) - (w - prob[s]);
+        prob[l] = (uint32_t)mass;
+        alias[l] = (uint32_t)(mass >> 32);
+        if (mass < w) {
+            large++;
+            work[small++] = l;
+        }
+    }
+
+    /* Masses sum to n × w, so what remains is exactly full */
+    while (large < n) {
+        uint32_t i = work[large++];
+        prob[i] = (uint32_t)w;
+        alias[i] = i;
+    }
+
+    table->prob = prob;
+    table->alias = alias;
+    table->num_samples = n;
+    table->total_weight = (uint32_t)w;
+    ct_hash_alias_table(table, table->table_hash);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_alias_draw (CT-MATH-001 §7.6)                                          */
+/*===========================================================================*/
+
+uint32_t ct_alias_draw(const ct_alias_table_t *table, uint64_t seed, uint32_t epoch,
+                       uint32_t draw)
+{
+    /* Draw d uses op_id 2d for the column and 2d + 1 for the coin */
+    uint64_t key = seed ^ ALIAS_SEED_KEY;
+    uint32_t column = ct_prng_uniform_v2(key, epoch, 2U * draw, table->num_samples);
+    uint32_t coin = ct_prng_uniform_v2(key, epoch, 2U * draw + 1U, table->total_weight);
+    return (coin < table->prob[column]) ? column : table->alias[column];
+}
+
+void ct_alias_draw_range(const ct_alias_table_t *table,
+                         uint64_t seed,
+                         uint32_t epoch,
+                         uint32_t start,
+                         uint32_t count,
+                         uint32_t *out)
+{
+    const ct_dispatch_t *k = ct_dispatch_get();
+    uint64_t key = seed ^ ALIAS_SEED_KEY;
+    uint64_t u[ALIAS_CHUNK];
+    uint32_t column[ALIAS_CHUNK];
+    uint32_t coin[ALIAS_CHUNK];
+
+    for (uint32_t base = 0; base < count; base += ALIAS_CHUNK) {
+        uint32_t len = (count - base < ALIAS_CHUNK) ? count - base : ALIAS_CHUNK;
+        uint32_t op = 2U * (start + base);
+        k->prng_stride(u, len, key, epoch, op, 2U);
+        k->bound_v2(u, column, len, table->num_samples);
+        k->prng_stride(u, len, key, epoch, op + 1U, 2U);
+        k->bound_v2(u, coin, len, table->total_weight);
+        for (uint32_t j = 0; j < len; j++) {
+            uint32_t c = column[j];
+            out[base + j] = (coin[j] < table->prob[c]) ? c : table->alias[c];
+        }
+    }
+}
+
+/*===========================================================================*/
+/* ct_strata_build (CT-MATH-001 §7.7)                                        */
+/*===========================================================================*/
+
+int ct_strata_build(ct_strata_t *strata,
+                    const uint32_t *labels,
+                    uint32_t n,
+                    const uint32_t *quota,
+                    uint32_t num_classes,
+                    uint32_t *offsets,
+                    uint32_t *members,
+                    uint32_t *slots,
+                    uint32_t *work)
+{
+    if (n == 0 || num_classes == 0) {
+        return -1;
+    }
+    uint64_t total = 0;
+    for (uint32_t c = 0; c < num_classes; c++) {
+        total += quota[c];
+    }
+    if (total == 0 || total > 0x7FFFFFFFU) {
+        return -1;
+    }
+    uint32_t b = (uint32_t)total;
+
+    /* Counting sort: count, exclusive prefix, scatter (offsets[c] ends at
+     * the end of class c), then shift back by one class */
+    memset(offsets, 0, ((size_t)num_classes + 1U) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < n; i++) {
+        if (labels[i] >= num_classes) {
+            return -1;
+        }
+        offsets[labels[i]]++;
+    }
+    for (uint32_t c = 0; c < num_classes; c++) {
+        if (quota[c] != 0 && offsets[c] == 0) {
+            return -1;
+        }
+    }
+    uint32_t sum = 0;
+    for (uint32_t c = 0; c < num_classes; c++) {
+        uint32_t count = offsets[c];
+        offsets[c] = sum;
+        sum += count;
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        members[offsets[labels[i]]++] = i;
+    }
+    for (uint32_t c = num_classes; c > 0; c--) {
+        offsets[c] = offsets[c - 1];
+    }
+    offsets[0] = 0;
+
+    /* Spread each class over the batch: slot i goes to the class furthest
+     * behind its share, (i + 1) × quota[c] / B, lowest class on ties.
+     * slots[] is indexed by class-grouped position Σ_{c' < c} quota + k */
+    memset(work, 0, (size_t)num_classes * sizeof(uint32_t));
+    for (uint32_t i = 0; i < b; i++) {
+        int64_t best = INT64_MIN;
+        uint32_t best_class = 0;
+        uint32_t best_base = 0;
+        uint32_t base = 0;
+        for (uint32_t c = 0; c < num_classes; c++) {
+            if (quota[c] != 0) {
+                int64_t credit = (int64_t)((uint64_t)(i + 1U) * quota[c]) -
+                                 (int64_t)((uint64_t)b * work[c]);
+                if (credit > best) {
+                    best = credit;
+                    best_class = c;
+                    best_base = base;
+                }
+            }
+            base += quota[c];
+        }
+        slots[best_base + work[best_class]] = i;
+        work[best_class]++;
+    }
+
+    strata->offsets = offsets;
+    strata->members = members;
+    strata->slots = slots;
+    strata->quota = quota;
+    strata->num_classes = num_classes;
+    strata->num_samples = n;
+    strata->batch_size = b;
+    ct_hash_strata(strata, strata->strata_hash);
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_strata_class_range (CT-MATH-001 §7.7)                                  */
+/*===========================================================================*/
+
+void ct_strata_class_range(const ct_strata_t *strata,
+                           uint64_t seed,
+                           uint32_t epoch,
+                           uint32_t class_id,
+                           uint64_t position,
+                           uint32_t count,
+                           uint32_t *out)
+{
+    /* One permutation per (epoch, class), re-keyed by pass */
+    uint32_t first = strata->offsets[class_id];
+    uint32_t size = strata->offsets[class_id + 1U] - first;
+    uint64_t key = ct_prng(seed ^ STRATA_SEED_KEY, epoch, class_id);
+
+    uint32_t done = 0;
+    while (done < count) {
+        uint64_t p = position + done;
+        uint32_t pass = (uint32_t)(p / size);
+        uint32_t pos = (uint32_t)(p % size);
+        uint32_t len = size - pos;
+        if (len > count - done) {
+            len = count - done;
+        }
+        ct_permute_range(pos, len, size, key, pass, &out[done]);
+        for (uint32_t j = done; j < done + len; j++) {
+            out[j] = strata->members[first + out[j]];
+        }
+        done += len;
+    }
+}
+
 /*===========================================================================*/
 /* ct_shuffle_init                                                            */
 /*===========================================================================*/
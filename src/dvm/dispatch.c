@@ -0,0 +1,702 @@
+/**
+ * @file dispatch.c
+ * @project Certifiable Data Pipeline
+ * @brief Runtime CPU feature detection and kernel dispatch.
+ *
+ * @details Detects CPU capabilities once, selects the widest supported
+ *          backend (or the one forced via CT_DISPATCH_BACKEND) and verifies
+ *          every selected kernel against the scalar reference before use.
+ *          A table that fails the self-check is never installed.
+ *          ARM features are reported but have no variants yet, so ARM
+ *          targets run the scalar reference.
+ *
+ * @traceability CT-MATH-001 §14.4
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "dispatch.h"
+#include "kernels.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if CT_HAVE_X86_KERNELS
+#include <cpuid.h>
+#endif
+
+#if defined(__linux__) && defined(__aarch64__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+/*===========================================================================*/
+/* Process-wide state                                                         */
+/*===========================================================================*/
+
+/* g_table and g_status are written only by the caller that moves g_state
+ * from IDLE to BUSY, and read only after READY is seen with acquire order */
+#define DISPATCH_IDLE   0
+#define DISPATCH_BUSY   1
+#define DISPATCH_READY  2
+
+static ct_dispatch_t g_table;
+static int g_state = DISPATCH_IDLE;
+static int g_status = 0;
+
+static const char *const BACKEND_NAMES[CT_BACKEND_COUNT] = {
+    "scalar", "sse4.1", "avx2", "avx512"
+};
+
+/*===========================================================================*/
+/* CPU feature detection                                                      */
+/*===========================================================================*/
+
+#if CT_HAVE_X86_KERNELS
+static uint64_t read_xcr0(void)
+{
+    uint32_t lo, hi;
+    __asm__ __volatile__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+}
+#endif
+
+uint32_t ct_cpu_features(void)
+{
+    uint32_t features = 0;
+
+#if CT_HAVE_X86_KERNELS
+    unsigned int a, b, c, d;
+    if (__get_cpuid(1, &a, &b, &c, &d) == 0) {
+        return 0;
+    }
+
+    if ((c & bit_SSE4_1) != 0) {
+        features |= CT_CPU_SSE41;
+    }
+
+    /* AVX state must be enabled by the OS (XCR0), not just present */
+    uint64_t xcr0 = ((c & bit_OSXSAVE) != 0) ? read_xcr0() : 0;
+    int ymm_ok = (xcr0 & 0x06) == 0x06;
+    int zmm_ok = (xcr0 & 0xE6) == 0xE6;
+
+    if (__get_cpuid_count(7, 0, &a, &b, &c, &d) != 0) {
+        if (ymm_ok && (b & bit_AVX2) != 0) {
+            features |= CT_CPU_AVX2;
+        }
+        const unsigned int avx512 = bit_AVX512F | bit_AVX512DQ | bit_AVX512BW | bit_AVX512VL;
+        if (zmm_ok && (b & avx512) == avx512) {
+            features |= CT_CPU_AVX512;
+        }
+        if ((b & bit_SHA) != 0 && (features & CT_CPU_SSE41) != 0) {
+            features |= CT_CPU_SHANI;
+        }
+    }
+#elif defined(__linux__) && defined(__aarch64__)
+    unsigned long hw = getauxval(AT_HWCAP);
+    if ((hw & HWCAP_ASIMD) != 0) {
+        features |= CT_CPU_NEON;
+    }
+    if ((hw & HWCAP_SHA2) != 0) {
+        features |= CT_CPU_ARM_SHA2;
+    }
+#endif
+
+    return features;
+}
+
+static int backend_supported(ct_backend_t backend, uint32_t features)
+{
+    switch (backend) {
+    case CT_BACKEND_SCALAR:
+        return 1;
+    case CT_BACKEND_SSE41:
+        return (features & CT_CPU_SSE41) != 0;
+    case CT_BACKEND_AVX2:
+        return (features & CT_CPU_AVX2) != 0;
+    case CT_BACKEND_AVX512:
+        return (features & CT_CPU_AVX512) != 0;
+    default:
+        return 0;
+    }
+}
+
+/*===========================================================================*/
+/* ct_dispatch_build                                                          */
+/*===========================================================================*/
+
+int ct_dispatch_build(ct_dispatch_t *table, ct_backend_t backend, int sha256_accel)
+{
+    uint32_t features = ct_cpu_features();
+
+    ct_kernels_scalar_populate(table);
+    table->cpu_features = features;
+
+    if (!backend_supported(backend, features)) {
+        return -1;
+    }
+
+#if CT_HAVE_X86_KERNELS
+    if (backend != CT_BACKEND_SCALAR) {
+        ct_kernels_x86_populate(table, backend);
+    }
+    if (sha256_accel && (features & CT_CPU_SHANI) != 0) {
+        table->sha256_blocks = ct_sha256_blocks_shani;
+        table->sha256_accel = 1;
+    }
+#else
+    (void)sha256_accel;
+#endif
+
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_dispatch_self_check                                                     */
+/*===========================================================================*/
+
+#define CHECK_EDGES   20
+#define CHECK_PAIRS   (CHECK_EDGES * CHECK_EDGES)
+#define CHECK_CHUNK   16
+
+static const int32_t EDGE_VALUES[CHECK_EDGES] = {
+    0, 1, -1, FIXED_ONE, -FIXED_ONE, FIXED_HALF, -FIXED_HALF,
+    0x7FFF, 0x8000, 0x18000, -0x18000, 0x28000,
+    INT32_MAX, INT32_MIN, INT32_MAX - 1, INT32_MIN + 1,
+    0x7FFF8000, 0x12345678, -0x12345678, 0x01000000
+};
+
+static int faults_equal(const ct_fault_flags_t *a, const ct_fault_flags_t *b)
+{
+    return a->overflow == b->overflow && a->underflow == b->underflow &&
+           a->div_zero == b->div_zero && a->domain == b->domain &&
+           a->precision == b->precision;
+}
+
+static int check_binop(ct_kernel_binop_fn ref, ct_kernel_binop_fn fn,
+                       const int32_t *a, const int32_t *b, uint32_t n)
+{
+    int32_t out_ref[CHECK_CHUNK];
+    int32_t out_fn[CHECK_CHUNK];
+
+    for (uint32_t i = 0; i < n; i += CHECK_CHUNK) {
+        uint32_t len = (n - i < CHECK_CHUNK) ? n - i : CHECK_CHUNK;
+        ct_fault_flags_t f_ref = {0};
+        ct_fault_flags_t f_fn = {0};
+        ref(&a[i], &b[i], out_ref, len, &f_ref);
+        fn(&a[i], &b[i], out_fn, len, &f_fn);
+        if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0 ||
+            !faults_equal(&f_ref, &f_fn)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Unchecked kernels are only defined on inputs the checked reference
+ * handles without a fault: compare them on that subset of the pairs. */
+static int check_unchecked_chunk(const ct_dispatch_t *table, const int32_t *a,
+                                 const int32_t *b, const int32_t *c, uint32_t len)
+{
+    int32_t out_ref[CHECK_CHUNK];
+    int32_t out_fn[CHECK_CHUNK];
+    ct_fault_flags_t f_ref = {0};
+    ct_fault_flags_t f_fn = {0};
+
+    ct_kernel_add32_scalar(a, b, out_ref, len, &f_ref);
+    table->add32_unchecked(a, b, out_fn, len, &f_fn);
+    if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0) {
+        return 0;
+    }
+
+    ct_kernel_normalize_scalar(a, b, c, out_ref, len, &f_ref);
+    table->normalize_unchecked(a, b, c, out_fn, len, &f_fn);
+    if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0) {
+        return 0;
+    }
+
+    return !f_fn.overflow && !f_fn.underflow;
+}
+
+static int check_unchecked(const ct_dispatch_t *table, const int32_t *a,
+                           const int32_t *b, const int32_t *c, uint32_t n)
+{
+    int32_t sa[CHECK_CHUNK];
+    int32_t sb[CHECK_CHUNK];
+    int32_t sc[CHECK_CHUNK];
+    uint32_t len = 0;
+
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t out[2];
+        ct_fault_flags_t f = {0};
+        ct_kernel_add32_scalar(&a[i], &b[i], &out[0], 1, &f);
+        ct_kernel_normalize_scalar(&a[i], &b[i], &c[i], &out[1], 1, &f);
+        if (f.overflow || f.underflow) {
+            continue;
+        }
+
+        sa[len] = a[i];
+        sb[len] = b[i];
+        sc[len] = c[i];
+        if (++len == CHECK_CHUNK) {
+            if (!check_unchecked_chunk(table, sa, sb, sc, len)) {
+                return 0;
+            }
+            len = 0;
+        }
+    }
+
+    return len == 0 || check_unchecked_chunk(table, sa, sb, sc, len);
+}
+
+#define CHECK_EDGES16 16
+#define CHECK_PAIRS16 (CHECK_EDGES16 * CHECK_EDGES16)
+
+static const int16_t EDGE_VALUES16[CHECK_EDGES16] = {
+    0, 1, -1, 0x0100, -0x0100, 0x0080, 0x4000, -0x4000,
+    INT16_MAX, INT16_MIN, INT16_MAX - 1, INT16_MIN + 1,
+    0x00FF, 0x1234, -0x1234, 0x7F80
+};
+
+/* Narrow kernels (CT-MATH-001 §3.10) over every pair of int16 edge values,
+ * at both dtype scales and one invalid scale */
+static int check_narrow(const ct_dispatch_t *table)
+{
+    int16_t a[CHECK_PAIRS16];
+    int16_t b[CHECK_PAIRS16];
+    int16_t c[CHECK_PAIRS16];
+    static const uint32_t FRACS[3] = { CT_FRAC_Q8_8, CT_FRAC_Q1_15, 0 };
+
+    for (uint32_t i = 0; i < CHECK_PAIRS16; i++) {
+        a[i] = EDGE_VALUES16[i / CHECK_EDGES16];
+        b[i] = EDGE_VALUES16[i % CHECK_EDGES16];
+        c[i] = EDGE_VALUES16[(i * 7 + 3) % CHECK_EDGES16];
+    }
+
+    uint32_t n = CHECK_PAIRS16 - 3;
+    for (uint32_t i = 0; i < n; i += CHECK_CHUNK * 2) {
+        uint32_t len = (n - i < CHECK_CHUNK * 2) ? n - i : CHECK_CHUNK * 2;
+        int16_t out_ref[CHECK_CHUNK * 2];
+        int16_t out_fn[CHECK_CHUNK * 2];
+        ct_fault_flags_t f_ref = {0};
+        ct_fault_flags_t f_fn = {0};
+        ct_kernel_add16_scalar(&a[i], &b[i], out_ref, len, &f_ref);
+        table->add16(&a[i], &b[i], out_fn, len, &f_fn);
+        if (memcmp(out_ref, out_fn, len * sizeof(int16_t)) != 0 ||
+            !faults_equal(&f_ref, &f_fn)) {
+            return 0;
+        }
+
+        for (uint32_t f = 0; f < 3; f++) {
+            ct_fault_flags_t g_ref = {0};
+            ct_fault_flags_t g_fn = {0};
+            ct_kernel_normalize16_scalar(&a[i], &b[i], &c[i], out_ref, len, FRACS[f], &g_ref);
+            table->normalize16(&a[i], &b[i], &c[i], out_fn, len, FRACS[f], &g_fn);
+            if (memcmp(out_ref, out_fn, len * sizeof(int16_t)) != 0 ||
+                !faults_equal(&g_ref, &g_fn)) {
+                return 0;
+            }
+        }
+    }
+
+    /* Noise map: uniforms whose top 16 bits run through the edge values */
+    uint64_t u[CHECK_EDGES16 * 2 + 5];
+    uint32_t nu = CHECK_EDGES16 * 2 + 5;
+    for (uint32_t i = 0; i < nu; i++) {
+        uint16_t top = (uint16_t)EDGE_VALUES16[i % CHECK_EDGES16];
+        u[i] = ((uint64_t)top << 48) | (0x0000A5A5A5A5A5A5ULL * (i + 1U) & 0xFFFFFFFFFFFFULL);
+    }
+    for (uint32_t s = 0; s < CHECK_EDGES16; s++) {
+        int16_t out_ref[CHECK_EDGES16 * 2 + 5];
+        int16_t out_fn[CHECK_EDGES16 * 2 + 5];
+        ct_fault_flags_t f_ref = {0};
+        ct_fault_flags_t f_fn = {0};
+        ct_kernel_noise16_scalar(u, out_ref, nu, EDGE_VALUES16[s], &f_ref);
+        table->noise16(u, out_fn, nu, EDGE_VALUES16[s], &f_fn);
+        if (memcmp(out_ref, out_fn, nu * sizeof(int16_t)) != 0 ||
+            !faults_equal(&f_ref, &f_fn)) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Rounding boundaries of the export kernels (CT-MATH-001 §3.11): ties
+ * that stay (even) and round up (odd) at 24 and 8 significant bits,
+ * and carries into the next binade */
+#define CHECK_EXPORT  12
+
+static const int32_t EXPORT_VALUES[CHECK_EXPORT] = {
+    0x00FFFFFF, 0x01000001, 0x01000003, 0x7FFFFF40, 0x7FFFFFC0, -0x7FFFFFC0,
+    0x181, 0x183, 0x1FF, -0x183, 0x00018080, 0x3FFFFF80
+};
+
+/* Export kernels over the edge and boundary values and their neighbours,
+ * compared bitwise */
+static int check_export(const ct_dispatch_t *table)
+{
+    enum { N = (CHECK_EDGES + CHECK_EXPORT) * 3 };
+    int32_t x[N];
+    float f_ref[N];
+    float f_fn[N];
+    double d_ref[N];
+    double d_fn[N];
+    uint16_t h_ref[N];
+    uint16_t h_fn[N];
+
+    for (uint32_t i = 0; i < N; i++) {
+        uint32_t k = i / 3;
+        int32_t v = (k < CHECK_EDGES) ? EDGE_VALUES[k] : EXPORT_VALUES[k - CHECK_EDGES];
+        uint32_t delta = (i % 3 == 0) ? 0U : (i % 3 == 1) ? 1U : 0xFFFFFFFFU;
+        x[i] = (int32_t)((uint32_t)v + delta);
+    }
+
+    /* Odd length exercises the scalar tail of every vector width */
+    uint32_t n = N - 3;
+    ct_kernel_to_f32_scalar(x, f_ref, n);
+    table->to_f32(x, f_fn, n);
+    ct_kernel_to_f64_scalar(x, d_ref, n);
+    table->to_f64(x, d_fn, n);
+    ct_kernel_to_bf16_scalar(x, h_ref, n);
+    table->to_bf16(x, h_fn, n);
+
+    return memcmp(f_ref, f_fn, n * sizeof(float)) == 0 &&
+           memcmp(d_ref, d_fn, n * sizeof(double)) == 0 &&
+           memcmp(h_ref, h_fn, n * sizeof(uint16_t)) == 0;
+}
+
+/* Transpose over shapes that hit full tiles, ragged edges and a block
+ * boundary, dense and strided; whole buffers are compared so a stray
+ * write outside the destination rectangle is caught too */
+#define CHECK_TRANSPOSE_MAX  1024
+
+static int check_transpose(const ct_dispatch_t *table)
+{
+    static const uint32_t SHAPES[8][2] = {
+        { 1, 1 }, { 4, 4 }, { 8, 8 }, { 3, 5 }, { 13, 21 }, { 70, 9 }, { 9, 70 }, { 17, 16 }
+    };
+    int32_t src[CHECK_TRANSPOSE_MAX];
+    int32_t d_ref[CHECK_TRANSPOSE_MAX];
+    int32_t d_fn[CHECK_TRANSPOSE_MAX];
+
+    for (uint32_t i = 0; i < CHECK_TRANSPOSE_MAX; i++) {
+        src[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+    }
+    for (uint32_t k = 0; k < 8; k++) {
+        for (uint32_t pad = 0; pad <= 3; pad += 3) {
+            uint32_t rows = SHAPES[k][0];
+            uint32_t cols = SHAPES[k][1];
+            memset(d_ref, 0x5A, sizeof(d_ref));
+            memset(d_fn, 0x5A, sizeof(d_fn));
+            ct_kernel_transpose32_scalar(src, cols + pad, d_ref, rows + pad, rows, cols);
+            table->transpose32(src, cols + pad, d_fn, rows + pad, rows, cols);
+            if (memcmp(d_ref, d_fn, sizeof(d_ref)) != 0) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Warp rows over an image holding the extreme values, in both border
+ * modes: starts and steps that cross every edge, sit on exact half-pixel
+ * ties and walk far outside the image */
+#define CHECK_WARP_W    11U
+#define CHECK_WARP_H    7U
+#define CHECK_WARP_LEN  37U
+
+static int check_warp(const ct_dispatch_t *table)
+{
+    static const int32_t ROWS[8][4] = {
+        { 0, 0, FIXED_ONE, 0 },
+        { -FIXED_ONE / 2, FIXED_HALF, FIXED_HALF, 0 },
+        { -3 * FIXED_ONE, -2 * FIXED_ONE, 0x4000, 0x2000 },
+        { 0x7FFF, 0x18000, 0x3A5E1, -0x1F00 },
+        { 10 * FIXED_ONE, 6 * FIXED_ONE, -0x8000, -0x8000 },
+        { 5 * FIXED_ONE + 0x8000, -FIXED_ONE, 0xB505, 0xB505 },
+        { 0x3FFFFFFF, -0x40000000, -0x01000000, 0x00C00000 },
+        { 2 * FIXED_ONE + 1, 3 * FIXED_ONE - 1, -0xFFFF, 0x10001 }
+    };
+    int32_t img[CHECK_WARP_W * CHECK_WARP_H];
+    int32_t out_ref[CHECK_WARP_LEN];
+    int32_t out_fn[CHECK_WARP_LEN];
+
+    for (uint32_t i = 0; i < CHECK_WARP_W * CHECK_WARP_H; i++) {
+        img[i] = EDGE_VALUES[(i * 5U + 1U) % CHECK_EDGES];
+    }
+    for (uint32_t k = 0; k < 16; k++) {
+        const int32_t *r = ROWS[k / 2];
+        uint32_t border = (k & 1U) ? CT_WARP_REPLICATE : CT_WARP_ZERO;
+        ct_kernel_warp_row_scalar(img, CHECK_WARP_W, CHECK_WARP_H, border,
+                                  r[0], r[1], r[2], r[3], out_ref, CHECK_WARP_LEN);
+        table->warp_row(img, CHECK_WARP_W, CHECK_WARP_H, border,
+                        r[0], r[1], r[2], r[3], out_fn, CHECK_WARP_LEN);
+        if (memcmp(out_ref, out_fn, sizeof(out_ref)) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Blend every ordered pair of edge values at both end weights, the
+ * half-way tie and weights one step inside each end */
+static int check_lerp(const ct_dispatch_t *table, const int32_t *a, const int32_t *b,
+                      uint32_t n)
+{
+    static const int32_t WEIGHTS[7] = { 0, 1, 0x7FFF, FIXED_HALF, 0x8001, 0xFFFF, FIXED_ONE };
+    for (uint32_t k = 0; k < 7; k++) {
+        for (uint32_t i = 0; i < n; i += CHECK_CHUNK) {
+            uint32_t len = (n - i < CHECK_CHUNK) ? n - i : CHECK_CHUNK;
+            int32_t out_ref[CHECK_CHUNK];
+            int32_t out_fn[CHECK_CHUNK];
+            ct_kernel_lerp_q16_scalar(&a[i], &b[i], WEIGHTS[k], out_ref, len);
+            table->lerp_q16(&a[i], &b[i], WEIGHTS[k], out_fn, len);
+            if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+int ct_dispatch_self_check(const ct_dispatch_t *table)
+{
+    int32_t a[CHECK_PAIRS];
+    int32_t b[CHECK_PAIRS];
+    int32_t c[CHECK_PAIRS];
+
+    /* Every ordered pair of edge values, plus a rotated third operand */
+    for (uint32_t i = 0; i < CHECK_PAIRS; i++) {
+        a[i] = EDGE_VALUES[i / CHECK_EDGES];
+        b[i] = EDGE_VALUES[i % CHECK_EDGES];
+        c[i] = EDGE_VALUES[(i * 7 + 3) % CHECK_EDGES];
+    }
+
+    /* Odd length exercises the scalar tail of every vector width */
+    uint32_t n = CHECK_PAIRS - 3;
+
+    if (!check_binop(ct_kernel_add32_scalar, table->add32, a, b, n) ||
+        !check_binop(ct_kernel_sub32_scalar, table->sub32, a, b, n) ||
+        !check_binop(ct_kernel_mul_q16_scalar, table->mul_q16, a, b, n)) {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < n; i += CHECK_CHUNK) {
+        uint32_t len = (n - i < CHECK_CHUNK) ? n - i : CHECK_CHUNK;
+        int32_t out_ref[CHECK_CHUNK];
+        int32_t out_fn[CHECK_CHUNK];
+        ct_fault_flags_t f_ref = {0};
+        ct_fault_flags_t f_fn = {0};
+        ct_kernel_normalize_scalar(&a[i], &b[i], &c[i], out_ref, len, &f_ref);
+        table->normalize(&a[i], &b[i], &c[i], out_fn, len, &f_fn);
+        if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0 ||
+            !faults_equal(&f_ref, &f_fn)) {
+            return 0;
+        }
+    }
+
+    /* Division by each edge value as an invariant divisor (including 0) */
+    for (uint32_t d = 0; d < CHECK_EDGES; d++) {
+        dvm_divisor_t div;
+        dvm_divisor_init(&div, EDGE_VALUES[d]);
+        for (uint32_t i = 0; i < n; i += CHECK_CHUNK) {
+            uint32_t len = (n - i < CHECK_CHUNK) ? n - i : CHECK_CHUNK;
+            int32_t out_ref[CHECK_CHUNK];
+            int32_t out_fn[CHECK_CHUNK];
+            ct_fault_flags_t f_ref = {0};
+            ct_fault_flags_t f_fn = {0};
+            ct_kernel_div_q16_scalar(&a[i], &div, out_ref, len, &f_ref);
+            table->div_q16(&a[i], &div, out_fn, len, &f_fn);
+            if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0 ||
+                !faults_equal(&f_ref, &f_fn)) {
+                return 0;
+            }
+        }
+    }
+
+    if (!check_unchecked(table, a, b, c, n) || !check_narrow(table) ||
+        !check_export(table) || !check_transpose(table) || !check_warp(table) ||
+        !check_lerp(table, a, b, n)) {
+        return 0;
+    }
+
+    /* PRNG fill, including 32-bit wrap of the op_id counter */
+    uint64_t u_ref[CHECK_EDGES * 2 + 5];
+    uint64_t u_fn[CHECK_EDGES * 2 + 5];
+    uint32_t nu = CHECK_EDGES * 2 + 5;
+    ct_kernel_prng_fill_scalar(u_ref, nu, 0x123456789ABCDEF0ULL, 7, 0x00050000U, 0x1000U);
+    table->prng_fill(u_fn, nu, 0x123456789ABCDEF0ULL, 7, 0x00050000U, 0x1000U);
+    if (memcmp(u_ref, u_fn, sizeof(u_ref)) != 0) {
+        return 0;
+    }
+    ct_kernel_prng_fill_scalar(u_ref, nu, 0xFEDCBA9876543210ULL, 3, 0, 0xFFFFFFF0U);
+    table->prng_fill(u_fn, nu, 0xFEDCBA9876543210ULL, 3, 0, 0xFFFFFFF0U);
+    if (memcmp(u_ref, u_fn, sizeof(u_ref)) != 0) {
+        return 0;
+    }
+
+    /* Strided draws: per-sample op_ids wrapping past 2^32, and an odd stride */
+    ct_kernel_prng_stride_scalar(u_ref, nu, 0x0F1E2D3C4B5A6978ULL, 5, 0xFFFA0100U, 1U << 16);
+    table->prng_stride(u_fn, nu, 0x0F1E2D3C4B5A6978ULL, 5, 0xFFFA0100U, 1U << 16);
+    if (memcmp(u_ref, u_fn, sizeof(u_ref)) != 0) {
+        return 0;
+    }
+    ct_kernel_prng_stride_scalar(u_ref, nu, 0x0F1E2D3C4B5A6978ULL, 5, 0x1234U, 0x9E3779B9U);
+    table->prng_stride(u_fn, nu, 0x0F1E2D3C4B5A6978ULL, 5, 0x1234U, 0x9E3779B9U);
+    if (memcmp(u_ref, u_fn, sizeof(u_ref)) != 0) {
+        return 0;
+    }
+
+    /* Bounded draws: words in the rejection window, bounds near 2^31 where
+     * almost half the words are rejected, and the trivial bounds */
+    u_ref[0] = 0;
+    u_ref[1] = 0xFFFFFFFF00000000ULL;
+    u_ref[2] = 0x00000000FFFFFFFFULL;
+    u_ref[3] = 0x8000000080000000ULL;
+    static const uint32_t BOUNDS[8] = { 0, 1, 2, 3, 1000003U, 65536U, 0x80000001U, 0xFFFFFFFFU };
+    for (uint32_t k = 0; k < 8; k++) {
+        uint32_t b_ref[CHECK_EDGES * 2 + 5];
+        uint32_t b_fn[CHECK_EDGES * 2 + 5];
+        ct_kernel_bound_v2_scalar(u_ref, b_ref, nu, BOUNDS[k]);
+        table->bound_v2(u_ref, b_fn, nu, BOUNDS[k]);
+        if (memcmp(b_ref, b_fn, sizeof(b_ref)) != 0) {
+            return 0;
+        }
+    }
+
+    /* Noise map over PRNG output and extreme uniforms */
+    u_ref[0] = 0;
+    u_ref[1] = 0x8000000000000000ULL;
+    u_ref[2] = 0xFFFFFFFFFFFFFFFFULL;
+    u_ref[3] = 0x7FFFFFFFFFFFFFFFULL;
+    static const int32_t NOISE_STDS[4] = { 1, FIXED_HALF, FIXED_ONE, INT32_MAX };
+    for (uint32_t s = 0; s < 4; s++) {
+        for (uint32_t i = 0; i < nu; i += CHECK_CHUNK) {
+            uint32_t len = (nu - i < CHECK_CHUNK) ? nu - i : CHECK_CHUNK;
+            int32_t out_ref[CHECK_CHUNK];
+            int32_t out_fn[CHECK_CHUNK];
+            ct_fault_flags_t f_ref = {0};
+            ct_fault_flags_t f_fn = {0};
+            ct_kernel_noise_scalar(&u_ref[i], out_ref, len, NOISE_STDS[s], &f_ref);
+            table->noise(&u_ref[i], out_fn, len, NOISE_STDS[s], &f_fn);
+            if (memcmp(out_ref, out_fn, len * sizeof(int32_t)) != 0 ||
+                !faults_equal(&f_ref, &f_fn)) {
+                return 0;
+            }
+        }
+    }
+
+    /* SHA-256 compression over three patterned blocks */
+    uint8_t msg[192];
+    for (uint32_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = (uint8_t)(i * 37U + 11U);
+    }
+    uint32_t s_ref[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+    uint32_t s_fn[8];
+    memcpy(s_fn, s_ref, sizeof(s_ref));
+    ct_sha256_blocks_scalar(s_ref, msg, 3);
+    table->sha256_blocks(s_fn, msg, 3);
+    if (memcmp(s_ref, s_fn, sizeof(s_ref)) != 0) {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*===========================================================================*/
+/* ct_dispatch_init                                                           */
+/*===========================================================================*/
+
+static int parse_backend(const char *name, ct_backend_t *backend)
+{
+    for (uint32_t i = 0; i < CT_BACKEND_COUNT; i++) {
+        if (strcmp(name, BACKEND_NAMES[i]) == 0) {
+            *backend = (ct_backend_t)i;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Fill table with the selected backend; on failure it keeps the scalar
+ * reference. Never calls ct_dispatch_get, so it cannot re-enter init */
+static int select_table(ct_dispatch_t *table)
+{
+    ct_kernels_scalar_populate(table);
+    table->cpu_features = ct_cpu_features();
+
+    uint32_t features = table->cpu_features;
+    ct_backend_t backend = CT_BACKEND_SCALAR;
+    const char *forced = getenv(CT_DISPATCH_ENV);
+
+    if (forced != NULL && forced[0] != '\0') {
+        if (!parse_backend(forced, &backend) || !backend_supported(backend, features)) {
+            return -1;
+        }
+    } else if (backend_supported(CT_BACKEND_AVX512, features)) {
+        backend = CT_BACKEND_AVX512;
+    } else if (backend_supported(CT_BACKEND_AVX2, features)) {
+        backend = CT_BACKEND_AVX2;
+    } else if (backend_supported(CT_BACKEND_SSE41, features)) {
+        backend = CT_BACKEND_SSE41;
+    }
+
+    /* Forcing scalar also forces the scalar SHA-256 compression */
+    ct_dispatch_t candidate;
+    if (ct_dispatch_build(&candidate, backend, backend != CT_BACKEND_SCALAR) != 0) {
+        return -1;
+    }
+
+    if (!ct_dispatch_self_check(&candidate)) {
+        return -1;
+    }
+
+    *table = candidate;
+    return 0;
+}
+
+int ct_dispatch_init(void)
+{
+    int expected = DISPATCH_IDLE;
+    if (!__atomic_compare_exchange_n(&g_state, &expected, DISPATCH_BUSY, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+        /* Selected already, or being selected by another thread: wait */
+        while (__atomic_load_n(&g_state, __ATOMIC_ACQUIRE) != DISPATCH_READY) {
+            /* spin */
+        }
+        return g_status;
+    }
+
+    g_status = select_table(&g_table);
+    __atomic_store_n(&g_state, DISPATCH_READY, __ATOMIC_RELEASE);
+    return g_status;
+}
+
+/*===========================================================================*/
+/* ct_dispatch_get                                                            */
+/*===========================================================================*/
+
+const ct_dispatch_t *ct_dispatch_get(void)
+{
+    if (__atomic_load_n(&g_state, __ATOMIC_ACQUIRE) != DISPATCH_READY) {
+        (void)ct_dispatch_init();
+    }
+    return &g_table;
+}
+
+/*===========================================================================*/
+/* ct_backend_name                                                            */
+/*===========================================================================*/
+
+const char *ct_backend_name(ct_backend_t backend)
+{
+    if ((uint32_t)backend >= CT_BACKEND_COUNT) {
+        return "unknown";
+    }
+    return BACKEND_NAMES[backend];
+}
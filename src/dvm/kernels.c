@@ -0,0 +1,360 @@
+/**
+ * @file kernels.c
+ * @project Certifiable Data Pipeline
+ * @brief Scalar reference bulk kernels.
+ *
+ * @details Each kernel is a plain loop over the DVM primitives. These are the
+ *          normative definitions every accelerated variant is checked against.
+ *
+ * @traceability CT-MATH-001 §3, §3.9, §3.10, §3.11, §4.2, §5, §8.7, §8.9, §14.1,
+ *               §14.5
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "kernels.h"
+#include "dvm.h"
+#include "prng.h"
+#include <string.h>
+
+/*===========================================================================*/
+/* DVM bulk operations (CT-MATH-001 §3)                                      */
+/*===========================================================================*/
+
+void ct_kernel_add32_scalar(const int32_t *a, const int32_t *b,
+                            int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = dvm_add32(a[i], b[i], faults);
+    }
+}
+
+void ct_kernel_sub32_scalar(const int32_t *a, const int32_t *b,
+                            int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = dvm_sub32(a[i], b[i], faults);
+    }
+}
+
+void ct_kernel_mul_q16_scalar(const int32_t *a, const int32_t *b,
+                              int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = dvm_mul_q16(a[i], b[i], faults);
+    }
+}
+
+void ct_kernel_div_q16_scalar(const int32_t *num, const dvm_divisor_t *div,
+                              int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = dvm_div_q16_by(num[i], div, faults);
+    }
+}
+
+/*===========================================================================*/
+/* Normalisation inner loop (CT-MATH-001 §4.2)                               */
+/*===========================================================================*/
+
+void ct_kernel_normalize_scalar(const int32_t *x, const int32_t *means,
+                                const int32_t *inv_stds, int32_t *out,
+                                uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t centered = dvm_sub32(x[i], means[i], faults);
+        out[i] = dvm_mul_q16(centered, inv_stds[i], faults);
+    }
+}
+
+/*===========================================================================*/
+/* PRNG fill (CT-MATH-001 §5)                                                */
+/*===========================================================================*/
+
+void ct_kernel_prng_fill_scalar(uint64_t *out, uint32_t n,
+                                uint64_t seed, uint32_t epoch,
+                                uint32_t op_base, uint32_t op_offset)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = ct_prng(seed, epoch, op_base | (op_offset + i));
+    }
+}
+
+void ct_kernel_prng_stride_scalar(uint64_t *out, uint32_t n,
+                                  uint64_t seed, uint32_t epoch,
+                                  uint32_t op_first, uint32_t op_stride)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = ct_prng(seed, epoch, op_first + i * op_stride);
+    }
+}
+
+void ct_kernel_bound_v2_scalar(const uint64_t *u, uint32_t *out, uint32_t n,
+                               uint32_t bound)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = ct_prng_bound_v2(u[i], bound);
+    }
+}
+
+/*===========================================================================*/
+/* Augmentation noise map (CT-MATH-001 §8.6)                                 */
+/*===========================================================================*/
+
+void ct_kernel_noise_scalar(const uint64_t *u, int32_t *out, uint32_t n,
+                            int32_t noise_std, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        /* Map to [0, 1) in Q16.16 */
+        int32_t u_fixed = (int32_t)((u[i] >> 32) & 0xFFFF0000);
+
+        /* n = std * (u - 0.5) * 2 */
+        int32_t noise = dvm_mul_q16(noise_std, dvm_sub32(u_fixed, FIXED_HALF, faults), faults);
+        out[i] = dvm_add32(noise, noise, faults);
+    }
+}
+
+/*===========================================================================*/
+/* Unchecked kernels (CT-MATH-001 §14.5)                                     */
+/*===========================================================================*/
+
+/* Bit-identical to the checked kernels whenever no intermediate leaves the
+ * int32 range; the planner must have proven that for every input. */
+
+void ct_kernel_add32_unchecked_scalar(const int32_t *a, const int32_t *b,
+                                      int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    (void)faults;
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = (int32_t)((uint32_t)a[i] + (uint32_t)b[i]);
+    }
+}
+
+void ct_kernel_normalize_unchecked_scalar(const int32_t *x, const int32_t *means,
+                                          const int32_t *inv_stds, int32_t *out,
+                                          uint32_t n, ct_fault_flags_t *faults)
+{
+    (void)faults;
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t centered = (int32_t)((uint32_t)x[i] - (uint32_t)means[i]);
+        int64_t p = (int64_t)centered * (int64_t)inv_stds[i];
+
+        /* Round half to even at bit 16 */
+        out[i] = (int32_t)((p + 0x7FFF + ((p >> 16) & 1)) >> 16);
+    }
+}
+
+/*===========================================================================*/
+/* Narrow kernels (CT-MATH-001 §3.10)                                        */
+/*===========================================================================*/
+
+void ct_kernel_add16_scalar(const int16_t *a, const int16_t *b,
+                            int16_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = dvm_add16(a[i], b[i], faults);
+    }
+}
+
+void ct_kernel_normalize16_scalar(const int16_t *x, const int16_t *means,
+                                  const int16_t *inv_stds, int16_t *out,
+                                  uint32_t n, uint32_t frac_bits,
+                                  ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        int16_t centered = dvm_sub16(x[i], means[i], faults);
+        out[i] = dvm_mul_fx16(centered, inv_stds[i], frac_bits, faults);
+    }
+}
+
+void ct_kernel_noise16_scalar(const uint64_t *u, int16_t *out, uint32_t n,
+                              int16_t noise_std, ct_fault_flags_t *faults)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        /* Top 16 bits as Q1.15 in [-1, 1) */
+        int16_t r = (int16_t)(uint16_t)(u[i] >> 48);
+        out[i] = dvm_mul_fx16(noise_std, r, CT_FRAC_Q1_15, faults);
+    }
+}
+
+/*===========================================================================*/
+/* Floating-point export (CT-MATH-001 §3.11)                                 */
+/*===========================================================================*/
+
+/* Rounding is done here in integers, so each conversion below is exact and
+ * the result does not depend on the floating-point environment. */
+
+#define EXPORT_SCALE_F32  (1.0f / 65536.0f)
+#define EXPORT_SCALE_F64  (1.0 / 65536.0)
+
+/* Round magnitude a to p significant bits, ties to even */
+static uint32_t round_sig(uint32_t a, uint32_t p)
+{
+    if (a < (1U << p)) {
+        return a;
+    }
+    uint32_t msb = p;
+    while (msb < 31U && (a >> (msb + 1U)) != 0U) {
+        msb++;
+    }
+    uint32_t shift = msb - (p - 1U);
+    uint32_t half = 1U << (shift - 1U);
+    uint32_t rem = a & ((1U << shift) - 1U);
+    uint32_t q = a >> shift;
+    if (rem > half || (rem == half && (q & 1U) != 0U)) {
+        q++;
+    }
+    return q << shift;
+}
+
+/* Signed Q16.16 with magnitude rounded to p bits, as binary32 */
+static float fixed_to_float(int32_t x, uint32_t p)
+{
+    uint32_t a = (x < 0) ? (0U - (uint32_t)x) : (uint32_t)x;
+    float f = (float)round_sig(a, p) * EXPORT_SCALE_F32;
+    return (x < 0) ? -f : f;
+}
+
+void ct_kernel_to_f32_scalar(const int32_t *x, float *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = fixed_to_float(x[i], 24);
+    }
+}
+
+void ct_kernel_to_f64_scalar(const int32_t *x, double *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = (double)x[i] * EXPORT_SCALE_F64;
+    }
+}
+
+void ct_kernel_to_bf16_scalar(const int32_t *x, uint16_t *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        /* Rounded to 8 bits, so the low half of the binary32 is zero */
+        float f = fixed_to_float(x[i], 8);
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        out[i] = (uint16_t)(bits >> 16);
+    }
+}
+
+/*===========================================================================*/
+/* Transpose                                                                  */
+/*===========================================================================*/
+
+#define TRANSPOSE_TILE  16U
+
+void ct_kernel_transpose32_scalar(const int32_t *src, uint32_t src_stride,
+                                  int32_t *dst, uint32_t dst_stride,
+                                  uint32_t rows, uint32_t cols)
+{
+    /* Tiled so the strided writes of a tile stay in cache */
+    for (uint32_t r0 = 0; r0 < rows; r0 += TRANSPOSE_TILE) {
+        uint32_t r1 = (rows - r0 < TRANSPOSE_TILE) ? rows : r0 + TRANSPOSE_TILE;
+        for (uint32_t c0 = 0; c0 < cols; c0 += TRANSPOSE_TILE) {
+            uint32_t c1 = (cols - c0 < TRANSPOSE_TILE) ? cols : c0 + TRANSPOSE_TILE;
+            for (uint32_t r = r0; r < r1; r++) {
+                for (uint32_t c = c0; c < c1; c++) {
+                    dst[(size_t)c * dst_stride + r] = src[(size_t)r * src_stride + c];
+                }
+            }
+        }
+    }
+}
+
+/*===========================================================================*/
+/* Bilinear warp (CT-MATH-001 §8.7)                                          */
+/*===========================================================================*/
+
+static int32_t warp_tap(const int32_t *src, uint32_t width, uint32_t height,
+                        uint32_t border, int32_t x, int32_t y)
+{
+    if (border == CT_WARP_REPLICATE) {
+        x = (x < 0) ? 0 : ((uint32_t)x >= width) ? (int32_t)width - 1 : x;
+        y = (y < 0) ? 0 : ((uint32_t)y >= height) ? (int32_t)height - 1 : y;
+    } else if (x < 0 || y < 0 || (uint32_t)x >= width || (uint32_t)y >= height) {
+        return 0;
+    }
+    return src[(size_t)y * width + (uint32_t)x];
+}
+
+/* RNE16((2^16 − w)·a + w·b) for w in [0, 2^16]; the result lies between a and b */
+static int32_t warp_lerp(int32_t a, int32_t b, int32_t w)
+{
+    ct_fault_flags_t none = {0};
+    int64_t p = (int64_t)a * (FIXED_ONE - w) + (int64_t)b * w;
+    return dvm_round_shift_rne(p, 16, &none);
+}
+
+void ct_kernel_warp_row_scalar(const int32_t *src, uint32_t width, uint32_t height,
+                               uint32_t border, int32_t sx, int32_t sy,
+                               int32_t dx, int32_t dy, int32_t *out, uint32_t n)
+{
+    if (width == 0 || height == 0) {
+        border = CT_WARP_ZERO;          /* No edge to replicate */
+    }
+    for (uint32_t i = 0; i < n; i++) {
+        /* Coordinates step in wrapping 32-bit arithmetic, as the SIMD lanes do */
+        int32_t x = (int32_t)((uint32_t)sx + i * (uint32_t)dx);
+        int32_t y = (int32_t)((uint32_t)sy + i * (uint32_t)dy);
+        int32_t fx = x & 0xFFFF;
+        int32_t fy = y & 0xFFFF;
+        int32_t x0 = (int32_t)((uint32_t)x - (uint32_t)fx) / FIXED_ONE;
+        int32_t y0 = (int32_t)((uint32_t)y - (uint32_t)fy) / FIXED_ONE;
+
+        int32_t top = warp_lerp(warp_tap(src, width, height, border, x0, y0),
+                                warp_tap(src, width, height, border, x0 + 1, y0), fx);
+        int32_t bottom = warp_lerp(warp_tap(src, width, height, border, x0, y0 + 1),
+                                   warp_tap(src, width, height, border, x0 + 1, y0 + 1), fx);
+        out[i] = warp_lerp(top, bottom, fy);
+    }
+}
+
+/*===========================================================================*/
+/* Sample blending (CT-MATH-001 §8.9)                                        */
+/*===========================================================================*/
+
+void ct_kernel_lerp_q16_scalar(const int32_t *a, const int32_t *b, int32_t t,
+                               int32_t *out, uint32_t n)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = warp_lerp(a[i], b[i], t);
+    }
+}
+
+/*===========================================================================*/
+/* Table population                                                           */
+/*===========================================================================*/
+
+void ct_kernels_scalar_populate(ct_dispatch_t *table)
+{
+    table->backend = CT_BACKEND_SCALAR;
+    table->sha256_accel = 0;
+    table->add32 = ct_kernel_add32_scalar;
+    table->sub32 = ct_kernel_sub32_scalar;
+    table->mul_q16 = ct_kernel_mul_q16_scalar;
+    table->div_q16 = ct_kernel_div_q16_scalar;
+    table->normalize = ct_kernel_normalize_scalar;
+    table->prng_fill = ct_kernel_prng_fill_scalar;
+    table->prng_stride = ct_kernel_prng_stride_scalar;
+    table->bound_v2 = ct_kernel_bound_v2_scalar;
+    table->noise = ct_kernel_noise_scalar;
+    table->sha256_blocks = ct_sha256_blocks_scalar;
+    table->add32_unchecked = ct_kernel_add32_unchecked_scalar;
+    table->normalize_unchecked = ct_kernel_normalize_unchecked_scalar;
+    table->add16 = ct_kernel_add16_scalar;
+    table->normalize16 = ct_kernel_normalize16_scalar;
+    table->noise16 = ct_kernel_noise16_scalar;
+    table->to_f32 = ct_kernel_to_f32_scalar;
+    table->to_f64 = ct_kernel_to_f64_scalar;
+    table->to_bf16 = ct_kernel_to_bf16_scalar;
+    table->transpose32 = ct_kernel_transpose32_scalar;
+    table->warp_row = ct_kernel_warp_row_scalar;
+    table->lerp_q16 = ct_kernel_lerp_q16_scalar;
+}
@@ -0,0 +1,1675 @@
+/**
+ * @file kernels_x86.c
+ * @project Certifiable Data Pipeline
+ * @brief SSE4.1 / AVX2 / AVX-512 bulk kernel variants.
+ *
+ * @details Each variant reproduces the scalar reference in kernels.c exactly,
+ *          including fault flags:
+ *          - Saturating add/sub detect signed wrap and substitute the DVM
+ *            clamp value of the same sign as the first operand.
+ *          - Q16.16 multiply widens to 64 bits per lane and applies
+ *            RNE as (p + 0x7FFF + bit16(p)) >> 16, which equals
+ *            DVM_RoundShiftR_RNE(p, 16) for |p| ≤ 2^62.
+ *          - Narrow (int16) kernels have AVX2 and AVX-512BW variants only;
+ *            SSE4.1 tables keep the scalar reference for them.
+ *          - Floating-point export rounds in integers and needs per-lane
+ *            variable shifts, so it too is AVX2 / AVX-512 only.
+ *          - Transpose only moves data and is bound by memory traffic;
+ *            AVX-512 tables keep the AVX2 8×8 register tile.
+ *          Tails shorter than one vector use the scalar reference.
+ *          Functions are compiled with per-function target attributes so the
+ *          library itself needs no ISA-specific compiler flags.
+ *
+ * @traceability CT-MATH-001 §3, §3.10, §3.11, §4.2, §5, §8.7, §8.9, §14.1
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#include "kernels.h"
+#include "prng.h"
+
+#if CT_HAVE_X86_KERNELS
+
+#include <immintrin.h>
+
+#define CT_TARGET_SSE41   __attribute__((target("sse4.1")))
+#define CT_TARGET_AVX2    __attribute__((target("avx2")))
+#define CT_TARGET_AVX512  __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+
+/* SplitMix64 constants (CT-MATH-001 §5.3) */
+#define SM_GAMMA  0x9E3779B97F4A7C15ULL
+#define SM_MUL1   0xBF58476D1CE4E5B9ULL
+#define SM_MUL2   0x94D049BB133111EBULL
+
+/*===========================================================================*/
+/* SSE4.1 helpers (4 lanes)                                                   */
+/*===========================================================================*/
+
+static inline CT_TARGET_SSE41 __m128i sat_add_sse41(__m128i a, __m128i b,
+                                                    __m128i *ov, __m128i *un)
+{
+    __m128i sum = _mm_add_epi32(a, b);
+    __m128i wrap = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, sum),
+                                                _mm_xor_si128(b, sum)), 31);
+    __m128i neg = _mm_srai_epi32(a, 31);
+    __m128i sat = _mm_xor_si128(neg, _mm_set1_epi32(INT32_MAX));
+    *ov = _mm_or_si128(*ov, _mm_andnot_si128(neg, wrap));
+    *un = _mm_or_si128(*un, _mm_and_si128(neg, wrap));
+    return _mm_blendv_epi8(sum, sat, wrap);
+}
+
+static inline CT_TARGET_SSE41 __m128i sat_sub_sse41(__m128i a, __m128i b,
+                                                    __m128i *ov, __m128i *un)
+{
+    __m128i diff = _mm_sub_epi32(a, b);
+    __m128i wrap = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, b),
+                                                _mm_xor_si128(a, diff)), 31);
+    __m128i neg = _mm_srai_epi32(a, 31);
+    __m128i sat = _mm_xor_si128(neg, _mm_set1_epi32(INT32_MAX));
+    *ov = _mm_or_si128(*ov, _mm_andnot_si128(neg, wrap));
+    *un = _mm_or_si128(*un, _mm_and_si128(neg, wrap));
+    return _mm_blendv_epi8(diff, sat, wrap);
+}
+
+/* RNE >> 16 and clamp of two int64 lanes (no 64-bit compare in SSE4.1) */
+static inline CT_TARGET_SSE41 __m128i rne16_clamp_sse41(__m128i p, __m128i *ov, __m128i *un)
+{
+    __m128i bit = _mm_and_si128(_mm_srli_epi64(p, 16), _mm_set1_epi64x(1));
+    __m128i t = _mm_add_epi64(p, _mm_add_epi64(bit, _mm_set1_epi64x(0x7FFF)));
+    __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(t, 31), _MM_SHUFFLE(3, 3, 1, 1));
+    __m128i q = _mm_or_si128(_mm_srli_epi64(t, 16), _mm_slli_epi64(sign, 48));
+
+    /* q fits in int32 iff it equals the sign extension of its low half */
+    __m128i ext = _mm_blend_epi16(q, _mm_shuffle_epi32(_mm_srai_epi32(q, 31),
+                                                       _MM_SHUFFLE(2, 2, 0, 0)), 0xCC);
+    __m128i bad = _mm_xor_si128(_mm_cmpeq_epi64(ext, q), _mm_set1_epi32(-1));
+    __m128i qsign = _mm_shuffle_epi32(_mm_srai_epi32(q, 31), _MM_SHUFFLE(3, 3, 1, 1));
+    __m128i sat = _mm_xor_si128(qsign, _mm_set1_epi64x(INT32_MAX));
+    *ov = _mm_or_si128(*ov, _mm_andnot_si128(qsign, bad));
+    *un = _mm_or_si128(*un, _mm_and_si128(qsign, bad));
+    return _mm_blendv_epi8(q, sat, bad);
+}
+
+static inline CT_TARGET_SSE41 __m128i mul_q16_sse41(__m128i a, __m128i b,
+                                                    __m128i *ov, __m128i *un)
+{
+    __m128i pe = _mm_mul_epi32(a, b);
+    __m128i po = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    pe = rne16_clamp_sse41(pe, ov, un);
+    po = rne16_clamp_sse41(po, ov, un);
+    return _mm_blend_epi16(pe, _mm_slli_epi64(po, 32), 0xCC);
+}
+
+static inline CT_TARGET_SSE41 void faults_sse41(__m128i ov, __m128i un,
+                                                ct_fault_flags_t *faults)
+{
+    if (!_mm_testz_si128(ov, ov)) {
+        faults->overflow = 1;
+    }
+    if (!_mm_testz_si128(un, un)) {
+        faults->underflow = 1;
+    }
+}
+
+/*===========================================================================*/
+/* SSE4.1 kernels                                                             */
+/*===========================================================================*/
+
+static CT_TARGET_SSE41 void add32_sse41(const int32_t *a, const int32_t *b,
+                                        int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m128i ov = _mm_setzero_si128();
+    __m128i un = _mm_setzero_si128();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)&a[i]);
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)&b[i]);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], sat_add_sse41(va, vb, &ov, &un));
+    }
+    faults_sse41(ov, un, faults);
+    ct_kernel_add32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void sub32_sse41(const int32_t *a, const int32_t *b,
+                                        int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m128i ov = _mm_setzero_si128();
+    __m128i un = _mm_setzero_si128();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)&a[i]);
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)&b[i]);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], sat_sub_sse41(va, vb, &ov, &un));
+    }
+    faults_sse41(ov, un, faults);
+    ct_kernel_sub32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void mul_q16_sse41_k(const int32_t *a, const int32_t *b,
+                                            int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m128i ov = _mm_setzero_si128();
+    __m128i un = _mm_setzero_si128();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)&a[i]);
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)&b[i]);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], mul_q16_sse41(va, vb, &ov, &un));
+    }
+    faults_sse41(ov, un, faults);
+    ct_kernel_mul_q16_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void normalize_sse41(const int32_t *x, const int32_t *means,
+                                            const int32_t *inv_stds, int32_t *out,
+                                            uint32_t n, ct_fault_flags_t *faults)
+{
+    __m128i ov = _mm_setzero_si128();
+    __m128i un = _mm_setzero_si128();
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i vx = _mm_loadu_si128((const __m128i *)(const void *)&x[i]);
+        __m128i vm = _mm_loadu_si128((const __m128i *)(const void *)&means[i]);
+        __m128i vs = _mm_loadu_si128((const __m128i *)(const void *)&inv_stds[i]);
+        __m128i c = sat_sub_sse41(vx, vm, &ov, &un);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], mul_q16_sse41(c, vs, &ov, &un));
+    }
+    faults_sse41(ov, un, faults);
+    ct_kernel_normalize_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void add32_unchecked_sse41(const int32_t *a, const int32_t *b,
+                                                  int32_t *out, uint32_t n,
+                                                  ct_fault_flags_t *faults)
+{
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)&a[i]);
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)&b[i]);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], _mm_add_epi32(va, vb));
+    }
+    ct_kernel_add32_unchecked_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void normalize_unchecked_sse41(const int32_t *x, const int32_t *means,
+                                                      const int32_t *inv_stds, int32_t *out,
+                                                      uint32_t n, ct_fault_flags_t *faults)
+{
+    __m128i bias = _mm_set1_epi64x(0x7FFF);
+    __m128i one = _mm_set1_epi64x(1);
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i vx = _mm_loadu_si128((const __m128i *)(const void *)&x[i]);
+        __m128i vm = _mm_loadu_si128((const __m128i *)(const void *)&means[i]);
+        __m128i vs = _mm_loadu_si128((const __m128i *)(const void *)&inv_stds[i]);
+        __m128i c = _mm_sub_epi32(vx, vm);
+        __m128i pe = _mm_mul_epi32(c, vs);
+        __m128i po = _mm_mul_epi32(_mm_srli_epi64(c, 32), _mm_srli_epi64(vs, 32));
+        pe = _mm_add_epi64(pe, _mm_add_epi64(bias, _mm_and_si128(_mm_srli_epi64(pe, 16), one)));
+        po = _mm_add_epi64(po, _mm_add_epi64(bias, _mm_and_si128(_mm_srli_epi64(po, 16), one)));
+        /* Results fit in int32: bits 16..47 of each product are the answer */
+        __m128i q = _mm_blend_epi16(_mm_srli_epi64(pe, 16), _mm_slli_epi64(po, 16), 0xCC);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], q);
+    }
+    ct_kernel_normalize_unchecked_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_SSE41 void noise_sse41(const uint64_t *u, int32_t *out, uint32_t n,
+                                        int32_t noise_std, ct_fault_flags_t *faults)
+{
+    __m128i ov = _mm_setzero_si128();
+    __m128i un = _mm_setzero_si128();
+    __m128i vstd = _mm_set1_epi32(noise_std);
+    __m128i half = _mm_set1_epi32(FIXED_HALF);
+    __m128i mask = _mm_set1_epi32((int32_t)0xFFFF0000U);
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 lo = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(const void *)&u[i]));
+        __m128 hi = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(const void *)&u[i + 2]));
+        __m128i top = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+        __m128i c = sat_sub_sse41(_mm_and_si128(top, mask), half, &ov, &un);
+        __m128i m = mul_q16_sse41(vstd, c, &ov, &un);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], sat_add_sse41(m, m, &ov, &un));
+    }
+    faults_sse41(ov, un, faults);
+    ct_kernel_noise_scalar(&u[i], &out[i], n - i, noise_std, faults);
+}
+
+/*===========================================================================*/
+/* AVX2 helpers (8 lanes)                                                     */
+/*===========================================================================*/
+
+static inline CT_TARGET_AVX2 __m256i sat_add_avx2(__m256i a, __m256i b,
+                                                  __m256i *ov, __m256i *un)
+{
+    __m256i sum = _mm256_add_epi32(a, b);
+    __m256i wrap = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(a, sum),
+                                                      _mm256_xor_si256(b, sum)), 31);
+    __m256i neg = _mm256_srai_epi32(a, 31);
+    __m256i sat = _mm256_xor_si256(neg, _mm256_set1_epi32(INT32_MAX));
+    *ov = _mm256_or_si256(*ov, _mm256_andnot_si256(neg, wrap));
+    *un = _mm256_or_si256(*un, _mm256_and_si256(neg, wrap));
+    return _mm256_blendv_epi8(sum, sat, wrap);
+}
+
+static inline CT_TARGET_AVX2 __m256i sat_sub_avx2(__m256i a, __m256i b,
+                                                  __m256i *ov, __m256i *un)
+{
+    __m256i diff = _mm256_sub_epi32(a, b);
+    __m256i wrap = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(a, b),
+                                                      _mm256_xor_si256(a, diff)), 31);
+    __m256i neg = _mm256_srai_epi32(a, 31);
+    __m256i sat = _mm256_xor_si256(neg, _mm256_set1_epi32(INT32_MAX));
+    *ov = _mm256_or_si256(*ov, _mm256_andnot_si256(neg, wrap));
+    *un = _mm256_or_si256(*un, _mm256_and_si256(neg, wrap));
+    return _mm256_blendv_epi8(diff, sat, wrap);
+}
+
+static inline CT_TARGET_AVX2 __m256i rne16_clamp_avx2(__m256i p, __m256i *ov, __m256i *un)
+{
+    __m256i bit = _mm256_and_si256(_mm256_srli_epi64(p, 16), _mm256_set1_epi64x(1));
+    __m256i t = _mm256_add_epi64(p, _mm256_add_epi64(bit, _mm256_set1_epi64x(0x7FFF)));
+    __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), t);
+    __m256i q = _mm256_or_si256(_mm256_srli_epi64(t, 16), _mm256_slli_epi64(sign, 48));
+    __m256i hi = _mm256_cmpgt_epi64(q, _mm256_set1_epi64x(INT32_MAX));
+    __m256i lo = _mm256_cmpgt_epi64(_mm256_set1_epi64x(INT32_MIN), q);
+    *ov = _mm256_or_si256(*ov, hi);
+    *un = _mm256_or_si256(*un, lo);
+    q = _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MAX), hi);
+    return _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MIN), lo);
+}
+
+static inline CT_TARGET_AVX2 __m256i mul_q16_avx2(__m256i a, __m256i b,
+                                                  __m256i *ov, __m256i *un)
+{
+    __m256i pe = _mm256_mul_epi32(a, b);
+    __m256i po = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    pe = rne16_clamp_avx2(pe, ov, un);
+    po = rne16_clamp_avx2(po, ov, un);
+    return _mm256_blend_epi32(pe, _mm256_slli_epi64(po, 32), 0xAA);
+}
+
+/* |num| lanes (low dwords of x) divided by an invariant divisor, signed and
+ * clamped to int32 in each 64-bit lane (see dvm_div_q16_by) */
+static inline CT_TARGET_AVX2 __m256i div_lanes_avx2(__m256i x, __m256i neg,
+                                                    __m256i mlo, __m256i mhi, __m128i shift,
+                                                    __m256i *ov, __m256i *un)
+{
+    __m256i lo = _mm256_mul_epu32(x, mlo);
+    __m256i hi = _mm256_mul_epu32(x, mhi);
+    __m256i q = _mm256_srl_epi64(_mm256_add_epi64(hi, _mm256_srli_epi64(lo, 32)), shift);
+    q = _mm256_sub_epi64(_mm256_xor_si256(q, neg), neg);
+
+    __m256i big = _mm256_cmpgt_epi64(q, _mm256_set1_epi64x(INT32_MAX));
+    __m256i small = _mm256_cmpgt_epi64(_mm256_set1_epi64x(INT32_MIN), q);
+    *ov = _mm256_or_si256(*ov, big);
+    *un = _mm256_or_si256(*un, small);
+    q = _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MAX), big);
+    return _mm256_blendv_epi8(q, _mm256_set1_epi64x(INT32_MIN), small);
+}
+
+/* Low 64 bits of x × c (AVX2 has no 64-bit multiply) */
+static inline CT_TARGET_AVX2 __m256i mullo64_avx2(__m256i x, __m256i c)
+{
+    __m256i lo = _mm256_mul_epu32(x, c);
+    __m256i t1 = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), c);
+    __m256i t2 = _mm256_mul_epu32(x, _mm256_srli_epi64(c, 32));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(_mm256_add_epi64(t1, t2), 32));
+}
+
+static inline CT_TARGET_AVX2 __m256i splitmix64_avx2(__m256i x)
+{
+    x = _mm256_add_epi64(x, _mm256_set1_epi64x((long long)SM_GAMMA));
+    x = mullo64_avx2(_mm256_xor_si256(x, _mm256_srli_epi64(x, 30)),
+                     _mm256_set1_epi64x((long long)SM_MUL1));
+    x = mullo64_avx2(_mm256_xor_si256(x, _mm256_srli_epi64(x, 27)),
+                     _mm256_set1_epi64x((long long)SM_MUL2));
+    return _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+}
+
+static inline CT_TARGET_AVX2 void faults_avx2(__m256i ov, __m256i un,
+                                              ct_fault_flags_t *faults)
+{
+    if (!_mm256_testz_si256(ov, ov)) {
+        faults->overflow = 1;
+    }
+    if (!_mm256_testz_si256(un, un)) {
+        faults->underflow = 1;
+    }
+}
+
+/*===========================================================================*/
+/* AVX2 kernels                                                               */
+/*===========================================================================*/
+
+static CT_TARGET_AVX2 void add32_avx2(const int32_t *a, const int32_t *b,
+                                      int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], sat_add_avx2(va, vb, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_add32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void sub32_avx2(const int32_t *a, const int32_t *b,
+                                      int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], sat_sub_avx2(va, vb, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_sub32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void mul_q16_avx2_k(const int32_t *a, const int32_t *b,
+                                          int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], mul_q16_avx2(va, vb, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_mul_q16_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void div_q16_avx2(const int32_t *num, const dvm_divisor_t *div,
+                                        int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    uint32_t i = 0;
+    if (div->denom != 0) {
+        __m256i ov = _mm256_setzero_si256();
+        __m256i un = _mm256_setzero_si256();
+        __m256i mlo = _mm256_set1_epi64x((long long)(div->magic & 0xFFFFFFFFULL));
+        __m256i mhi = _mm256_set1_epi64x((long long)(div->magic >> 32));
+        __m128i shift = _mm_cvtsi32_si128((int)div->shift);
+        __m256i dneg = _mm256_set1_epi32(div->negative ? -1 : 0);
+        for (; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256((const __m256i *)(const void *)&num[i]);
+            __m256i x = _mm256_abs_epi32(v);
+            __m256i neg = _mm256_xor_si256(_mm256_srai_epi32(v, 31), dneg);
+            __m256i qe = div_lanes_avx2(x, _mm256_shuffle_epi32(neg, _MM_SHUFFLE(2, 2, 0, 0)),
+                                        mlo, mhi, shift, &ov, &un);
+            __m256i qo = div_lanes_avx2(_mm256_srli_epi64(x, 32),
+                                        _mm256_shuffle_epi32(neg, _MM_SHUFFLE(3, 3, 1, 1)),
+                                        mlo, mhi, shift, &ov, &un);
+            _mm256_storeu_si256((__m256i *)(void *)&out[i],
+                                _mm256_blend_epi32(qe, _mm256_slli_epi64(qo, 32), 0xAA));
+        }
+        faults_avx2(ov, un, faults);
+    }
+    ct_kernel_div_q16_scalar(&num[i], div, &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void normalize_avx2(const int32_t *x, const int32_t *means,
+                                          const int32_t *inv_stds, int32_t *out,
+                                          uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        __m256i vm = _mm256_loadu_si256((const __m256i *)(const void *)&means[i]);
+        __m256i vs = _mm256_loadu_si256((const __m256i *)(const void *)&inv_stds[i]);
+        __m256i c = sat_sub_avx2(vx, vm, &ov, &un);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], mul_q16_avx2(c, vs, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_normalize_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void add32_unchecked_avx2(const int32_t *a, const int32_t *b,
+                                                int32_t *out, uint32_t n,
+                                                ct_fault_flags_t *faults)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], _mm256_add_epi32(va, vb));
+    }
+    ct_kernel_add32_unchecked_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void normalize_unchecked_avx2(const int32_t *x, const int32_t *means,
+                                                    const int32_t *inv_stds, int32_t *out,
+                                                    uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i bias = _mm256_set1_epi64x(0x7FFF);
+    __m256i one = _mm256_set1_epi64x(1);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        __m256i vm = _mm256_loadu_si256((const __m256i *)(const void *)&means[i]);
+        __m256i vs = _mm256_loadu_si256((const __m256i *)(const void *)&inv_stds[i]);
+        __m256i c = _mm256_sub_epi32(vx, vm);
+        __m256i pe = _mm256_mul_epi32(c, vs);
+        __m256i po = _mm256_mul_epi32(_mm256_srli_epi64(c, 32), _mm256_srli_epi64(vs, 32));
+        pe = _mm256_add_epi64(pe, _mm256_add_epi64(bias,
+                              _mm256_and_si256(_mm256_srli_epi64(pe, 16), one)));
+        po = _mm256_add_epi64(po, _mm256_add_epi64(bias,
+                              _mm256_and_si256(_mm256_srli_epi64(po, 16), one)));
+        __m256i q = _mm256_blend_epi32(_mm256_srli_epi64(pe, 16), _mm256_slli_epi64(po, 16), 0xAA);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], q);
+    }
+    ct_kernel_normalize_unchecked_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void prng_fill_avx2(uint64_t *out, uint32_t n,
+                                          uint64_t seed, uint32_t epoch,
+                                          uint32_t op_base, uint32_t op_offset)
+{
+    __m256i key = _mm256_set1_epi64x((long long)(seed ^ (((uint64_t)epoch) << 32)));
+    __m128i base = _mm_set1_epi32((int32_t)op_base);
+    __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i off = _mm_add_epi32(_mm_set1_epi32((int32_t)(op_offset + i)), lane);
+        __m256i op = _mm256_cvtepu32_epi64(_mm_or_si128(base, off));
+        __m256i x = splitmix64_avx2(splitmix64_avx2(_mm256_xor_si256(key, op)));
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], x);
+    }
+    ct_kernel_prng_fill_scalar(&out[i], n - i, seed, epoch, op_base, op_offset + i);
+}
+
+static CT_TARGET_AVX2 void prng_stride_avx2(uint64_t *out, uint32_t n,
+                                            uint64_t seed, uint32_t epoch,
+                                            uint32_t op_first, uint32_t op_stride)
+{
+    __m256i key = _mm256_set1_epi64x((long long)(seed ^ (((uint64_t)epoch) << 32)));
+    __m128i op = _mm_add_epi32(_mm_set1_epi32((int32_t)op_first),
+                               _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3),
+                                               _mm_set1_epi32((int32_t)op_stride)));
+    __m128i step = _mm_set1_epi32((int32_t)(op_stride * 4U));
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_xor_si256(key, _mm256_cvtepu32_epi64(op));
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], splitmix64_avx2(splitmix64_avx2(x)));
+        op = _mm_add_epi32(op, step);
+    }
+    ct_kernel_prng_stride_scalar(&out[i], n - i, seed, epoch, op_first + i * op_stride, op_stride);
+}
+
+static CT_TARGET_AVX2 void noise_avx2(const uint64_t *u, int32_t *out, uint32_t n,
+                                      int32_t noise_std, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    __m256i vstd = _mm256_set1_epi32(noise_std);
+    __m256i half = _mm256_set1_epi32(FIXED_HALF);
+    __m256i mask = _mm256_set1_epi32((int32_t)0xFFFF0000U);
+    __m256i odd = _mm256_setr_epi32(1, 3, 5, 7, 0, 0, 0, 0);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i lo = _mm256_loadu_si256((const __m256i *)(const void *)&u[i]);
+        __m256i hi = _mm256_loadu_si256((const __m256i *)(const void *)&u[i + 4]);
+        __m128i tlo = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(lo, odd));
+        __m128i thi = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(hi, odd));
+        __m256i top = _mm256_inserti128_si256(_mm256_castsi128_si256(tlo), thi, 1);
+        __m256i c = sat_sub_avx2(_mm256_and_si256(top, mask), half, &ov, &un);
+        __m256i m = mul_q16_avx2(vstd, c, &ov, &un);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], sat_add_avx2(m, m, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_noise_scalar(&u[i], &out[i], n - i, noise_std, faults);
+}
+
+/*===========================================================================*/
+/* AVX2 narrow kernels (16 lanes, CT-MATH-001 §3.10)                          */
+/*===========================================================================*/
+
+/* Saturating int16 add/sub: lanes where the saturating and wrapping results
+ * differ are exactly the lanes dvm_clamp16 would clamp */
+static inline CT_TARGET_AVX2 __m256i sat_add16_avx2(__m256i a, __m256i b,
+                                                    __m256i *ov, __m256i *un)
+{
+    __m256i sat = _mm256_adds_epi16(a, b);
+    __m256i same = _mm256_cmpeq_epi16(sat, _mm256_add_epi16(a, b));
+    *ov = _mm256_or_si256(*ov, _mm256_andnot_si256(same,
+              _mm256_cmpeq_epi16(sat, _mm256_set1_epi16(INT16_MAX))));
+    *un = _mm256_or_si256(*un, _mm256_andnot_si256(same,
+              _mm256_cmpeq_epi16(sat, _mm256_set1_epi16(INT16_MIN))));
+    return sat;
+}
+
+static inline CT_TARGET_AVX2 __m256i sat_sub16_avx2(__m256i a, __m256i b,
+                                                    __m256i *ov, __m256i *un)
+{
+    __m256i sat = _mm256_subs_epi16(a, b);
+    __m256i same = _mm256_cmpeq_epi16(sat, _mm256_sub_epi16(a, b));
+    *ov = _mm256_or_si256(*ov, _mm256_andnot_si256(same,
+              _mm256_cmpeq_epi16(sat, _mm256_set1_epi16(INT16_MAX))));
+    *un = _mm256_or_si256(*un, _mm256_andnot_si256(same,
+              _mm256_cmpeq_epi16(sat, _mm256_set1_epi16(INT16_MIN))));
+    return sat;
+}
+
+/* RNE shift of exact 32-bit products, faults for results outside int16 */
+static inline CT_TARGET_AVX2 __m256i rne_fx16_avx2(__m256i p, __m128i shift,
+                                                   __m256i mask, __m256i half,
+                                                   __m256i *ov, __m256i *un)
+{
+    __m256i q = _mm256_sra_epi32(p, shift);
+    __m256i frac = _mm256_and_si256(p, mask);
+    __m256i odd = _mm256_and_si256(q, _mm256_set1_epi32(1));
+    q = _mm256_sub_epi32(q, _mm256_cmpgt_epi32(_mm256_add_epi32(frac, odd), half));
+    *ov = _mm256_or_si256(*ov, _mm256_cmpgt_epi32(q, _mm256_set1_epi32(INT16_MAX)));
+    *un = _mm256_or_si256(*un, _mm256_cmpgt_epi32(_mm256_set1_epi32(INT16_MIN), q));
+    return q;
+}
+
+static inline CT_TARGET_AVX2 __m256i mul_fx16_avx2(__m256i a, __m256i b, uint32_t frac_bits,
+                                                   __m256i *ov, __m256i *un)
+{
+    __m128i shift = _mm_cvtsi32_si128((int)frac_bits);
+    __m256i mask = _mm256_set1_epi32((int32_t)((1U << frac_bits) - 1U));
+    __m256i half = _mm256_set1_epi32((int32_t)(1U << (frac_bits - 1U)));
+    __m256i lo = _mm256_mullo_epi16(a, b);
+    __m256i hi = _mm256_mulhi_epi16(a, b);
+
+    /* Unpack and pack both work per 128-bit lane, so lane order survives */
+    __m256i q0 = rne_fx16_avx2(_mm256_unpacklo_epi16(lo, hi), shift, mask, half, ov, un);
+    __m256i q1 = rne_fx16_avx2(_mm256_unpackhi_epi16(lo, hi), shift, mask, half, ov, un);
+    return _mm256_packs_epi32(q0, q1);
+}
+
+static CT_TARGET_AVX2 void add16_avx2(const int16_t *a, const int16_t *b,
+                                      int16_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], sat_add16_avx2(va, vb, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_add16_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX2 void normalize16_avx2(const int16_t *x, const int16_t *means,
+                                            const int16_t *inv_stds, int16_t *out,
+                                            uint32_t n, uint32_t frac_bits,
+                                            ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    uint32_t i = 0;
+    if (frac_bits >= 1 && frac_bits <= 15) {
+        for (; i + 16 <= n; i += 16) {
+            __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+            __m256i vm = _mm256_loadu_si256((const __m256i *)(const void *)&means[i]);
+            __m256i vs = _mm256_loadu_si256((const __m256i *)(const void *)&inv_stds[i]);
+            __m256i c = sat_sub16_avx2(vx, vm, &ov, &un);
+            _mm256_storeu_si256((__m256i *)(void *)&out[i],
+                                mul_fx16_avx2(c, vs, frac_bits, &ov, &un));
+        }
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_normalize16_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i,
+                                 frac_bits, faults);
+}
+
+static CT_TARGET_AVX2 void noise16_avx2(const uint64_t *u, int16_t *out, uint32_t n,
+                                        int16_t noise_std, ct_fault_flags_t *faults)
+{
+    __m256i ov = _mm256_setzero_si256();
+    __m256i un = _mm256_setzero_si256();
+    __m256i vstd = _mm256_set1_epi16(noise_std);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        int16_t r[16];
+        for (uint32_t j = 0; j < 16; j++) {
+            r[j] = (int16_t)(uint16_t)(u[i + j] >> 48);
+        }
+        __m256i vr = _mm256_loadu_si256((const __m256i *)(const void *)r);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i],
+                            mul_fx16_avx2(vstd, vr, CT_FRAC_Q1_15, &ov, &un));
+    }
+    faults_avx2(ov, un, faults);
+    ct_kernel_noise16_scalar(&u[i], &out[i], n - i, noise_std, faults);
+}
+
+/*===========================================================================*/
+/* AVX-512 helpers (16 lanes)                                                 */
+/*===========================================================================*/
+
+static inline CT_TARGET_AVX512 __m512i sat_add_avx512(__m512i a, __m512i b,
+                                                      __mmask16 *ov, __mmask16 *un)
+{
+    __m512i sum = _mm512_add_epi32(a, b);
+    __mmask16 wrap = _mm512_movepi32_mask(_mm512_and_si512(_mm512_xor_si512(a, sum),
+                                                           _mm512_xor_si512(b, sum)));
+    __mmask16 neg = _mm512_movepi32_mask(a);
+    __m512i sat = _mm512_mask_blend_epi32(neg, _mm512_set1_epi32(INT32_MAX),
+                                          _mm512_set1_epi32(INT32_MIN));
+    *ov = (__mmask16)(*ov | (wrap & (__mmask16)~neg));
+    *un = (__mmask16)(*un | (wrap & neg));
+    return _mm512_mask_blend_epi32(wrap, sum, sat);
+}
+
+static inline CT_TARGET_AVX512 __m512i sat_sub_avx512(__m512i a, __m512i b,
+                                                      __mmask16 *ov, __mmask16 *un)
+{
+    __m512i diff = _mm512_sub_epi32(a, b);
+    __mmask16 wrap = _mm512_movepi32_mask(_mm512_and_si512(_mm512_xor_si512(a, b),
+                                                           _mm512_xor_si512(a, diff)));
+    __mmask16 neg = _mm512_movepi32_mask(a);
+    __m512i sat = _mm512_mask_blend_epi32(neg, _mm512_set1_epi32(INT32_MAX),
+                                          _mm512_set1_epi32(INT32_MIN));
+    *ov = (__mmask16)(*ov | (wrap & (__mmask16)~neg));
+    *un = (__mmask16)(*un | (wrap & neg));
+    return _mm512_mask_blend_epi32(wrap, diff, sat);
+}
+
+static inline CT_TARGET_AVX512 __m512i rne16_clamp_avx512(__m512i p,
+                                                          __mmask16 *ov, __mmask16 *un)
+{
+    __m512i bit = _mm512_and_si512(_mm512_srli_epi64(p, 16), _mm512_set1_epi64(1));
+    __m512i t = _mm512_add_epi64(p, _mm512_add_epi64(bit, _mm512_set1_epi64(0x7FFF)));
+    __m512i q = _mm512_srai_epi64(t, 16);
+    __m512i max = _mm512_set1_epi64(INT32_MAX);
+    __m512i min = _mm512_set1_epi64(INT32_MIN);
+    *ov = (__mmask16)(*ov | _mm512_cmpgt_epi64_mask(q, max));
+    *un = (__mmask16)(*un | _mm512_cmplt_epi64_mask(q, min));
+    return _mm512_max_epi64(_mm512_min_epi64(q, max), min);
+}
+
+static inline CT_TARGET_AVX512 __m512i mul_q16_avx512(__m512i a, __m512i b,
+                                                      __mmask16 *ov, __mmask16 *un)
+{
+    __m512i pe = _mm512_mul_epi32(a, b);
+    __m512i po = _mm512_mul_epi32(_mm512_srli_epi64(a, 32), _mm512_srli_epi64(b, 32));
+    pe = rne16_clamp_avx512(pe, ov, un);
+    po = rne16_clamp_avx512(po, ov, un);
+    return _mm512_mask_blend_epi32(0xAAAA, pe, _mm512_slli_epi64(po, 32));
+}
+
+static inline CT_TARGET_AVX512 __m512i div_lanes_avx512(__m512i x, __mmask8 neg,
+                                                        __m512i mlo, __m512i mhi, __m128i shift,
+                                                        __mmask16 *ov, __mmask16 *un)
+{
+    __m512i lo = _mm512_mul_epu32(x, mlo);
+    __m512i hi = _mm512_mul_epu32(x, mhi);
+    __m512i q = _mm512_srl_epi64(_mm512_add_epi64(hi, _mm512_srli_epi64(lo, 32)), shift);
+    q = _mm512_mask_sub_epi64(q, neg, _mm512_setzero_si512(), q);
+
+    __m512i max = _mm512_set1_epi64(INT32_MAX);
+    __m512i min = _mm512_set1_epi64(INT32_MIN);
+    *ov = (__mmask16)(*ov | _mm512_cmpgt_epi64_mask(q, max));
+    *un = (__mmask16)(*un | _mm512_cmplt_epi64_mask(q, min));
+    return _mm512_max_epi64(_mm512_min_epi64(q, max), min);
+}
+
+static inline CT_TARGET_AVX512 __m512i splitmix64_avx512(__m512i x)
+{
+    x = _mm512_add_epi64(x, _mm512_set1_epi64((long long)SM_GAMMA));
+    x = _mm512_mullo_epi64(_mm512_xor_si512(x, _mm512_srli_epi64(x, 30)),
+                           _mm512_set1_epi64((long long)SM_MUL1));
+    x = _mm512_mullo_epi64(_mm512_xor_si512(x, _mm512_srli_epi64(x, 27)),
+                           _mm512_set1_epi64((long long)SM_MUL2));
+    return _mm512_xor_si512(x, _mm512_srli_epi64(x, 31));
+}
+
+static inline void faults_avx512(__mmask16 ov, __mmask16 un, ct_fault_flags_t *faults)
+{
+    if (ov != 0) {
+        faults->overflow = 1;
+    }
+    if (un != 0) {
+        faults->underflow = 1;
+    }
+}
+
+/*===========================================================================*/
+/* AVX-512 kernels                                                            */
+/*===========================================================================*/
+
+static CT_TARGET_AVX512 void add32_avx512(const int32_t *a, const int32_t *b,
+                                          int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __mmask16 ov = 0;
+    __mmask16 un = 0;
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        _mm512_storeu_si512((void *)&out[i], sat_add_avx512(va, vb, &ov, &un));
+    }
+    faults_avx512(ov, un, faults);
+    ct_kernel_add32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void sub32_avx512(const int32_t *a, const int32_t *b,
+                                          int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __mmask16 ov = 0;
+    __mmask16 un = 0;
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        _mm512_storeu_si512((void *)&out[i], sat_sub_avx512(va, vb, &ov, &un));
+    }
+    faults_avx512(ov, un, faults);
+    ct_kernel_sub32_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void mul_q16_avx512_k(const int32_t *a, const int32_t *b,
+                                              int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __mmask16 ov = 0;
+    __mmask16 un = 0;
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        _mm512_storeu_si512((void *)&out[i], mul_q16_avx512(va, vb, &ov, &un));
+    }
+    faults_avx512(ov, un, faults);
+    ct_kernel_mul_q16_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void div_q16_avx512(const int32_t *num, const dvm_divisor_t *div,
+                                            int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    uint32_t i = 0;
+    if (div->denom != 0) {
+        __mmask16 ov = 0;
+        __mmask16 un = 0;
+        __m512i mlo = _mm512_set1_epi64((long long)(div->magic & 0xFFFFFFFFULL));
+        __m512i mhi = _mm512_set1_epi64((long long)(div->magic >> 32));
+        __m128i shift = _mm_cvtsi32_si128((int)div->shift);
+        __mmask8 dneg = div->negative ? (__mmask8)0xFF : (__mmask8)0;
+        for (; i + 16 <= n; i += 16) {
+            __m512i v = _mm512_loadu_si512((const void *)&num[i]);
+            __m512i x = _mm512_abs_epi32(v);
+            __mmask8 neg_e = (__mmask8)(_mm512_movepi64_mask(_mm512_slli_epi64(v, 32)) ^ dneg);
+            __mmask8 neg_o = (__mmask8)(_mm512_movepi64_mask(v) ^ dneg);
+            __m512i qe = div_lanes_avx512(x, neg_e, mlo, mhi, shift, &ov, &un);
+            __m512i qo = div_lanes_avx512(_mm512_srli_epi64(x, 32), neg_o, mlo, mhi, shift,
+                                          &ov, &un);
+            _mm512_storeu_si512((void *)&out[i],
+                                _mm512_mask_blend_epi32(0xAAAA, qe, _mm512_slli_epi64(qo, 32)));
+        }
+        faults_avx512(ov, un, faults);
+    }
+    ct_kernel_div_q16_scalar(&num[i], div, &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void normalize_avx512(const int32_t *x, const int32_t *means,
+                                              const int32_t *inv_stds, int32_t *out,
+                                              uint32_t n, ct_fault_flags_t *faults)
+{
+    __mmask16 ov = 0;
+    __mmask16 un = 0;
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+        __m512i vm = _mm512_loadu_si512((const void *)&means[i]);
+        __m512i vs = _mm512_loadu_si512((const void *)&inv_stds[i]);
+        __m512i c = sat_sub_avx512(vx, vm, &ov, &un);
+        _mm512_storeu_si512((void *)&out[i], mul_q16_avx512(c, vs, &ov, &un));
+    }
+    faults_avx512(ov, un, faults);
+    ct_kernel_normalize_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void add32_unchecked_avx512(const int32_t *a, const int32_t *b,
+                                                    int32_t *out, uint32_t n,
+                                                    ct_fault_flags_t *faults)
+{
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        _mm512_storeu_si512((void *)&out[i], _mm512_add_epi32(va, vb));
+    }
+    ct_kernel_add32_unchecked_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void normalize_unchecked_avx512(const int32_t *x, const int32_t *means,
+                                                        const int32_t *inv_stds, int32_t *out,
+                                                        uint32_t n, ct_fault_flags_t *faults)
+{
+    __m512i bias = _mm512_set1_epi64(0x7FFF);
+    __m512i one = _mm512_set1_epi64(1);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+        __m512i vm = _mm512_loadu_si512((const void *)&means[i]);
+        __m512i vs = _mm512_loadu_si512((const void *)&inv_stds[i]);
+        __m512i c = _mm512_sub_epi32(vx, vm);
+        __m512i pe = _mm512_mul_epi32(c, vs);
+        __m512i po = _mm512_mul_epi32(_mm512_srli_epi64(c, 32), _mm512_srli_epi64(vs, 32));
+        pe = _mm512_add_epi64(pe, _mm512_add_epi64(bias,
+                              _mm512_and_si512(_mm512_srli_epi64(pe, 16), one)));
+        po = _mm512_add_epi64(po, _mm512_add_epi64(bias,
+                              _mm512_and_si512(_mm512_srli_epi64(po, 16), one)));
+        __m512i q = _mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(pe, 16),
+                                            _mm512_slli_epi64(po, 16));
+        _mm512_storeu_si512((void *)&out[i], q);
+    }
+    ct_kernel_normalize_unchecked_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void prng_fill_avx512(uint64_t *out, uint32_t n,
+                                              uint64_t seed, uint32_t epoch,
+                                              uint32_t op_base, uint32_t op_offset)
+{
+    __m512i key = _mm512_set1_epi64((long long)(seed ^ (((uint64_t)epoch) << 32)));
+    __m256i base = _mm256_set1_epi32((int32_t)op_base);
+    __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i off = _mm256_add_epi32(_mm256_set1_epi32((int32_t)(op_offset + i)), lane);
+        __m512i op = _mm512_cvtepu32_epi64(_mm256_or_si256(base, off));
+        __m512i x = splitmix64_avx512(splitmix64_avx512(_mm512_xor_si512(key, op)));
+        _mm512_storeu_si512((void *)&out[i], x);
+    }
+    ct_kernel_prng_fill_scalar(&out[i], n - i, seed, epoch, op_base, op_offset + i);
+}
+
+static CT_TARGET_AVX512 void prng_stride_avx512(uint64_t *out, uint32_t n,
+                                                uint64_t seed, uint32_t epoch,
+                                                uint32_t op_first, uint32_t op_stride)
+{
+    __m512i key = _mm512_set1_epi64((long long)(seed ^ (((uint64_t)epoch) << 32)));
+    __m256i op = _mm256_add_epi32(_mm256_set1_epi32((int32_t)op_first),
+                                  _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                     _mm256_set1_epi32((int32_t)op_stride)));
+    __m256i step = _mm256_set1_epi32((int32_t)(op_stride * 8U));
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512i x = _mm512_xor_si512(key, _mm512_cvtepu32_epi64(op));
+        _mm512_storeu_si512((void *)&out[i], splitmix64_avx512(splitmix64_avx512(x)));
+        op = _mm256_add_epi32(op, step);
+    }
+    ct_kernel_prng_stride_scalar(&out[i], n - i, seed, epoch, op_first + i * op_stride, op_stride);
+}
+
+static CT_TARGET_AVX512 void noise_avx512(const uint64_t *u, int32_t *out, uint32_t n,
+                                          int32_t noise_std, ct_fault_flags_t *faults)
+{
+    __mmask16 ov = 0;
+    __mmask16 un = 0;
+    __m512i vstd = _mm512_set1_epi32(noise_std);
+    __m512i half = _mm512_set1_epi32(FIXED_HALF);
+    __m512i mask = _mm512_set1_epi32((int32_t)0xFFFF0000U);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i lo = _mm512_loadu_si512((const void *)&u[i]);
+        __m512i hi = _mm512_loadu_si512((const void *)&u[i + 8]);
+        __m256i tlo = _mm512_cvtepi64_epi32(_mm512_srli_epi64(lo, 32));
+        __m256i thi = _mm512_cvtepi64_epi32(_mm512_srli_epi64(hi, 32));
+        __m512i top = _mm512_inserti64x4(_mm512_castsi256_si512(tlo), thi, 1);
+        __m512i c = sat_sub_avx512(_mm512_and_si512(top, mask), half, &ov, &un);
+        __m512i m = mul_q16_avx512(vstd, c, &ov, &un);
+        _mm512_storeu_si512((void *)&out[i], sat_add_avx512(m, m, &ov, &un));
+    }
+    faults_avx512(ov, un, faults);
+    ct_kernel_noise_scalar(&u[i], &out[i], n - i, noise_std, faults);
+}
+
+/*===========================================================================*/
+/* AVX-512 narrow kernels (32 lanes, CT-MATH-001 §3.10)                       */
+/*===========================================================================*/
+
+static inline CT_TARGET_AVX512 __m512i sat_add16_avx512(__m512i a, __m512i b,
+                                                        __mmask32 *ov, __mmask32 *un)
+{
+    __m512i sat = _mm512_adds_epi16(a, b);
+    __mmask32 hit = _mm512_cmpneq_epi16_mask(sat, _mm512_add_epi16(a, b));
+    *ov |= hit & _mm512_cmpeq_epi16_mask(sat, _mm512_set1_epi16(INT16_MAX));
+    *un |= hit & _mm512_cmpeq_epi16_mask(sat, _mm512_set1_epi16(INT16_MIN));
+    return sat;
+}
+
+static inline CT_TARGET_AVX512 __m512i sat_sub16_avx512(__m512i a, __m512i b,
+                                                        __mmask32 *ov, __mmask32 *un)
+{
+    __m512i sat = _mm512_subs_epi16(a, b);
+    __mmask32 hit = _mm512_cmpneq_epi16_mask(sat, _mm512_sub_epi16(a, b));
+    *ov |= hit & _mm512_cmpeq_epi16_mask(sat, _mm512_set1_epi16(INT16_MAX));
+    *un |= hit & _mm512_cmpeq_epi16_mask(sat, _mm512_set1_epi16(INT16_MIN));
+    return sat;
+}
+
+static inline CT_TARGET_AVX512 __m512i rne_fx16_avx512(__m512i p, __m128i shift,
+                                                       __m512i mask, __m512i half,
+                                                       __mmask32 *ov, __mmask32 *un)
+{
+    __m512i q = _mm512_sra_epi32(p, shift);
+    __m512i frac = _mm512_and_si512(p, mask);
+    __m512i odd = _mm512_and_si512(q, _mm512_set1_epi32(1));
+    __mmask16 up = _mm512_cmpgt_epi32_mask(_mm512_add_epi32(frac, odd), half);
+    q = _mm512_mask_add_epi32(q, up, q, _mm512_set1_epi32(1));
+    *ov |= _mm512_cmpgt_epi32_mask(q, _mm512_set1_epi32(INT16_MAX));
+    *un |= _mm512_cmplt_epi32_mask(q, _mm512_set1_epi32(INT16_MIN));
+    return q;
+}
+
+static inline CT_TARGET_AVX512 __m512i mul_fx16_avx512(__m512i a, __m512i b, uint32_t frac_bits,
+                                                       __mmask32 *ov, __mmask32 *un)
+{
+    __m128i shift = _mm_cvtsi32_si128((int)frac_bits);
+    __m512i mask = _mm512_set1_epi32((int32_t)((1U << frac_bits) - 1U));
+    __m512i half = _mm512_set1_epi32((int32_t)(1U << (frac_bits - 1U)));
+    __m512i lo = _mm512_mullo_epi16(a, b);
+    __m512i hi = _mm512_mulhi_epi16(a, b);
+    __m512i q0 = rne_fx16_avx512(_mm512_unpacklo_epi16(lo, hi), shift, mask, half, ov, un);
+    __m512i q1 = rne_fx16_avx512(_mm512_unpackhi_epi16(lo, hi), shift, mask, half, ov, un);
+    return _mm512_packs_epi32(q0, q1);
+}
+
+static inline void faults16_avx512(__mmask32 ov, __mmask32 un, ct_fault_flags_t *faults)
+{
+    if (ov != 0) {
+        faults->overflow = 1;
+    }
+    if (un != 0) {
+        faults->underflow = 1;
+    }
+}
+
+static CT_TARGET_AVX512 void add16_avx512(const int16_t *a, const int16_t *b,
+                                          int16_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    __mmask32 ov = 0;
+    __mmask32 un = 0;
+    uint32_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        _mm512_storeu_si512((void *)&out[i], sat_add16_avx512(va, vb, &ov, &un));
+    }
+    faults16_avx512(ov, un, faults);
+    ct_kernel_add16_scalar(&a[i], &b[i], &out[i], n - i, faults);
+}
+
+static CT_TARGET_AVX512 void normalize16_avx512(const int16_t *x, const int16_t *means,
+                                                const int16_t *inv_stds, int16_t *out,
+                                                uint32_t n, uint32_t frac_bits,
+                                                ct_fault_flags_t *faults)
+{
+    __mmask32 ov = 0;
+    __mmask32 un = 0;
+    uint32_t i = 0;
+    if (frac_bits >= 1 && frac_bits <= 15) {
+        for (; i + 32 <= n; i += 32) {
+            __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+            __m512i vm = _mm512_loadu_si512((const void *)&means[i]);
+            __m512i vs = _mm512_loadu_si512((const void *)&inv_stds[i]);
+            __m512i c = sat_sub16_avx512(vx, vm, &ov, &un);
+            _mm512_storeu_si512((void *)&out[i], mul_fx16_avx512(c, vs, frac_bits, &ov, &un));
+        }
+    }
+    faults16_avx512(ov, un, faults);
+    ct_kernel_normalize16_scalar(&x[i], &means[i], &inv_stds[i], &out[i], n - i,
+                                 frac_bits, faults);
+}
+
+static CT_TARGET_AVX512 void noise16_avx512(const uint64_t *u, int16_t *out, uint32_t n,
+                                            int16_t noise_std, ct_fault_flags_t *faults)
+{
+    __mmask32 ov = 0;
+    __mmask32 un = 0;
+    __m512i vstd = _mm512_set1_epi16(noise_std);
+    uint32_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m128i r0 = _mm512_cvtepi64_epi16(_mm512_srli_epi64(_mm512_loadu_si512((const void *)&u[i]), 48));
+        __m128i r1 = _mm512_cvtepi64_epi16(_mm512_srli_epi64(_mm512_loadu_si512((const void *)&u[i + 8]), 48));
+        __m128i r2 = _mm512_cvtepi64_epi16(_mm512_srli_epi64(_mm512_loadu_si512((const void *)&u[i + 16]), 48));
+        __m128i r3 = _mm512_cvtepi64_epi16(_mm512_srli_epi64(_mm512_loadu_si512((const void *)&u[i + 24]), 48));
+        __m512i vr = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_set_m128i(r1, r0)),
+                                        _mm256_set_m128i(r3, r2), 1);
+        _mm512_storeu_si512((void *)&out[i], mul_fx16_avx512(vstd, vr, CT_FRAC_Q1_15, &ov, &un));
+    }
+    faults16_avx512(ov, un, faults);
+    ct_kernel_noise16_scalar(&u[i], &out[i], n - i, noise_std, faults);
+}
+
+/*===========================================================================*/
+/* Floating-point export (CT-MATH-001 §3.11)                                 */
+/*===========================================================================*/
+
+/* Rounding to p significant bits is done in integers, as in the scalar
+ * reference; the int → float conversion and the 2^-16 scaling that follow
+ * are then exact, so MXCSR rounding and FTZ/DAZ cannot change the result.
+ * msb(a) comes from the exponent of float(a >> 8), which is exact since
+ * a >> 8 < 2^24; lanes with a < 256 get shift 0 (no rounding needed). */
+
+#define EXPORT_SHIFT_BIAS  118   /* 127 - 8 - 1 */
+
+static inline CT_TARGET_AVX2 __m256i round_sig_avx2(__m256i a, int32_t p)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi32(1);
+    __m256i e = _mm256_srli_epi32(_mm256_castps_si256(
+                    _mm256_cvtepi32_ps(_mm256_srli_epi32(a, 8))), 23);
+    __m256i shift = _mm256_max_epi32(_mm256_sub_epi32(e, _mm256_set1_epi32(EXPORT_SHIFT_BIAS + p)),
+                                     zero);
+    __m256i q = _mm256_srlv_epi32(a, shift);
+    __m256i half = _mm256_srli_epi32(_mm256_sllv_epi32(one, shift), 1);
+    __m256i rem = _mm256_sub_epi32(a, _mm256_sllv_epi32(q, shift));
+    __m256i tie = _mm256_and_si256(_mm256_cmpeq_epi32(rem, half),
+                                   _mm256_and_si256(_mm256_cmpgt_epi32(half, zero),
+                                                    _mm256_cmpeq_epi32(_mm256_and_si256(q, one), one)));
+    __m256i up = _mm256_or_si256(_mm256_cmpgt_epi32(rem, half), tie);
+    return _mm256_sllv_epi32(_mm256_sub_epi32(q, up), shift);
+}
+
+static inline CT_TARGET_AVX2 __m256 fixed_to_float_avx2(__m256i x, int32_t p)
+{
+    __m256i sign = _mm256_and_si256(x, _mm256_set1_epi32(INT32_MIN));
+    __m256 f = _mm256_cvtepi32_ps(round_sig_avx2(_mm256_abs_epi32(x), p));
+    /* A magnitude of 2^31 converts as -2^31: clear the sign, then apply x's */
+    f = _mm256_and_ps(f, _mm256_castsi256_ps(_mm256_set1_epi32(INT32_MAX)));
+    f = _mm256_mul_ps(f, _mm256_set1_ps(1.0f / 65536.0f));
+    return _mm256_or_ps(f, _mm256_castsi256_ps(sign));
+}
+
+static CT_TARGET_AVX2 void to_f32_avx2(const int32_t *x, float *out, uint32_t n)
+{
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        _mm256_storeu_ps(&out[i], fixed_to_float_avx2(vx, 24));
+    }
+    ct_kernel_to_f32_scalar(&x[i], &out[i], n - i);
+}
+
+static CT_TARGET_AVX2 void to_f64_avx2(const int32_t *x, double *out, uint32_t n)
+{
+    __m256d scale = _mm256_set1_pd(1.0 / 65536.0);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(const void *)&x[i]);
+        __m128i hi = _mm_loadu_si128((const __m128i *)(const void *)&x[i + 4]);
+        _mm256_storeu_pd(&out[i], _mm256_mul_pd(_mm256_cvtepi32_pd(lo), scale));
+        _mm256_storeu_pd(&out[i + 4], _mm256_mul_pd(_mm256_cvtepi32_pd(hi), scale));
+    }
+    ct_kernel_to_f64_scalar(&x[i], &out[i], n - i);
+}
+
+static CT_TARGET_AVX2 void to_bf16_avx2(const int32_t *x, uint16_t *out, uint32_t n)
+{
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(const void *)&x[i + 8]);
+        __m256i b0 = _mm256_srli_epi32(_mm256_castps_si256(fixed_to_float_avx2(v0, 8)), 16);
+        __m256i b1 = _mm256_srli_epi32(_mm256_castps_si256(fixed_to_float_avx2(v1, 8)), 16);
+        /* packus works per 128-bit lane; restore element order */
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(b0, b1), 0xD8);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], packed);
+    }
+    ct_kernel_to_bf16_scalar(&x[i], &out[i], n - i);
+}
+
+static inline CT_TARGET_AVX512 __m512i round_sig_avx512(__m512i a, int32_t p)
+{
+    __m512i zero = _mm512_setzero_si512();
+    __m512i one = _mm512_set1_epi32(1);
+    __m512i e = _mm512_srli_epi32(_mm512_castps_si512(
+                    _mm512_cvtepi32_ps(_mm512_srli_epi32(a, 8))), 23);
+    __m512i shift = _mm512_max_epi32(_mm512_sub_epi32(e, _mm512_set1_epi32(EXPORT_SHIFT_BIAS + p)),
+                                     zero);
+    __m512i q = _mm512_srlv_epi32(a, shift);
+    __m512i half = _mm512_srli_epi32(_mm512_sllv_epi32(one, shift), 1);
+    __m512i rem = _mm512_sub_epi32(a, _mm512_sllv_epi32(q, shift));
+    __mmask16 tie = _mm512_cmpeq_epi32_mask(rem, half) &
+                    _mm512_cmpgt_epi32_mask(half, zero) &
+                    _mm512_test_epi32_mask(q, one);
+    __mmask16 up = _mm512_cmpgt_epi32_mask(rem, half) | tie;
+    return _mm512_sllv_epi32(_mm512_mask_add_epi32(q, up, q, one), shift);
+}
+
+static inline CT_TARGET_AVX512 __m512i fixed_to_float_bits_avx512(__m512i x, int32_t p)
+{
+    __m512i sign = _mm512_and_si512(x, _mm512_set1_epi32(INT32_MIN));
+    __m512 f = _mm512_cvtepi32_ps(round_sig_avx512(_mm512_abs_epi32(x), p));
+    f = _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(f),
+                                             _mm512_set1_epi32(INT32_MAX)));
+    f = _mm512_mul_ps(f, _mm512_set1_ps(1.0f / 65536.0f));
+    return _mm512_or_si512(_mm512_castps_si512(f), sign);
+}
+
+static CT_TARGET_AVX512 void to_f32_avx512(const int32_t *x, float *out, uint32_t n)
+{
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+        _mm512_storeu_si512((void *)&out[i], fixed_to_float_bits_avx512(vx, 24));
+    }
+    ct_kernel_to_f32_scalar(&x[i], &out[i], n - i);
+}
+
+static CT_TARGET_AVX512 void to_f64_avx512(const int32_t *x, double *out, uint32_t n)
+{
+    __m512d scale = _mm512_set1_pd(1.0 / 65536.0);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vx = _mm256_loadu_si256((const __m256i *)(const void *)&x[i]);
+        _mm512_storeu_pd(&out[i], _mm512_mul_pd(_mm512_cvtepi32_pd(vx), scale));
+    }
+    ct_kernel_to_f64_scalar(&x[i], &out[i], n - i);
+}
+
+static CT_TARGET_AVX512 void to_bf16_avx512(const int32_t *x, uint16_t *out, uint32_t n)
+{
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vx = _mm512_loadu_si512((const void *)&x[i]);
+        __m512i bits = _mm512_srli_epi32(fixed_to_float_bits_avx512(vx, 8), 16);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], _mm512_cvtepi32_epi16(bits));
+    }
+    ct_kernel_to_bf16_scalar(&x[i], &out[i], n - i);
+}
+
+/*===========================================================================*/
+/* Transpose                                                                  */
+/*===========================================================================*/
+
+/* Register tiles are walked in TRANSPOSE_BLOCK² blocks so a block's source
+ * rows and destination rows (16 KiB each) stay in L1. The ragged right and
+ * bottom strips use masked AVX2 tiles, or the scalar reference on SSE4.1. */
+
+#define TRANSPOSE_BLOCK  64U
+
+static inline CT_TARGET_SSE41 void transpose4x4_sse41(const int32_t *src, uint32_t ss,
+                                                      int32_t *dst, uint32_t ds)
+{
+    __m128i r0 = _mm_loadu_si128((const __m128i *)(const void *)&src[0]);
+    __m128i r1 = _mm_loadu_si128((const __m128i *)(const void *)&src[ss]);
+    __m128i r2 = _mm_loadu_si128((const __m128i *)(const void *)&src[2U * ss]);
+    __m128i r3 = _mm_loadu_si128((const __m128i *)(const void *)&src[3U * ss]);
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+    _mm_storeu_si128((__m128i *)(void *)&dst[0], _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(void *)&dst[ds], _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128((__m128i *)(void *)&dst[2U * ds], _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128((__m128i *)(void *)&dst[3U * ds], _mm_unpackhi_epi64(t2, t3));
+}
+
+static CT_TARGET_SSE41 void transpose32_sse41(const int32_t *src, uint32_t src_stride,
+                                              int32_t *dst, uint32_t dst_stride,
+                                              uint32_t rows, uint32_t cols)
+{
+    uint32_t rows4 = rows & ~3U;
+    uint32_t cols4 = cols & ~3U;
+    for (uint32_t r0 = 0; r0 < rows4; r0 += TRANSPOSE_BLOCK) {
+        uint32_t r1 = (rows4 - r0 < TRANSPOSE_BLOCK) ? rows4 : r0 + TRANSPOSE_BLOCK;
+        for (uint32_t c0 = 0; c0 < cols4; c0 += TRANSPOSE_BLOCK) {
+            uint32_t c1 = (cols4 - c0 < TRANSPOSE_BLOCK) ? cols4 : c0 + TRANSPOSE_BLOCK;
+            for (uint32_t r = r0; r < r1; r += 4) {
+                for (uint32_t c = c0; c < c1; c += 4) {
+                    transpose4x4_sse41(&src[(size_t)r * src_stride + c], src_stride,
+                                       &dst[(size_t)c * dst_stride + r], dst_stride);
+                }
+            }
+        }
+    }
+    ct_kernel_transpose32_scalar(&src[cols4], src_stride,
+                                 &dst[(size_t)cols4 * dst_stride], dst_stride,
+                                 rows4, cols - cols4);
+    ct_kernel_transpose32_scalar(&src[(size_t)rows4 * src_stride], src_stride,
+                                 &dst[rows4], dst_stride, rows - rows4, cols);
+}
+
+/* In-register transpose of the 8×8 tile r[0..7] */
+static inline CT_TARGET_AVX2 void transpose8x8_avx2(__m256i r[8])
+{
+    /* Pairs of rows, then quads, within each 128-bit lane */
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    /* Columns 0-3 from the low lanes, 4-7 from the high lanes */
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+static inline CT_TARGET_AVX2 void tile8x8_avx2(const int32_t *src, uint32_t ss,
+                                               int32_t *dst, uint32_t ds)
+{
+    __m256i r[8];
+    for (uint32_t k = 0; k < 8; k++) {
+        r[k] = _mm256_loadu_si256((const __m256i *)(const void *)&src[(size_t)k * ss]);
+    }
+    transpose8x8_avx2(r);
+    for (uint32_t k = 0; k < 8; k++) {
+        _mm256_storeu_si256((__m256i *)(void *)&dst[(size_t)k * ds], r[k]);
+    }
+}
+
+/* Partial tile of nr × nc (both ≤ 8) through masked loads and stores. This
+ * also carries small channel counts (e.g. C = 3), which have no full tile. */
+static inline CT_TARGET_AVX2 void tile_edge_avx2(const int32_t *src, uint32_t ss,
+                                                 int32_t *dst, uint32_t ds,
+                                                 uint32_t nr, uint32_t nc)
+{
+    __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i col_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)nc), lane);
+    __m256i row_mask = _mm256_cmpgt_epi32(_mm256_set1_epi32((int32_t)nr), lane);
+    __m256i r[8];
+    for (uint32_t k = 0; k < 8; k++) {
+        r[k] = (k < nr) ? _mm256_maskload_epi32((const int *)(const void *)&src[(size_t)k * ss],
+                                                col_mask)
+                        : _mm256_setzero_si256();
+    }
+    transpose8x8_avx2(r);
+    for (uint32_t k = 0; k < nc; k++) {
+        _mm256_maskstore_epi32((int *)(void *)&dst[(size_t)k * ds], row_mask, r[k]);
+    }
+}
+
+static CT_TARGET_AVX2 void transpose32_avx2(const int32_t *src, uint32_t src_stride,
+                                            int32_t *dst, uint32_t dst_stride,
+                                            uint32_t rows, uint32_t cols)
+{
+    uint32_t rows8 = rows & ~7U;
+    uint32_t cols8 = cols & ~7U;
+    for (uint32_t r0 = 0; r0 < rows8; r0 += TRANSPOSE_BLOCK) {
+        uint32_t r1 = (rows8 - r0 < TRANSPOSE_BLOCK) ? rows8 : r0 + TRANSPOSE_BLOCK;
+        for (uint32_t c0 = 0; c0 < cols8; c0 += TRANSPOSE_BLOCK) {
+            uint32_t c1 = (cols8 - c0 < TRANSPOSE_BLOCK) ? cols8 : c0 + TRANSPOSE_BLOCK;
+            for (uint32_t r = r0; r < r1; r += 8) {
+                for (uint32_t c = c0; c < c1; c += 8) {
+                    tile8x8_avx2(&src[(size_t)r * src_stride + c], src_stride,
+                                 &dst[(size_t)c * dst_stride + r], dst_stride);
+                }
+            }
+        }
+    }
+
+    /* Right strip (every row), then bottom strip */
+    if (cols8 < cols) {
+        for (uint32_t r = 0; r < rows; r += 8) {
+            uint32_t nr = (rows - r < 8) ? rows - r : 8;
+            tile_edge_avx2(&src[(size_t)r * src_stride + cols8], src_stride,
+                           &dst[(size_t)cols8 * dst_stride + r], dst_stride, nr, cols - cols8);
+        }
+    }
+    if (rows8 < rows) {
+        for (uint32_t c = 0; c < cols8; c += 8) {
+            tile_edge_avx2(&src[(size_t)rows8 * src_stride + c], src_stride,
+                           &dst[(size_t)c * dst_stride + rows8], dst_stride, rows - rows8, 8);
+        }
+    }
+}
+
+/*===========================================================================*/
+/* Bilinear warp (CT-MATH-001 §8.7)                                          */
+/*===========================================================================*/
+
+/* RNE16((2^16 − w)·a + w·b) per lane; the result fits, so the low half of
+ * each 64-bit shift is exact */
+static inline CT_TARGET_AVX2 __m256i warp_lerp_avx2(__m256i a, __m256i b, __m256i w)
+{
+    __m256i wa = _mm256_sub_epi32(_mm256_set1_epi32(FIXED_ONE), w);
+    __m256i bias = _mm256_set1_epi64x(0x7FFF);
+    __m256i one = _mm256_set1_epi64x(1);
+
+    __m256i pe = _mm256_add_epi64(_mm256_mul_epi32(a, wa), _mm256_mul_epi32(b, w));
+    __m256i po = _mm256_add_epi64(
+        _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(wa, 32)),
+        _mm256_mul_epi32(_mm256_srli_epi64(b, 32), _mm256_srli_epi64(w, 32)));
+    pe = _mm256_add_epi64(_mm256_add_epi64(pe, bias),
+                          _mm256_and_si256(_mm256_srli_epi64(pe, 16), one));
+    po = _mm256_add_epi64(_mm256_add_epi64(po, bias),
+                          _mm256_and_si256(_mm256_srli_epi64(po, 16), one));
+    return _mm256_blend_epi32(_mm256_srli_epi64(pe, 16),
+                              _mm256_slli_epi64(_mm256_srli_epi64(po, 16), 32), 0xAA);
+}
+
+static CT_TARGET_AVX2 void warp_row_avx2(const int32_t *src, uint32_t width, uint32_t height,
+                                         uint32_t border, int32_t sx, int32_t sy,
+                                         int32_t dx, int32_t dy, int32_t *out, uint32_t n)
+{
+    if (width == 0 || height == 0) {
+        ct_kernel_warp_row_scalar(src, width, height, border, sx, sy, dx, dy, out, n);
+        return;
+    }
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i lo16 = _mm256_set1_epi32(0xFFFF);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i neg1 = _mm256_set1_epi32(-1);
+    const __m256i vw = _mm256_set1_epi32((int32_t)width);
+    const __m256i vh = _mm256_set1_epi32((int32_t)height);
+    const __m256i step_x = _mm256_set1_epi32((int32_t)((uint32_t)dx * 8U));
+    const __m256i step_y = _mm256_set1_epi32((int32_t)((uint32_t)dy * 8U));
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i wmax = _mm256_sub_epi32(vw, one);
+    const __m256i hmax = _mm256_sub_epi32(vh, one);
+    const __m256i all = _mm256_set1_epi32((border == CT_WARP_REPLICATE) ? -1 : 0);
+    const int *base = (const int *)(const void *)src;
+
+    __m256i x = _mm256_add_epi32(_mm256_set1_epi32(sx),
+                                 _mm256_mullo_epi32(lane, _mm256_set1_epi32(dx)));
+    __m256i y = _mm256_add_epi32(_mm256_set1_epi32(sy),
+                                 _mm256_mullo_epi32(lane, _mm256_set1_epi32(dy)));
+
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i fx = _mm256_and_si256(x, lo16);
+        __m256i fy = _mm256_and_si256(y, lo16);
+        __m256i x0 = _mm256_srai_epi32(x, 16);
+        __m256i y0 = _mm256_srai_epi32(y, 16);
+        __m256i x1 = _mm256_add_epi32(x0, one);
+        __m256i y1 = _mm256_add_epi32(y0, one);
+
+        /* In-bounds masks per tap (all set when replicating); masked lanes
+         * are neither loaded nor used */
+        __m256i in_x0 = _mm256_and_si256(_mm256_cmpgt_epi32(x0, neg1), _mm256_cmpgt_epi32(vw, x0));
+        __m256i in_x1 = _mm256_and_si256(_mm256_cmpgt_epi32(x1, neg1), _mm256_cmpgt_epi32(vw, x1));
+        __m256i in_y0 = _mm256_or_si256(all, _mm256_and_si256(_mm256_cmpgt_epi32(y0, neg1),
+                                                              _mm256_cmpgt_epi32(vh, y0)));
+        __m256i in_y1 = _mm256_or_si256(all, _mm256_and_si256(_mm256_cmpgt_epi32(y1, neg1),
+                                                              _mm256_cmpgt_epi32(vh, y1)));
+        in_x0 = _mm256_or_si256(all, in_x0);
+        in_x1 = _mm256_or_si256(all, in_x1);
+
+        /* Clamped taps address the edge pixel; in zero mode their lanes are masked */
+        x0 = _mm256_min_epi32(_mm256_max_epi32(x0, zero), wmax);
+        x1 = _mm256_min_epi32(_mm256_max_epi32(x1, zero), wmax);
+        __m256i row0 = _mm256_mullo_epi32(_mm256_min_epi32(_mm256_max_epi32(y0, zero), hmax), vw);
+        __m256i row1 = _mm256_mullo_epi32(_mm256_min_epi32(_mm256_max_epi32(y1, zero), hmax), vw);
+
+        __m256i p00 = _mm256_mask_i32gather_epi32(zero, base, _mm256_add_epi32(row0, x0),
+                                                  _mm256_and_si256(in_y0, in_x0), 4);
+        __m256i p01 = _mm256_mask_i32gather_epi32(zero, base, _mm256_add_epi32(row0, x1),
+                                                  _mm256_and_si256(in_y0, in_x1), 4);
+        __m256i p10 = _mm256_mask_i32gather_epi32(zero, base, _mm256_add_epi32(row1, x0),
+                                                  _mm256_and_si256(in_y1, in_x0), 4);
+        __m256i p11 = _mm256_mask_i32gather_epi32(zero, base, _mm256_add_epi32(row1, x1),
+                                                  _mm256_and_si256(in_y1, in_x1), 4);
+
+        __m256i top = warp_lerp_avx2(p00, p01, fx);
+        __m256i bottom = warp_lerp_avx2(p10, p11, fx);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], warp_lerp_avx2(top, bottom, fy));
+
+        x = _mm256_add_epi32(x, step_x);
+        y = _mm256_add_epi32(y, step_y);
+    }
+    ct_kernel_warp_row_scalar(src, width, height, border,
+                              (int32_t)((uint32_t)sx + i * (uint32_t)dx),
+                              (int32_t)((uint32_t)sy + i * (uint32_t)dy),
+                              dx, dy, &out[i], n - i);
+}
+
+/*===========================================================================*/
+/* Sample blending (CT-MATH-001 §8.9)                                        */
+/*===========================================================================*/
+
+/* The warp lerp per lane: even lanes multiply in place, odd lanes after a
+ * 32-bit shift, and the rounded high words are blended back together */
+static inline CT_TARGET_SSE41 __m128i lerp_sse41(__m128i a, __m128i b, __m128i wa, __m128i w)
+{
+    __m128i bias = _mm_set1_epi64x(0x7FFF);
+    __m128i one = _mm_set1_epi64x(1);
+
+    __m128i pe = _mm_add_epi64(_mm_mul_epi32(a, wa), _mm_mul_epi32(b, w));
+    __m128i po = _mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(a, 32), wa),
+                               _mm_mul_epi32(_mm_srli_epi64(b, 32), w));
+    pe = _mm_add_epi64(_mm_add_epi64(pe, bias), _mm_and_si128(_mm_srli_epi64(pe, 16), one));
+    po = _mm_add_epi64(_mm_add_epi64(po, bias), _mm_and_si128(_mm_srli_epi64(po, 16), one));
+    return _mm_blend_epi16(_mm_srli_epi64(pe, 16), _mm_slli_epi64(_mm_srli_epi64(po, 16), 32),
+                           0xCC);
+}
+
+static CT_TARGET_SSE41 void lerp_q16_sse41(const int32_t *a, const int32_t *b, int32_t t,
+                                           int32_t *out, uint32_t n)
+{
+    const __m128i wa = _mm_set1_epi32(FIXED_ONE - t);
+    const __m128i w = _mm_set1_epi32(t);
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(const void *)&a[i]);
+        __m128i vb = _mm_loadu_si128((const __m128i *)(const void *)&b[i]);
+        _mm_storeu_si128((__m128i *)(void *)&out[i], lerp_sse41(va, vb, wa, w));
+    }
+    ct_kernel_lerp_q16_scalar(&a[i], &b[i], t, &out[i], n - i);
+}
+
+static CT_TARGET_AVX2 void lerp_q16_avx2(const int32_t *a, const int32_t *b, int32_t t,
+                                         int32_t *out, uint32_t n)
+{
+    const __m256i w = _mm256_set1_epi32(t);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i va = _mm256_loadu_si256((const __m256i *)(const void *)&a[i]);
+        __m256i vb = _mm256_loadu_si256((const __m256i *)(const void *)&b[i]);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], warp_lerp_avx2(va, vb, w));
+    }
+    ct_kernel_lerp_q16_scalar(&a[i], &b[i], t, &out[i], n - i);
+}
+
+static CT_TARGET_AVX512 void lerp_q16_avx512(const int32_t *a, const int32_t *b, int32_t t,
+                                             int32_t *out, uint32_t n)
+{
+    const __m512i wa = _mm512_set1_epi32(FIXED_ONE - t);
+    const __m512i w = _mm512_set1_epi32(t);
+    const __m512i bias = _mm512_set1_epi64(0x7FFF);
+    const __m512i one = _mm512_set1_epi64(1);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i va = _mm512_loadu_si512((const void *)&a[i]);
+        __m512i vb = _mm512_loadu_si512((const void *)&b[i]);
+        __m512i pe = _mm512_add_epi64(_mm512_mul_epi32(va, wa), _mm512_mul_epi32(vb, w));
+        __m512i po = _mm512_add_epi64(_mm512_mul_epi32(_mm512_srli_epi64(va, 32), wa),
+                                      _mm512_mul_epi32(_mm512_srli_epi64(vb, 32), w));
+        pe = _mm512_add_epi64(_mm512_add_epi64(pe, bias),
+                              _mm512_and_si512(_mm512_srli_epi64(pe, 16), one));
+        po = _mm512_add_epi64(_mm512_add_epi64(po, bias),
+                              _mm512_and_si512(_mm512_srli_epi64(po, 16), one));
+        _mm512_storeu_si512((void *)&out[i],
+                            _mm512_mask_blend_epi32((__mmask16)0xAAAA, _mm512_srli_epi64(pe, 16),
+                                                    _mm512_slli_epi64(_mm512_srli_epi64(po, 16), 32)));
+    }
+    ct_kernel_lerp_q16_scalar(&a[i], &b[i], t, &out[i], n - i);
+}
+
+/*===========================================================================*/
+/* Bounded draws (CT-MATH-001 §5.5)                                          */
+/*===========================================================================*/
+
+/* The vector path keeps the high half of word × bound. Lanes whose low half
+ * falls below bound may need a redraw; slow bit k sends lane k to scalar */
+static void bound_v2_fixup(const uint64_t *u, uint32_t *out, uint32_t bound,
+                           uint32_t slow, uint32_t lanes)
+{
+    for (uint32_t k = 0; k < lanes; k++) {
+        if ((slow & (1U << k)) != 0U) {
+            out[k] = ct_prng_bound_v2(u[k], bound);
+        }
+    }
+}
+
+static CT_TARGET_SSE41 void bound_v2_sse41(const uint64_t *u, uint32_t *out, uint32_t n,
+                                           uint32_t bound)
+{
+    __m128i vb = _mm_set1_epi32((int32_t)bound);
+    __m128i flip = _mm_set1_epi32(INT32_MIN);
+    __m128i vb_flip = _mm_xor_si128(vb, flip);
+    uint32_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 m0 = _mm_castsi128_ps(_mm_mul_epu32(
+            _mm_loadu_si128((const __m128i *)(const void *)&u[i]), vb));
+        __m128 m1 = _mm_castsi128_ps(_mm_mul_epu32(
+            _mm_loadu_si128((const __m128i *)(const void *)&u[i + 2]), vb));
+        __m128i lo = _mm_castps_si128(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i hi = _mm_castps_si128(_mm_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_si128((__m128i *)(void *)&out[i], hi);
+        /* Unsigned lo < bound via the sign-flipped signed compare */
+        int slow = _mm_movemask_ps(_mm_castsi128_ps(
+            _mm_cmpgt_epi32(vb_flip, _mm_xor_si128(lo, flip))));
+        if (slow != 0) {
+            bound_v2_fixup(&u[i], &out[i], bound, (uint32_t)slow, 4);
+        }
+    }
+    ct_kernel_bound_v2_scalar(&u[i], &out[i], n - i, bound);
+}
+
+static CT_TARGET_AVX2 void bound_v2_avx2(const uint64_t *u, uint32_t *out, uint32_t n,
+                                         uint32_t bound)
+{
+    __m256i vb = _mm256_set1_epi32((int32_t)bound);
+    __m256i flip = _mm256_set1_epi32(INT32_MIN);
+    __m256i vb_flip = _mm256_xor_si256(vb, flip);
+    uint32_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 m0 = _mm256_castsi256_ps(_mm256_mul_epu32(
+            _mm256_loadu_si256((const __m256i *)(const void *)&u[i]), vb));
+        __m256 m1 = _mm256_castsi256_ps(_mm256_mul_epu32(
+            _mm256_loadu_si256((const __m256i *)(const void *)&u[i + 4]), vb));
+        /* Per 128-bit lane: (m0, m0, m1, m1) halves; reorder the 64-bit pairs */
+        __m256i lo = _mm256_permute4x64_epi64(_mm256_castps_si256(
+            _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+        __m256i hi = _mm256_permute4x64_epi64(_mm256_castps_si256(
+            _mm256_shuffle_ps(m0, m1, _MM_SHUFFLE(3, 1, 3, 1))), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256((__m256i *)(void *)&out[i], hi);
+        int slow = _mm256_movemask_ps(_mm256_castsi256_ps(
+            _mm256_cmpgt_epi32(vb_flip, _mm256_xor_si256(lo, flip))));
+        if (slow != 0) {
+            bound_v2_fixup(&u[i], &out[i], bound, (uint32_t)slow, 8);
+        }
+    }
+    ct_kernel_bound_v2_scalar(&u[i], &out[i], n - i, bound);
+}
+
+static CT_TARGET_AVX512 void bound_v2_avx512(const uint64_t *u, uint32_t *out, uint32_t n,
+                                             uint32_t bound)
+{
+    __m512i vb = _mm512_set1_epi32((int32_t)bound);
+    uint32_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i m0 = _mm512_mul_epu32(_mm512_loadu_si512((const void *)&u[i]), vb);
+        __m512i m1 = _mm512_mul_epu32(_mm512_loadu_si512((const void *)&u[i + 8]), vb);
+        _mm256_storeu_si256((__m256i *)(void *)&out[i],
+                            _mm512_cvtepi64_epi32(_mm512_srli_epi64(m0, 32)));
+        _mm256_storeu_si256((__m256i *)(void *)&out[i + 8],
+                            _mm512_cvtepi64_epi32(_mm512_srli_epi64(m1, 32)));
+        /* Low halves sit in the even 32-bit elements */
+        __mmask16 s0 = _mm512_mask_cmplt_epu32_mask((__mmask16)0x5555, m0, vb);
+        __mmask16 s1 = _mm512_mask_cmplt_epu32_mask((__mmask16)0x5555, m1, vb);
+        if ((s0 | s1) != 0) {
+            uint32_t slow = 0;
+            for (uint32_t k = 0; k < 8; k++) {
+                slow |= (((uint32_t)s0 >> (2U * k)) & 1U) << k;
+                slow |= (((uint32_t)s1 >> (2U * k)) & 1U) << (k + 8U);
+            }
+            bound_v2_fixup(&u[i], &out[i], bound, slow, 16);
+        }
+    }
+    ct_kernel_bound_v2_scalar(&u[i], &out[i], n - i, bound);
+}
+
+/*===========================================================================*/
+/* Table population                                                           */
+/*===========================================================================*/
+
+void ct_kernels_x86_populate(ct_dispatch_t *table, ct_backend_t backend)
+{
+    if (backend >= CT_BACKEND_SSE41) {
+        table->add32 = add32_sse41;
+        table->sub32 = sub32_sse41;
+        table->mul_q16 = mul_q16_sse41_k;
+        table->normalize = normalize_sse41;
+        table->noise = noise_sse41;
+        table->add32_unchecked = add32_unchecked_sse41;
+        table->normalize_unchecked = normalize_unchecked_sse41;
+        table->transpose32 = transpose32_sse41;
+        table->lerp_q16 = lerp_q16_sse41;
+        table->bound_v2 = bound_v2_sse41;
+    }
+    if (backend >= CT_BACKEND_AVX2) {
+        table->add32 = add32_avx2;
+        table->sub32 = sub32_avx2;
+        table->mul_q16 = mul_q16_avx2_k;
+        table->div_q16 = div_q16_avx2;
+        table->normalize = normalize_avx2;
+        table->prng_fill = prng_fill_avx2;
+        table->prng_stride = prng_stride_avx2;
+        table->noise = noise_avx2;
+        table->add32_unchecked = add32_unchecked_avx2;
+        table->normalize_unchecked = normalize_unchecked_avx2;
+        table->add16 = add16_avx2;
+        table->normalize16 = normalize16_avx2;
+        table->noise16 = noise16_avx2;
+        table->to_f32 = to_f32_avx2;
+        table->to_f64 = to_f64_avx2;
+        table->to_bf16 = to_bf16_avx2;
+        table->transpose32 = transpose32_avx2;
+        table->warp_row = warp_row_avx2;
+        table->lerp_q16 = lerp_q16_avx2;
+        table->bound_v2 = bound_v2_avx2;
+    }
+    if (backend >= CT_BACKEND_AVX512) {
+        table->add32 = add32_avx512;
+        table->sub32 = sub32_avx512;
+        table->mul_q16 = mul_q16_avx512_k;
+        table->div_q16 = div_q16_avx512;
+        table->normalize = normalize_avx512;
+        table->prng_fill = prng_fill_avx512;
+        table->prng_stride = prng_stride_avx512;
+        table->noise = noise_avx512;
+        table->add32_unchecked = add32_unchecked_avx512;
+        table->normalize_unchecked = normalize_unchecked_avx512;
+        table->add16 = add16_avx512;
+        table->normalize16 = normalize16_avx512;
+        table->noise16 = noise16_avx512;
+        table->to_f32 = to_f32_avx512;
+        table->to_f64 = to_f64_avx512;
+        table->to_bf16 = to_bf16_avx512;
+        table->lerp_q16 = lerp_q16_avx512;
+        table->bound_v2 = bound_v2_avx512;
+    }
+    table->backend = backend;
+}
+
+#else
+
+typedef int ct_kernels_x86_unused_t;  /* ISO C forbids an empty translation unit */
+
+#endif /* CT_HAVE_X86_KERNELS */
@@ -128,6 +128,123 @@ int32_t dvm_div_q16(int32_t num, int32_t denom, ct_fault_flags_t *faults)
     return dvm_clamp32(result, faults);
 }
 
+/*===========================================================================*/
+/* Invariant divisors (CT-MATH-001 §3.9)                                     */
+/*===========================================================================*/
+
+void dvm_divisor_init(dvm_divisor_t *div, int32_t denom)
+{
+    uint32_t d = (denom < 0) ? 0U - (uint32_t)denom : (uint32_t)denom;
+
+    div->denom = denom;
+    div->negative = (denom < 0) ? 1U : 0U;
+    div->shift = 0;
+    div->magic = 0;
+
+    if (d == 0) {
+        return;
+    }
+
+    /* shift = ceil(log2 d) */
+    while ((1ULL << div->shift) < d) {
+        div->shift++;
+    }
+
+    /* magic = ceil(2^(48 + shift) / d), formed as (2^(16 + shift) × 2^32) / d */
+    uint64_t t = 1ULL << (16 + div->shift);
+    uint64_t r = (t % d) << 32;
+    div->magic = ((t / d) << 32) + r / d + ((r % d != 0) ? 1U : 0U);
+}
+
+/*
+ * With a = |num| × 2^16 < 2^48 and e = magic × d − 2^(48 + shift) < d ≤ 2^shift,
+ * a × e < 2^(48 + shift), hence floor(a × magic / 2^(48 + shift)) = floor(a / d)
+ * (Granlund–Montgomery). The 2^16 factor folds into the shift, and the
+ * product is formed from two 32×32 multiplies.
+ */
+int32_t dvm_div_q16_by(int32_t num, const dvm_divisor_t *div, ct_fault_flags_t *faults)
+{
+    if (div->denom == 0) {
+        faults->div_zero = 1;
+        return 0;
+    }
+
+    uint64_t x = (num < 0) ? (uint64_t)(-(int64_t)num) : (uint64_t)num;
+    uint64_t lo = x * (div->magic & 0xFFFFFFFFULL);
+    uint64_t hi = x * (div->magic >> 32);
+    uint64_t q = (hi + (lo >> 32)) >> div->shift;
+
+    int64_t result = ((num < 0) != (div->negative != 0)) ? -(int64_t)q : (int64_t)q;
+    return dvm_clamp32(result, faults);
+}
+
+/*===========================================================================*/
+/* Narrow formats (CT-MATH-001 §3.10)                                        */
+/*===========================================================================*/
+
+uint32_t ct_dtype_frac_bits(uint32_t dtype)
+{
+    switch (dtype) {
+    case CT_DTYPE_Q16_16:
+        return 16;
+    case CT_DTYPE_Q8_8:
+        return CT_FRAC_Q8_8;
+    case CT_DTYPE_Q1_15:
+        return CT_FRAC_Q1_15;
+    default:
+        return 0;
+    }
+}
+
+int16_t dvm_clamp16(int32_t x, ct_fault_flags_t *faults)
+{
+    if (x > INT16_MAX) {
+        faults->overflow = 1;
+        return INT16_MAX;
+    }
+    if (x < INT16_MIN) {
+        faults->underflow = 1;
+        return INT16_MIN;
+    }
+    return (int16_t)x;
+}
+
+int16_t dvm_add16(int16_t a, int16_t b, ct_fault_flags_t *faults)
+{
+    return dvm_clamp16((int32_t)a + (int32_t)b, faults);
+}
+
+int16_t dvm_sub16(int16_t a, int16_t b, ct_fault_flags_t *faults)
+{
+    return dvm_clamp16((int32_t)a - (int32_t)b, faults);
+}
+
+int16_t dvm_mul_fx16(int16_t a, int16_t b, uint32_t frac_bits, ct_fault_flags_t *faults)
+{
+    if (frac_bits < 1 || frac_bits > 15) {
+        faults->domain = 1;
+        return 0;
+    }
+
+    /* |a × b| ≤ 2^30, so the product and the RNE shift stay in range */
+    int32_t result = dvm_round_shift_rne((int64_t)a * (int64_t)b, frac_bits, faults);
+    return dvm_clamp16(result, faults);
+}
+
+int32_t dvm_widen16(int16_t x, uint32_t frac_bits)
+{
+    return (int32_t)x * (int32_t)(1U << (16 - frac_bits));
+}
+
+int16_t dvm_narrow16(int32_t x, uint32_t frac_bits, ct_fault_flags_t *faults)
+{
+    if (frac_bits < 1 || frac_bits > 15) {
+        faults->domain = 1;
+        return 0;
+    }
+    return dvm_clamp16(dvm_round_shift_rne(x, 16 - frac_bits, faults), faults);
+}
+
 /*===========================================================================*/
 /* Fault flag helpers                                                         */
 /*===========================================================================*/
@@ -4,6 +4,8 @@
  * @brief Deterministic pseudo-random number generator.
  *
  * @details Pure function PRNG based on SplitMix64. Same seed → same sequence.
+ *          Bounded draws come in two versions: version 1 (modulo with
+ *          bounded retries) and version 2 (multiply-high rejection).
  *
  * @traceability CT-MATH-001 §5, SRS-003-AUGMENT, SRS-004-SHUFFLE
  * @compliance MISRA-C:2012, ISO 26262, IEC 62304
@@ -53,16 +55,18 @@ uint64_t ct_prng(uint64_t seed, uint32_t epoch, uint32_t op_id)
 
 uint32_t ct_prng_uniform(uint64_t seed, uint32_t epoch, uint32_t op_id, uint32_t n)
 {
-    if (n == 0) {
+    if (n <= 1) {
         return 0;
     }
-    
-    if (n == 1) {
+    return ct_prng_bound(ct_prng(seed, epoch, op_id), n);
+}
+
+uint32_t ct_prng_bound(uint64_t rand, uint32_t n)
+{
+    if (n <= 1) {
         return 0;
     }
     
-    uint64_t rand = ct_prng(seed, epoch, op_id);
-    
     /* For small n, use rejection sampling to avoid modulo bias */
     if (n <= 65536) {
         uint32_t threshold = (0xFFFFFFFFU / n) * n;
@@ -80,3 +84,41 @@ uint32_t ct_prng_uniform(uint64_t seed, uint32_t epoch, uint32_t op_id, uint32_t
     /* For large n, direct modulo is acceptable */
     return (uint32_t)(rand % n);
 }
+
+/*===========================================================================*/
+/* ct_prng_uniform_v2 (CT-MATH-001 §5.5)                                     */
+/*===========================================================================*/
+
+/* 32-bit words drawn before the last product is accepted as is */
+#define BOUND_V2_MAX_WORDS 64U
+
+uint32_t ct_prng_uniform_v2(uint64_t seed, uint32_t epoch, uint32_t op_id, uint32_t n)
+{
+    return ct_prng_bound_v2(ct_prng(seed, epoch, op_id), n);
+}
+
+uint32_t ct_prng_bound_v2(uint64_t rand, uint32_t n)
+{
+    if (n <= 1) {
+        return 0;
+    }
+
+    /* [0, n) is the high half of word × n; the low half tells whether the
+     * word falls in the 2^32 mod n values that would bias it */
+    uint64_t m = (rand & 0xFFFFFFFFU) * n;
+    if ((uint32_t)m < n) {
+        uint32_t threshold = (0U - n) % n;
+        uint64_t word = rand;
+        /* Next words: the high half of rand, then both halves of each
+         * SplitMix64 step. Reaching the bound has probability below 2^-63 */
+        for (uint32_t k = 1; (uint32_t)m < threshold && k < BOUND_V2_MAX_WORDS; k++) {
+            if ((k & 1U) != 0U) {
+                m = (word >> 32) * n;
+            } else {
+                word = splitmix64(word);
+                m = (word & 0xFFFFFFFFU) * n;
+            }
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
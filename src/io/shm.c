@@ -0,0 +1,600 @@
+/**
+ * @file shm.c
+ * @project Certifiable Data Pipeline
+ * @brief POSIX shared-memory batch ring.
+ *
+ * @details Region layout (all offsets 64-byte aligned):
+ *
+ *            header | slot 0 | slot 1 | ... | slot (slot_count - 1)
+ *
+ *          Each slot holds one published batch:
+ *
+ *            slot header | sample headers[B] | sample hashes[B] |
+ *            sample data[B][max_elements]
+ *
+ *          Batch s lives in slot s mod slot_count. The server reuses a slot
+ *          only once every active client cursor has moved past the batch in
+ *          it. Client join and the server's slot claim are serialised by a
+ *          spinlock in the header, so a joining client can never start at a
+ *          slot that is being overwritten. Everything else is lock-free with
+ *          acquire/release ordering on the sequence numbers.
+ *
+ *          Processes die without cleaning up, so both the lock word and each
+ *          client entry record a pid. A lock whose owner is gone is taken
+ *          over, and a client whose process is gone no longer holds slots.
+ *
+ * @traceability CT-STRUCT-001 §20
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "shm.h"
+#include "merkle.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define SHM_MAGIC         0x48535443U   /* "CTSH" */
+#define SHM_LAYOUT        2U
+#define SHM_ALIGN         64U
+#define SHM_SEQ_WRITING   UINT64_MAX
+#define SHM_LOCK_SPINS    (1U << 16)
+
+/*===========================================================================*/
+/* Shared layout                                                              */
+/*===========================================================================*/
+
+/* Fixed-width fields only: the region is shared by separately built processes */
+
+typedef struct {
+    uint32_t magic;                /* SHM_MAGIC, stored last on create */
+    uint32_t layout;               /* SHM_LAYOUT */
+    uint32_t slot_count;
+    uint32_t batch_size;
+    uint32_t max_elements;
+    uint32_t lock;                 /* Join / claim spinlock: owner pid, or 0 */
+    uint64_t slot_bytes;
+    uint64_t region_bytes;
+    uint64_t write_seq;            /* Batches fully published */
+    uint32_t closed;
+    uint32_t prov_epoch;
+    uint32_t prov_total;
+    uint32_t _pad;
+    ct_hash_t dataset_hash;
+    ct_hash_t config_hash;
+    ct_hash_t prov_hash;
+    ct_hash_t prov_prev;
+    uint32_t client_active[CT_SHM_MAX_CLIENTS];
+    int32_t client_pid[CT_SHM_MAX_CLIENTS];       /* Process that attached */
+    uint64_t client_cursor[CT_SHM_MAX_CLIENTS];   /* Oldest batch still needed */
+} shm_header_t;
+
+typedef struct {
+    uint64_t seq;                  /* Batch sequence, or SHM_SEQ_WRITING */
+    uint32_t epoch;
+    uint32_t batch_index;
+    ct_hash_t batch_hash;
+} shm_slot_t;
+
+typedef struct {
+    uint32_t version;
+    uint32_t dtype;
+    uint32_t ndims;
+    uint32_t dims[CT_MAX_DIMS];
+    uint32_t total_elements;
+} shm_sample_t;
+
+/*===========================================================================*/
+/* Layout helpers                                                             */
+/*===========================================================================*/
+
+static uint64_t align_up(uint64_t n)
+{
+    return (n + (SHM_ALIGN - 1U)) & ~(uint64_t)(SHM_ALIGN - 1U);
+}
+
+static uint64_t header_bytes(void)
+{
+    return align_up(sizeof(shm_header_t));
+}
+
+static uint64_t slot_headers_offset(void)
+{
+    return align_up(sizeof(shm_slot_t));
+}
+
+static uint64_t slot_hashes_offset(uint32_t batch_size)
+{
+    return slot_headers_offset() + align_up((uint64_t)batch_size * sizeof(shm_sample_t));
+}
+
+static uint64_t slot_data_offset(uint32_t batch_size)
+{
+    return slot_hashes_offset(batch_size) + align_up((uint64_t)batch_size * sizeof(ct_hash_t));
+}
+
+/* Returns 0 for an invalid layout or one whose size overflows */
+static uint64_t slot_bytes(uint32_t batch_size, uint32_t max_elements)
+{
+    if (batch_size == 0 || max_elements == 0 || max_elements > CT_MAX_SAMPLE_SIZE) {
+        return 0;
+    }
+    uint64_t data = (uint64_t)batch_size * max_elements * sizeof(int32_t);
+    return slot_data_offset(batch_size) + align_up(data);
+}
+
+static shm_slot_t *slot_at(void *base, const shm_header_t *h, uint64_t seq)
+{
+    uint64_t offset = header_bytes() + (seq % h->slot_count) * h->slot_bytes;
+    return (shm_slot_t *)((uint8_t *)base + offset);
+}
+
+static int valid_name(const char *name)
+{
+    if (name == NULL || name[0] != '/') {
+        return 0;
+    }
+    size_t len = strlen(name);
+    return (len > 1 && len < CT_SHM_NAME_MAX && strchr(name + 1, '/') == NULL) ? 1 : 0;
+}
+
+/*===========================================================================*/
+/* Header lock                                                                */
+/*===========================================================================*/
+
+/* Whether a process has exited. A zombie counts as alive until its parent
+ * reaps it, and a pid that is merely not ours to signal is alive */
+static int process_gone(int32_t pid)
+{
+    return (pid > 0 && kill((pid_t)pid, 0) != 0 && errno == ESRCH) ? 1 : 0;
+}
+
+/* Held only for a bounded scan of the client table; never across a copy.
+ * Spins a bounded number of times, then takes the lock over if its owner
+ * has died inside it, or gives up with CT_SHM_AGAIN */
+static int header_lock(shm_header_t *h)
+{
+    uint32_t self = (uint32_t)getpid();
+    for (uint32_t spin = 0; spin < SHM_LOCK_SPINS; spin++) {
+        uint32_t expected = 0;
+        if (__atomic_load_n(&h->lock, __ATOMIC_RELAXED) == 0U &&
+            __atomic_compare_exchange_n(&h->lock, &expected, self, 0,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return CT_SHM_OK;
+        }
+    }
+    uint32_t owner = __atomic_load_n(&h->lock, __ATOMIC_RELAXED);
+    if (owner != 0U && process_gone((int32_t)owner) &&
+        __atomic_compare_exchange_n(&h->lock, &owner, self, 0,
+                                    __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return CT_SHM_OK;
+    }
+    return CT_SHM_AGAIN;
+}
+
+static void header_unlock(shm_header_t *h)
+{
+    __atomic_store_n(&h->lock, 0U, __ATOMIC_RELEASE);
+}
+
+/* Drop client c if its process has exited; caller holds the lock */
+static int evict_if_gone(shm_header_t *h, uint32_t c)
+{
+    if (!process_gone(__atomic_load_n(&h->client_pid[c], __ATOMIC_RELAXED))) {
+        return 0;
+    }
+    __atomic_store_n(&h->client_active[c], 0U, __ATOMIC_RELEASE);
+    return 1;
+}
+
+/*===========================================================================*/
+/* ct_shm_region_size                                                         */
+/*===========================================================================*/
+
+size_t ct_shm_region_size(const ct_shm_params_t *params)
+{
+    uint64_t per_slot = slot_bytes(params->batch_size, params->max_elements);
+    if (per_slot == 0 || params->slot_count == 0) {
+        return 0;
+    }
+    uint64_t total = header_bytes() + (uint64_t)params->slot_count * per_slot;
+    if (total > (uint64_t)SIZE_MAX) {
+        return 0;
+    }
+    return (size_t)total;
+}
+
+/*===========================================================================*/
+/* Server                                                                     */
+/*===========================================================================*/
+
+int ct_shm_server_create(ct_shm_server_t *server,
+                         const char *name,
+                         const ct_shm_params_t *params)
+{
+    memset(server, 0, sizeof(*server));
+    size_t size = ct_shm_region_size(params);
+    if (size == 0 || !valid_name(name) || size > (size_t)INT64_MAX) {
+        return CT_SHM_ERROR;
+    }
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return CT_SHM_ERROR;
+    }
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return CT_SHM_ERROR;
+    }
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        shm_unlink(name);
+        return CT_SHM_ERROR;
+    }
+
+    /* ftruncate zero-fills: only non-zero fields need writing */
+    shm_header_t *h = (shm_header_t *)base;
+    h->layout = SHM_LAYOUT;
+    h->slot_count = params->slot_count;
+    h->batch_size = params->batch_size;
+    h->max_elements = params->max_elements;
+    h->slot_bytes = slot_bytes(params->batch_size, params->max_elements);
+    h->region_bytes = (uint64_t)size;
+    memcpy(h->dataset_hash, params->dataset_hash, 32);
+    memcpy(h->config_hash, params->config_hash, 32);
+    for (uint64_t s = 0; s < params->slot_count; s++) {
+        slot_at(base, h, s)->seq = SHM_SEQ_WRITING;
+    }
+    __atomic_store_n(&h->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+
+    server->base = base;
+    server->size = size;
+    server->next_seq = 0;
+    memcpy(server->name, name, strlen(name) + 1);
+    return CT_SHM_OK;
+}
+
+int ct_shm_server_publish(ct_shm_server_t *server,
+                          const ct_batch_t *batch,
+                          uint32_t epoch)
+{
+    shm_header_t *h = (shm_header_t *)server->base;
+
+    if (batch->batch_size != h->batch_size) {
+        return CT_SHM_ERROR;
+    }
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        const ct_sample_t *s = &batch->samples[i];
+        if (s->total_elements > h->max_elements ||
+            s->ndims > CT_MAX_DIMS ||
+            (s->total_elements != 0 && s->data == NULL)) {
+            return CT_SHM_ERROR;
+        }
+    }
+
+    uint64_t seq = server->next_seq;
+    shm_slot_t *slot = slot_at(server->base, h, seq);
+
+    /* Claim the slot: every active client must be past its previous batch.
+     * A client still behind whose process has exited is dropped instead */
+    if (header_lock(h) != CT_SHM_OK) {
+        return CT_SHM_AGAIN;
+    }
+    if (seq >= h->slot_count) {
+        uint64_t oldest = seq - h->slot_count;
+        for (uint32_t c = 0; c < CT_SHM_MAX_CLIENTS; c++) {
+            if (__atomic_load_n(&h->client_active[c], __ATOMIC_ACQUIRE) != 0U &&
+                __atomic_load_n(&h->client_cursor[c], __ATOMIC_ACQUIRE) <= oldest &&
+                !evict_if_gone(h, c)) {
+                header_unlock(h);
+                return CT_SHM_AGAIN;
+            }
+        }
+    }
+    __atomic_store_n(&slot->seq, SHM_SEQ_WRITING, __ATOMIC_RELAXED);
+    header_unlock(h);
+
+    uint8_t *slot_base = (uint8_t *)slot;
+    shm_sample_t *headers = (shm_sample_t *)(slot_base + slot_headers_offset());
+    ct_hash_t *hashes = (ct_hash_t *)(slot_base + slot_hashes_offset(h->batch_size));
+    int32_t *data = (int32_t *)(slot_base + slot_data_offset(h->batch_size));
+
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        const ct_sample_t *s = &batch->samples[i];
+        headers[i].version = s->version;
+        headers[i].dtype = s->dtype;
+        headers[i].ndims = s->ndims;
+        memcpy(headers[i].dims, s->dims, sizeof(headers[i].dims));
+        headers[i].total_elements = s->total_elements;
+        memcpy(hashes[i], batch->sample_hashes[i], 32);
+        if (s->total_elements != 0) {
+            memcpy(&data[(size_t)i * h->max_elements], s->data,
+                   (size_t)s->total_elements * sizeof(int32_t));
+        }
+    }
+    slot->epoch = epoch;
+    slot->batch_index = batch->batch_index;
+    memcpy(slot->batch_hash, batch->batch_hash, 32);
+
+    __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&h->write_seq, seq + 1U, __ATOMIC_RELEASE);
+    server->next_seq = seq + 1U;
+    return CT_SHM_OK;
+}
+
+int ct_shm_server_set_provenance(ct_shm_server_t *server,
+                                 const ct_provenance_t *prov)
+{
+    shm_header_t *h = (shm_header_t *)server->base;
+    if (header_lock(h) != CT_SHM_OK) {
+        return CT_SHM_AGAIN;
+    }
+    h->prov_epoch = prov->current_epoch;
+    h->prov_total = prov->total_epochs;
+    memcpy(h->prov_hash, prov->current_hash, 32);
+    memcpy(h->prov_prev, prov->prev_hash, 32);
+    header_unlock(h);
+    return CT_SHM_OK;
+}
+
+int ct_shm_server_reap(ct_shm_server_t *server, uint32_t *evicted)
+{
+    shm_header_t *h = (shm_header_t *)server->base;
+    uint32_t count = 0;
+    if (evicted != NULL) {
+        *evicted = 0;
+    }
+    if (header_lock(h) != CT_SHM_OK) {
+        return CT_SHM_AGAIN;
+    }
+    for (uint32_t c = 0; c < CT_SHM_MAX_CLIENTS; c++) {
+        if (__atomic_load_n(&h->client_active[c], __ATOMIC_ACQUIRE) != 0U) {
+            count += (uint32_t)evict_if_gone(h, c);
+        }
+    }
+    header_unlock(h);
+    if (evicted != NULL) {
+        *evicted = count;
+    }
+    return CT_SHM_OK;
+}
+
+void ct_shm_server_close(ct_shm_server_t *server)
+{
+    shm_header_t *h = (shm_header_t *)server->base;
+    __atomic_store_n(&h->closed, 1U, __ATOMIC_RELEASE);
+}
+
+void ct_shm_server_destroy(ct_shm_server_t *server)
+{
+    if (server->base == NULL) {
+        return;
+    }
+    ct_shm_server_close(server);
+    munmap(server->base, server->size);
+    shm_unlink(server->name);
+    memset(server, 0, sizeof(*server));
+}
+
+/*===========================================================================*/
+/* Client                                                                     */
+/*===========================================================================*/
+
+int ct_shm_client_attach(ct_shm_client_t *client, const char *name)
+{
+    memset(client, 0, sizeof(*client));
+    if (!valid_name(name)) {
+        return CT_SHM_ERROR;
+    }
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return CT_SHM_ERROR;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return CT_SHM_ERROR;
+    }
+    if (st.st_size < (off_t)header_bytes()) {
+        /* Created but not yet sized by ct_shm_server_create */
+        close(fd);
+        return CT_SHM_AGAIN;
+    }
+    size_t size = (size_t)st.st_size;
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return CT_SHM_ERROR;
+    }
+
+    /* Magic is stored last: zero means the server is still filling the
+     * header. Reject anything not laid out by this version of
+     * ct_shm_server_create */
+    shm_header_t *h = (shm_header_t *)base;
+    uint32_t magic = __atomic_load_n(&h->magic, __ATOMIC_ACQUIRE);
+    if (magic == 0U) {
+        munmap(base, size);
+        return CT_SHM_AGAIN;
+    }
+    if (magic != SHM_MAGIC ||
+        h->layout != SHM_LAYOUT ||
+        h->region_bytes != (uint64_t)size ||
+        h->slot_count == 0 ||
+        h->slot_bytes != slot_bytes(h->batch_size, h->max_elements) ||
+        header_bytes() + (uint64_t)h->slot_count * h->slot_bytes != h->region_bytes) {
+        munmap(base, size);
+        return CT_SHM_ERROR;
+    }
+
+    /* Join at the live edge, atomically with respect to slot claims. The
+     * entry of a client that died attached is free */
+    if (header_lock(h) != CT_SHM_OK) {
+        munmap(base, size);
+        return CT_SHM_AGAIN;
+    }
+    uint32_t id = CT_SHM_MAX_CLIENTS;
+    for (uint32_t c = 0; c < CT_SHM_MAX_CLIENTS; c++) {
+        if (__atomic_load_n(&h->client_active[c], __ATOMIC_ACQUIRE) == 0U ||
+            evict_if_gone(h, c)) {
+            id = c;
+            break;
+        }
+    }
+    if (id == CT_SHM_MAX_CLIENTS) {
+        header_unlock(h);
+        munmap(base, size);
+        return CT_SHM_ERROR;
+    }
+    uint64_t cursor = __atomic_load_n(&h->write_seq, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&h->client_pid[id], (int32_t)getpid(), __ATOMIC_RELAXED);
+    __atomic_store_n(&h->client_cursor[id], cursor, __ATOMIC_RELEASE);
+    __atomic_store_n(&h->client_active[id], 1U, __ATOMIC_RELEASE);
+    header_unlock(h);
+
+    client->base = base;
+    client->size = size;
+    client->client_id = id;
+    client->held = 0;
+    client->cursor = cursor;
+    client->batch_size = h->batch_size;
+    client->max_elements = h->max_elements;
+    return CT_SHM_OK;
+}
+
+int ct_shm_client_acquire(ct_shm_client_t *client,
+                          ct_batch_t *view,
+                          ct_sample_t *samples,
+                          uint32_t *epoch)
+{
+    if (client->held != 0U) {
+        return CT_SHM_ERROR;
+    }
+    shm_header_t *h = (shm_header_t *)client->base;
+
+    /* Read closed before write_seq so the final publish is never missed */
+    uint32_t closed = __atomic_load_n(&h->closed, __ATOMIC_ACQUIRE);
+    uint64_t published = __atomic_load_n(&h->write_seq, __ATOMIC_ACQUIRE);
+    if (client->cursor >= published) {
+        return (closed != 0U) ? CT_SHM_CLOSED : CT_SHM_AGAIN;
+    }
+
+    shm_slot_t *slot = slot_at(client->base, h, client->cursor);
+    if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != client->cursor) {
+        return CT_SHM_ERROR;
+    }
+
+    uint8_t *slot_base = (uint8_t *)slot;
+    const shm_sample_t *headers = (const shm_sample_t *)(slot_base + slot_headers_offset());
+    ct_hash_t *hashes = (ct_hash_t *)(slot_base + slot_hashes_offset(h->batch_size));
+    int32_t *data = (int32_t *)(slot_base + slot_data_offset(h->batch_size));
+
+    for (uint32_t i = 0; i < h->batch_size; i++) {
+        samples[i].version = headers[i].version;
+        samples[i].dtype = headers[i].dtype;
+        samples[i].ndims = headers[i].ndims;
+        memcpy(samples[i].dims, headers[i].dims, sizeof(samples[i].dims));
+        samples[i].total_elements = headers[i].total_elements;
+        samples[i].data = (headers[i].total_elements != 0)
+                        ? &data[(size_t)i * h->max_elements] : NULL;
+    }
+
+    view->samples = samples;
+    view->sample_hashes = hashes;
+    view->batch_size = h->batch_size;
+    view->batch_index = slot->batch_index;
+    memcpy(view->batch_hash, slot->batch_hash, 32);
+    if (epoch != NULL) {
+        *epoch = slot->epoch;
+    }
+
+    client->held = 1;
+    return CT_SHM_OK;
+}
+
+void ct_shm_client_release(ct_shm_client_t *client)
+{
+    if (client->held == 0U) {
+        return;
+    }
+    shm_header_t *h = (shm_header_t *)client->base;
+    client->held = 0;
+    client->cursor++;
+    __atomic_store_n(&h->client_cursor[client->client_id], client->cursor, __ATOMIC_RELEASE);
+}
+
+int ct_shm_client_commitments(ct_shm_client_t *client,
+                              ct_hash_t dataset_hash,
+                              ct_hash_t config_hash,
+                              ct_provenance_t *prov)
+{
+    shm_header_t *h = (shm_header_t *)client->base;
+    if (header_lock(h) != CT_SHM_OK) {
+        return CT_SHM_AGAIN;
+    }
+    if (dataset_hash != NULL) {
+        memcpy(dataset_hash, h->dataset_hash, 32);
+    }
+    if (config_hash != NULL) {
+        memcpy(config_hash, h->config_hash, 32);
+    }
+    if (prov != NULL) {
+        prov->current_epoch = h->prov_epoch;
+        prov->total_epochs = h->prov_total;
+        memcpy(prov->current_hash, h->prov_hash, 32);
+        memcpy(prov->prev_hash, h->prov_prev, 32);
+    }
+    header_unlock(h);
+    return CT_SHM_OK;
+}
+
+int ct_shm_view_verify(const ct_batch_t *view)
+{
+    static const ct_hash_t zero = {0};
+
+    for (uint32_t i = 0; i < view->batch_size; i++) {
+        const ct_sample_t *s = &view->samples[i];
+
+        /* Padding slots of a partial batch carry a zero hash (ct_batch_fill) */
+        if (s->version == 0 && s->total_elements == 0) {
+            if (memcmp(view->sample_hashes[i], zero, 32) != 0) {
+                return 0;
+            }
+            continue;
+        }
+
+        ct_hash_t h;
+        ct_hash_sample(s, h);
+        if (memcmp(h, view->sample_hashes[i], 32) != 0) {
+            return 0;
+        }
+    }
+
+    ct_hash_t computed;
+    ct_hash_batch(view, computed);
+    return (memcmp(computed, view->batch_hash, 32) == 0) ? 1 : 0;
+}
+
+void ct_shm_client_detach(ct_shm_client_t *client)
+{
+    if (client->base == NULL) {
+        return;
+    }
+    shm_header_t *h = (shm_header_t *)client->base;
+    __atomic_store_n(&h->client_active[client->client_id], 0U, __ATOMIC_RELEASE);
+    munmap(client->base, client->size);
+    memset(client, 0, sizeof(*client));
+}
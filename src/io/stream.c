@@ -0,0 +1,302 @@
+/**
+ * @file stream.c
+ * @project Certifiable Data Pipeline
+ * @brief Framed batch streaming over a local stream socket.
+ *
+ * @details Frame metadata is little-endian. Sample data travels in host
+ *          order: the protocol is for peers on the same host, and a peer of
+ *          the other byte order fails the magic check on the first frame.
+ *
+ *          The sender issues one sendmsg per SEND_CHUNK samples, gathering
+ *          the small per-frame headers from the stack and the sample data
+ *          from the batch itself. The receiver reads each fixed-size frame
+ *          header, then the sample data straight into the caller's buffer.
+ *
+ * @traceability CT-STRUCT-001 §21
+ * @compliance MISRA-C:2012, ISO 26262, IEC 62304
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust. All rights reserved.
+ * @license Licensed under the GPL-3.0 (Open Source) or Commercial License.
+ *          For commercial licensing: william@fstopify.com
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "stream.h"
+#include "merkle.h"
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#define SEND_CHUNK        32U
+#define BEGIN_FRAME       (CT_STREAM_FRAME_HEADER + CT_STREAM_BEGIN_BYTES)
+#define SAMPLE_FRAME      (CT_STREAM_FRAME_HEADER + CT_STREAM_SAMPLE_META)
+#define END_FRAME         (CT_STREAM_FRAME_HEADER + CT_STREAM_END_BYTES)
+
+/*===========================================================================*/
+/* Byte order helpers                                                         */
+/*===========================================================================*/
+
+static void put_u32_le(uint8_t *buf, uint32_t v)
+{
+    buf[0] = (uint8_t)(v & 0xFF);
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);
+    buf[2] = (uint8_t)((v >> 16) & 0xFF);
+    buf[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t get_u32_le(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) |
+           ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static void put_frame_header(uint8_t *buf, uint32_t type, uint32_t length)
+{
+    put_u32_le(buf, CT_STREAM_MAGIC);
+    put_u32_le(buf + 4, type);
+    put_u32_le(buf + 8, length);
+}
+
+/* Returns 1 if buf starts a frame of this type and payload length */
+static int frame_is(const uint8_t *buf, uint32_t type, uint32_t length)
+{
+    return get_u32_le(buf) == CT_STREAM_MAGIC &&
+           get_u32_le(buf + 4) == type &&
+           get_u32_le(buf + 8) == length;
+}
+
+/*===========================================================================*/
+/* I/O helpers                                                                */
+/*===========================================================================*/
+
+static int send_all(int fd, struct iovec *iov, uint32_t iovcnt)
+{
+    while (iovcnt > 0) {
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = iovcnt;
+
+        ssize_t sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+
+        /* Skip what went out; resume mid-iovec after a short send */
+        size_t left = (size_t)sent;
+        while (iovcnt > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (iovcnt > 0) {
+            iov->iov_base = (uint8_t *)iov->iov_base + left;
+            iov->iov_len -= left;
+        }
+    }
+    return 0;
+}
+
+/* Returns 0 when filled, 1 on end of stream before the first byte, -1 otherwise */
+static int read_full(int fd, void *buf, size_t n)
+{
+    uint8_t *p = (uint8_t *)buf;
+    size_t got = 0;
+    while (got < n) {
+        ssize_t r = read(fd, p + got, n - got);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (r == 0) {
+            return (got == 0) ? 1 : -1;
+        }
+        got += (size_t)r;
+    }
+    return 0;
+}
+
+/*===========================================================================*/
+/* ct_stream_send_batch                                                       */
+/*===========================================================================*/
+
+int ct_stream_send_batch(int fd, const ct_batch_t *batch, uint32_t epoch)
+{
+    uint8_t begin[BEGIN_FRAME];
+    uint8_t end[END_FRAME];
+    uint8_t meta[SEND_CHUNK][SAMPLE_FRAME];
+    struct iovec iov[2U * SEND_CHUNK + 2U];
+
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        const ct_sample_t *s = &batch->samples[i];
+        if (s->ndims > CT_MAX_DIMS || s->total_elements > CT_MAX_SAMPLE_SIZE ||
+            (s->total_elements != 0 && s->data == NULL)) {
+            return CT_STREAM_ERROR;
+        }
+    }
+
+    put_frame_header(begin, CT_STREAM_FRAME_BEGIN, CT_STREAM_BEGIN_BYTES);
+    put_u32_le(begin + 12, epoch);
+    put_u32_le(begin + 16, batch->batch_index);
+    put_u32_le(begin + 20, batch->batch_size);
+
+    put_frame_header(end, CT_STREAM_FRAME_END, CT_STREAM_END_BYTES);
+    memcpy(end + CT_STREAM_FRAME_HEADER, batch->batch_hash, 32);
+
+    uint32_t base = 0;
+    do {
+        uint32_t n = 0;
+        if (base == 0) {
+            iov[n].iov_base = begin;
+            iov[n].iov_len = sizeof(begin);
+            n++;
+        }
+
+        uint32_t len = batch->batch_size - base;
+        if (len > SEND_CHUNK) {
+            len = SEND_CHUNK;
+        }
+        for (uint32_t j = 0; j < len; j++) {
+            const ct_sample_t *s = &batch->samples[base + j];
+            size_t bytes = (size_t)s->total_elements * sizeof(int32_t);
+            uint8_t *m = meta[j];
+
+            put_frame_header(m, CT_STREAM_FRAME_SAMPLE, CT_STREAM_SAMPLE_META + (uint32_t)bytes);
+            put_u32_le(m + 12, s->version);
+            put_u32_le(m + 16, s->dtype);
+            put_u32_le(m + 20, s->ndims);
+            for (uint32_t d = 0; d < CT_MAX_DIMS; d++) {
+                put_u32_le(m + 24 + 4 * d, s->dims[d]);
+            }
+            put_u32_le(m + 40, s->total_elements);
+            memcpy(m + 44, batch->sample_hashes[base + j], 32);
+
+            iov[n].iov_base = m;
+            iov[n].iov_len = SAMPLE_FRAME;
+            n++;
+            if (bytes != 0) {
+                iov[n].iov_base = s->data;
+                iov[n].iov_len = bytes;
+                n++;
+            }
+        }
+        base += len;
+
+        if (base == batch->batch_size) {
+            iov[n].iov_base = end;
+            iov[n].iov_len = sizeof(end);
+            n++;
+        }
+        if (send_all(fd, iov, n) != 0) {
+            return CT_STREAM_ERROR;
+        }
+    } while (base < batch->batch_size);
+
+    return CT_STREAM_OK;
+}
+
+/*===========================================================================*/
+/* ct_stream_recv_batch                                                       */
+/*===========================================================================*/
+
+int ct_stream_recv_batch(int fd,
+                         ct_batch_t *batch,
+                         int32_t *data_buf,
+                         uint32_t capacity,
+                         uint32_t flags,
+                         uint32_t *epoch)
+{
+    static const ct_hash_t zero = {0};
+    uint8_t buf[SAMPLE_FRAME];
+
+    int status = read_full(fd, buf, BEGIN_FRAME);
+    if (status != 0) {
+        return (status > 0) ? CT_STREAM_EOF : CT_STREAM_ERROR;
+    }
+    if (!frame_is(buf, CT_STREAM_FRAME_BEGIN, CT_STREAM_BEGIN_BYTES) ||
+        get_u32_le(buf + 20) != batch->batch_size) {
+        return CT_STREAM_ERROR;
+    }
+    uint32_t batch_epoch = get_u32_le(buf + 12);
+    batch->batch_index = get_u32_le(buf + 16);
+
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+    int corrupt = 0;
+    uint32_t offset = 0;
+
+    for (uint32_t i = 0; i < batch->batch_size; i++) {
+        if (read_full(fd, buf, SAMPLE_FRAME) != 0 ||
+            get_u32_le(buf) != CT_STREAM_MAGIC ||
+            get_u32_le(buf + 4) != CT_STREAM_FRAME_SAMPLE) {
+            return CT_STREAM_ERROR;
+        }
+
+        ct_sample_t *s = &batch->samples[i];
+        s->version = get_u32_le(buf + 12);
+        s->dtype = get_u32_le(buf + 16);
+        s->ndims = get_u32_le(buf + 20);
+        for (uint32_t d = 0; d < CT_MAX_DIMS; d++) {
+            s->dims[d] = get_u32_le(buf + 24 + 4 * d);
+        }
+        s->total_elements = get_u32_le(buf + 40);
+        memcpy(batch->sample_hashes[i], buf + 44, 32);
+
+        /* Bounds before the payload length so the product cannot wrap */
+        if (s->ndims > CT_MAX_DIMS || s->total_elements > CT_MAX_SAMPLE_SIZE ||
+            get_u32_le(buf + 8) != CT_STREAM_SAMPLE_META + s->total_elements * 4U ||
+            s->total_elements > capacity - offset) {
+            return CT_STREAM_ERROR;
+        }
+
+        s->data = NULL;
+        if (s->total_elements != 0) {
+            s->data = &data_buf[offset];
+            if (read_full(fd, s->data, (size_t)s->total_elements * sizeof(int32_t)) != 0) {
+                return CT_STREAM_ERROR;
+            }
+            offset += s->total_elements;
+        }
+
+        if (corrupt) {
+            continue;
+        }
+        if ((flags & CT_STREAM_VERIFY_SAMPLES) != 0U) {
+            /* Padding slots carry a zero hash (ct_batch_fill) */
+            if (s->version == 0 && s->total_elements == 0) {
+                corrupt = memcmp(batch->sample_hashes[i], zero, 32) != 0;
+            } else {
+                ct_hash_t h;
+                ct_hash_sample(s, h);
+                corrupt = memcmp(h, batch->sample_hashes[i], 32) != 0;
+            }
+        }
+        ct_merkle_acc_push(&acc, batch->sample_hashes[i]);
+    }
+
+    if (read_full(fd, buf, END_FRAME) != 0 ||
+        !frame_is(buf, CT_STREAM_FRAME_END, CT_STREAM_END_BYTES)) {
+        return CT_STREAM_ERROR;
+    }
+    memcpy(batch->batch_hash, buf + CT_STREAM_FRAME_HEADER, 32);
+
+    if (!corrupt) {
+        ct_hash_t root;
+        ct_merkle_acc_finish(&acc, root);
+        corrupt = memcmp(root, batch->batch_hash, 32) != 0;
+    }
+    if (epoch != NULL) {
+        *epoch = batch_epoch;
+    }
+    return corrupt ? CT_STREAM_CORRUPT : CT_STREAM_OK;
+}
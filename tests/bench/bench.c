@@ -0,0 +1,373 @@
+/**
+ * @file bench.c
+ * @project Certifiable Data Pipeline
+ * @brief Throughput of the data path, next to a plain baseline for each.
+ *
+ * @details Informational only: nothing is checked, and the target is not
+ *          registered as a test, so wall-clock noise never reaches the unit
+ *          tests. Run it from a Release build; CT_DISPATCH_BACKEND selects
+ *          the kernels measured.
+ *
+ * @traceability CT-MATH-001 §5, §7.6, §7.7, §8.7, §8.8, §8.9, §8.10, CT-STRUCT-001 §23
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "ct_types.h"
+#include "augment.h"
+#include "dispatch.h"
+#include "kernels.h"
+#include "layout.h"
+#include "prng.h"
+#include "shuffle.h"
+
+static double seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* ============================================================================
+ * Bounded draws (CT-MATH-001 §5)
+ * ============================================================================ */
+
+/* Bounding pre-drawn words to a crop-sized range and a large one */
+static void bench_bound(void)
+{
+    enum { N = 4096, REPS = 500 };
+    static uint64_t u[N];
+    static uint32_t out[N];
+    static const uint32_t BOUNDS[2] = { 161, 1000003U };
+    const ct_dispatch_t *k = ct_dispatch_get();
+    for (uint32_t i = 0; i < N; i++) {
+        u[i] = ct_prng(0x0123456789ABCDEFULL, 0, i);
+    }
+
+    for (uint32_t b = 0; b < 2; b++) {
+        double t0 = seconds();
+        for (uint32_t r = 0; r < REPS; r++) {
+            for (uint32_t i = 0; i < N; i++) {
+                out[i] = ct_prng_bound(u[i] + r, BOUNDS[b]);
+            }
+        }
+        double t1 = seconds();
+        for (uint32_t r = 0; r < REPS; r++) {
+            for (uint32_t i = 0; i < N; i++) {
+                out[i] = ct_prng_bound_v2(u[i] + r, BOUNDS[b]);
+            }
+        }
+        double t2 = seconds();
+        for (uint32_t r = 0; r < REPS; r++) {
+            u[r] += out[r];
+            k->bound_v2(u, out, N, BOUNDS[b]);
+        }
+        double t3 = seconds();
+        double draws = (double)N * REPS * 1e-6;
+        printf("  Bounded draw n=%u: v1 %.0f M/s, v2 %.0f M/s, v2 bulk %.0f M/s\n",
+               BOUNDS[b], draws / (t1 - t0), draws / (t2 - t1), draws / (t3 - t2));
+    }
+}
+
+/* ============================================================================
+ * Epoch orderings (CT-MATH-001 §7.6, §7.7)
+ * ============================================================================ */
+
+#define ORDER_N    (1U << 20)
+#define ORDER_LEN  4096U
+
+static uint32_t g_weights[ORDER_N];
+static uint32_t g_prob[ORDER_N];
+static uint32_t g_alias[ORDER_N];
+static uint32_t g_work[ORDER_N];
+static uint32_t g_order[ORDER_LEN];
+
+static void bench_alias(void)
+{
+    enum { REPS = 256 };
+    for (uint32_t i = 0; i < ORDER_N; i++) {
+        g_weights[i] = 1U + (i % 13U);
+    }
+    ct_alias_table_t table;
+    double t0 = seconds();
+    (void)ct_alias_build(&table, g_weights, ORDER_N, g_prob, g_alias, g_work);
+    double t1 = seconds();
+    uint32_t sink = 0;
+    for (uint32_t r = 0; r < REPS; r++) {
+        ct_permute_range(r * ORDER_LEN, ORDER_LEN, ORDER_N, 42, 0, g_order);
+        sink ^= g_order[r % ORDER_LEN];
+    }
+    double t2 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        ct_alias_draw_range(&table, 42, 0, r * ORDER_LEN, ORDER_LEN, g_order);
+        sink ^= g_order[r % ORDER_LEN];
+    }
+    double t3 = seconds();
+
+    double draws = (double)ORDER_LEN * REPS;
+    printf("  Alias N=2^20: build %.1f ms, %.1f M draws/s, permute %.1f M/s [%u]\n",
+           (t1 - t0) * 1e3, draws / (t3 - t2) * 1e-6, draws / (t2 - t1) * 1e-6, sink & 1U);
+}
+
+/* 1000 classes, one slot each: the weight array holds the labels */
+static void bench_strata(void)
+{
+    enum { C = 1000, BATCHES = 64 };
+    static uint32_t quota[C], offsets[C + 1], slots[C];
+    for (uint32_t i = 0; i < ORDER_N; i++) {
+        g_weights[i] = (i * 7919U) % C;
+    }
+    for (uint32_t c = 0; c < C; c++) {
+        quota[c] = 1;
+    }
+    ct_strata_t strata;
+    uint32_t sink = 0;
+    double t0 = seconds();
+    (void)ct_strata_build(&strata, g_weights, ORDER_N, quota, C, offsets, g_prob, slots, g_work);
+    double t1 = seconds();
+    for (uint32_t b = 0; b < BATCHES; b++) {
+        for (uint32_t c = 0; c < C; c++) {
+            ct_strata_class_range(&strata, 42, 0, c, b, 1, g_order);
+            sink ^= g_order[0];
+        }
+    }
+    double t2 = seconds();
+    printf("  Stratified, 1000 classes: build %.1f ms, %.1f k batches of 1000/s [%u]\n",
+           (t1 - t0) * 1e3, BATCHES / (t2 - t1) * 1e-3, sink & 1U);
+}
+
+/* ============================================================================
+ * Layout conversion (CT-STRUCT-001 §23)
+ * ============================================================================ */
+
+#define IMAGE_SIZE  (224 * 224 * 3)
+
+static int32_t g_image_src[IMAGE_SIZE];
+static int32_t g_image_dst[IMAGE_SIZE];
+
+static void bench_layout(void)
+{
+    enum { REPS = 200 };
+    uint32_t total = IMAGE_SIZE;
+    double bytes = (double)total * sizeof(int32_t) * REPS;
+    ct_sample_t hwc = { 1, CT_DTYPE_Q16_16, 3, { 224, 224, 3 }, total, g_image_src };
+    ct_sample_t chw = { 0, 0, 0, { 0 }, 0, g_image_dst };
+    for (uint32_t i = 0; i < total; i++) {
+        g_image_src[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+    }
+
+    double t0 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        memcpy(g_image_dst, g_image_src, (size_t)total * sizeof(int32_t));
+        g_image_src[r % total] ^= g_image_dst[(r * 7U) % total];
+    }
+    double t1 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        (void)ct_layout_sample(&hwc, CT_LAYOUT_HWC, CT_LAYOUT_CHW, &chw);
+        g_image_src[r % total] ^= g_image_dst[(r * 7U) % total];
+    }
+    double t2 = seconds();
+
+    double copy = bytes / (t1 - t0) * 1e-9;
+    double transpose = bytes / (t2 - t1) * 1e-9;
+    printf("  HWC→CHW 224×224×3: %.2f GB/s, memcpy %.2f GB/s (%.0f%%)\n",
+           transpose, copy, 100.0 * transpose / copy);
+}
+
+/* ============================================================================
+ * Augmentation (CT-MATH-001 §8.7 – §8.10)
+ * ============================================================================ */
+
+#define PLANE_SIDE  224U
+
+static int32_t g_plane_src[PLANE_SIDE * PLANE_SIDE];
+static int32_t g_plane_dst[PLANE_SIDE * PLANE_SIDE];
+
+/* One 224×224 rotated and zoomed plane per rep, through a given kernel */
+static double warp_mpixels(ct_kernel_warp_row_fn warp)
+{
+    enum { REPS = 100 };
+    int32_t m00 = 58000, m01 = -21000, m10 = 21000, m11 = 58000;
+    int32_t ox = 2000000, oy = -1000000;
+
+    double t0 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        for (uint32_t y = 0; y < PLANE_SIDE; y++) {
+            warp(g_plane_src, PLANE_SIDE, PLANE_SIDE, CT_WARP_ZERO,
+                 ox + (int32_t)y * m01, oy + (int32_t)y * m11, m00, m10,
+                 &g_plane_dst[y * PLANE_SIDE], PLANE_SIDE);
+        }
+        g_plane_src[r] ^= g_plane_dst[(r * 7U) % (PLANE_SIDE * PLANE_SIDE)];
+    }
+    double t1 = seconds();
+    return (double)REPS * PLANE_SIDE * PLANE_SIDE / (t1 - t0) * 1e-6;
+}
+
+static void bench_warp(void)
+{
+    for (uint32_t i = 0; i < PLANE_SIDE * PLANE_SIDE; i++) {
+        g_plane_src[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+    }
+    double scalar = warp_mpixels(ct_kernel_warp_row_scalar);
+    double fast = warp_mpixels(ct_dispatch_get()->warp_row);
+    printf("  Bilinear warp 224×224: %.1f Mpixel/s, scalar %.1f Mpixel/s (%.1f×)\n",
+           fast, scalar, fast / scalar);
+}
+
+/* One full-plane rectangle per rep: cutout against memset of the same rows */
+static void bench_cutout(void)
+{
+    enum { REPS = 2000 };
+    int32_t values[2] = { 0, FIXED_HALF };
+    ct_augment_flags_t flags = {0};
+    flags.cutout = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0xE2A5E, 3, flags);
+    ctx.cutout_count = 1;
+    ctx.cutout_height = PLANE_SIDE;
+    ctx.cutout_width = PLANE_SIDE;
+    ct_sample_t input = { 1, CT_DTYPE_Q16_16, 2, { PLANE_SIDE, PLANE_SIDE, 0, 0 },
+                          PLANE_SIDE * PLANE_SIDE, g_plane_dst };
+    double bytes = (double)PLANE_SIDE * PLANE_SIDE * sizeof(int32_t) * REPS;
+
+    double t0 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        for (uint32_t y = 0; y < PLANE_SIDE; y++) {
+            memset(&g_plane_dst[y * PLANE_SIDE], (int)(r & 1U), PLANE_SIDE * sizeof(int32_t));
+        }
+    }
+    double t1 = seconds();
+    double base = bytes / (t1 - t0) * 1e-9;
+
+    /* A sample index whose rectangle is drawn at the top-left covers the plane */
+    uint32_t idx = 0;
+    while (ct_prng_uniform(ctx.seed, ctx.epoch, (idx << 16) | 0x0400, PLANE_SIDE) != PLANE_SIDE - 1U ||
+           ct_prng_uniform(ctx.seed, ctx.epoch, ((idx << 16) | 0x0400) + 1U, PLANE_SIDE) != PLANE_SIDE - 1U) {
+        idx++;
+    }
+    for (uint32_t v = 0; v < 2; v++) {
+        ctx.cutout_value = values[v];
+        double t2 = seconds();
+        for (uint32_t r = 0; r < REPS; r++) {
+            ct_sample_t output;
+            ct_fault_flags_t faults = {0};
+            ct_augment_sample(&ctx, &input, &output, idx, &faults);
+        }
+        double t3 = seconds();
+        double fill = bytes / (t3 - t2) * 1e-9;
+        printf("  Cutout 224×224 fill 0x%08X: %.2f GB/s, memset %.2f GB/s (%.0f%%)\n",
+               (unsigned)values[v], fill, base, 100.0 * fill / base);
+    }
+}
+
+/* Blend of two 224×224×3 samples per rep, through a given kernel */
+static double lerp_gbytes(ct_kernel_lerp_fn lerp, const int32_t *a, const int32_t *b,
+                          int32_t *out, uint32_t n)
+{
+    enum { REPS = 200 };
+    double t0 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        lerp(a, b, (int32_t)(0x4000U + r), out, n);
+    }
+    double t1 = seconds();
+    return (double)REPS * n * 3.0 * sizeof(int32_t) / (t1 - t0) * 1e-9;
+}
+
+static void bench_mix(void)
+{
+    static int32_t a[IMAGE_SIZE];
+    static int32_t b[IMAGE_SIZE];
+    static int32_t out[IMAGE_SIZE];
+    uint32_t n = IMAGE_SIZE;
+    for (uint32_t i = 0; i < n; i++) {
+        a[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+        b[i] = (int32_t)(0x85EBCA6BU * (i + 1U));
+    }
+    double scalar = lerp_gbytes(ct_kernel_lerp_q16_scalar, a, b, out, n);
+    double fast = lerp_gbytes(ct_dispatch_get()->lerp_q16, a, b, out, n);
+    printf("  Mixup blend 224×224×3: %.2f GB/s, scalar %.2f GB/s (%.1f×)\n",
+           fast, scalar, fast / scalar);
+}
+
+/* Decisions for 4096 samples: one plan call against a draw per op_id */
+static void bench_plan(void)
+{
+    enum { N = 4096, REPS = 50 };
+    static ct_augment_decision_t plan[N];
+    ct_augment_flags_t flags = {0};
+    flags.h_flip = 1;
+    flags.random_crop = 1;
+    flags.rot90 = 1;
+    flags.affine = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0x0DDBA11CAFEF00DULL, 9, flags);
+    ctx.crop_height = 3;
+    ctx.crop_width = 4;
+    ctx.affine_max_angle = FIXED_HALF;
+    ctx.affine_scale_min = FIXED_HALF + FIXED_HALF / 2;
+    ctx.affine_scale_max = FIXED_ONE + FIXED_HALF;
+    volatile uint32_t sink = 0;
+
+    double t0 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        for (uint32_t i = 0; i < N; i++) {
+            uint32_t op = (r * N + i) << 16;
+            sink += (uint32_t)(ct_prng(ctx.seed, ctx.epoch, op | 0x0100) & 1U);
+            sink += ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0001, 5);
+            sink += ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0002, 5);
+            sink += (uint32_t)(ct_prng(ctx.seed, ctx.epoch, op | 0x0200) & 3U);
+            sink += ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0201,
+                                    2U * (uint32_t)ctx.affine_max_angle + 1U);
+            sink += ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0202,
+                                    (uint32_t)(ctx.affine_scale_max - ctx.affine_scale_min) + 1U);
+        }
+    }
+    double t1 = seconds();
+    for (uint32_t r = 0; r < REPS; r++) {
+        ct_augment_plan_batch(&ctx, r * N, N, plan);
+        sink += plan[r].turns;
+    }
+    double t2 = seconds();
+
+    double one = (double)REPS * N / (t1 - t0) * 1e-6;
+    double bulk = (double)REPS * N / (t2 - t1) * 1e-6;
+    printf("  Decision plan, 6 draws/sample: %.1f Msample/s, per draw %.1f Msample/s "
+           "(%.1f×)\n", bulk, one, bulk / one);
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Throughput (informational)\n");
+    printf("Backend: %s\n", ct_backend_name(ct_dispatch_get()->backend));
+    printf("==============================================\n\n");
+
+    printf("Bounded draws:\n");
+    bench_bound();
+
+    printf("\nEpoch orderings:\n");
+    bench_alias();
+    bench_strata();
+
+    printf("\nLayout conversion:\n");
+    bench_layout();
+
+    printf("\nAugmentation:\n");
+    bench_warp();
+    bench_cutout();
+    bench_mix();
+    bench_plan();
+
+    return 0;
+}
@@ -3,7 +3,7 @@
  * @project Certifiable Data Pipeline
  * @brief Unit tests for deterministic augmentation
  *
- * @traceability SRS-003-AUGMENT, CT-MATH-001 §6
+ * @traceability SRS-003-AUGMENT, CT-MATH-001 §6, §8.7, §8.8, §8.9, §8.10
  *
  * @author William Murray
  * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
@@ -14,6 +14,11 @@
 #include <string.h>
 #include "ct_types.h"
 #include "augment.h"
+#include "batch.h"
+#include "dispatch.h"
+#include "kernels.h"
+#include "dvm.h"
+#include "prng.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -470,6 +475,826 @@ static int test_augment_batch(void)
     return 1;
 }
 
+/* ============================================================================
+ * Test: Noise Range Planning (CT-MATH-001 §14.5)
+ * ============================================================================ */
+
+static int test_noise_plan_identical(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.gaussian_noise = 1;
+
+    ct_augment_ctx_t checked;
+    ct_augment_ctx_t planned;
+    ct_augment_init(&checked, 0xABCDEF0123456789ULL, 3, flags);
+    ct_augment_init(&planned, 0xABCDEF0123456789ULL, 3, flags);
+    checked.noise_std = FIXED_ONE / 10;
+    planned.noise_std = FIXED_ONE / 10;
+
+    ct_range_t range = { -(1000 << 16), 1000 << 16 };
+    if (ct_augment_plan(&planned, range) != 1) return 0;
+    if (planned.noise_plan_std != planned.noise_std) return 0;
+
+    int32_t d1[37];
+    int32_t d2[37];
+    for (uint32_t i = 0; i < 37; i++) {
+        d1[i] = (i & 1U) ? range.max - (int32_t)i : range.min + (int32_t)i;
+        d2[i] = d1[i];
+    }
+    ct_sample_t in1 = {.version = 1, .ndims = 2, .dims = {1, 37, 0, 0}, .total_elements = 37, .data = d1};
+    ct_sample_t in2 = {.version = 1, .ndims = 2, .dims = {1, 37, 0, 0}, .total_elements = 37, .data = d2};
+    ct_sample_t o1;
+    ct_sample_t o2;
+    ct_fault_flags_t f1 = {0};
+    ct_fault_flags_t f2 = {0};
+
+    ct_augment_sample(&checked, &in1, &o1, 5, &f1);
+    ct_augment_sample(&planned, &in2, &o2, 5, &f2);
+
+    if (memcmp(o1.data, o2.data, sizeof(d1)) != 0) return 0;
+    return f1.overflow == f2.overflow && f1.underflow == f2.underflow;
+}
+
+static int test_noise_plan_rejects_large_std(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.gaussian_noise = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 1, 0, flags);
+
+    /* Noise of ±1.0 spans the whole int32 range */
+    ctx.noise_std = FIXED_ONE;
+    ct_range_t range = { -FIXED_ONE, FIXED_ONE };
+    if (ct_augment_plan(&ctx, range) != 0) return 0;
+    if (ctx.noise_plan_std != 0) return 0;
+
+    /* Small noise, but data at the top of the range */
+    ctx.noise_std = FIXED_ONE / 100;
+    range.max = INT32_MAX - 16;
+    return ct_augment_plan(&ctx, range) == 0;
+}
+
+static int test_noise_plan_tied_to_std(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.gaussian_noise = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 99, 1, flags);
+    if (ctx.noise_plan_std != 0) return 0;
+
+    ctx.noise_std = FIXED_ONE / 100;
+    ct_range_t range = { 0, FIXED_ONE };
+    if (ct_augment_plan(&ctx, range) != 1) return 0;
+
+    /* Changing noise_std after planning falls back to the checked path */
+    ctx.noise_std = INT32_MAX;
+    int32_t d[2] = {INT32_MAX, INT32_MIN};
+    ct_sample_t in = {.version = 1, .ndims = 2, .dims = {1, 2, 0, 0}, .total_elements = 2, .data = d};
+    ct_sample_t out;
+    ct_fault_flags_t f = {0};
+    ct_augment_sample(&ctx, &in, &out, 0, &f);
+
+    return f.overflow || f.underflow;
+}
+
+/* ============================================================================
+ * Test: Narrow Formats (CT-MATH-001 §3.10)
+ * ============================================================================ */
+
+static int test_augment16_geometry_matches_q16(void)
+{
+    /* Flip and crop only move elements: the narrow path must make the same
+     * decisions as the Q16.16 path for every sample index. */
+    ct_augment_flags_t flags = {0};
+    flags.h_flip = 1;
+    flags.random_crop = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0x0F1E2D3C4B5A6978ULL, 2, flags);
+    ctx.crop_width = 3;
+    ctx.crop_height = 2;
+
+    for (uint32_t idx = 0; idx < 16; idx++) {
+        int32_t d32[20];
+        int16_t d16[20];
+        for (uint32_t i = 0; i < 20; i++) {
+            d16[i] = (int16_t)(i * 0x0100 - 0x0800);
+            d32[i] = dvm_widen16(d16[i], CT_FRAC_Q8_8);
+        }
+        ct_sample_t in32 = {.version = 1, .ndims = 2, .dims = {4, 5, 0, 0}, .total_elements = 20, .data = d32};
+        ct_sample16_t in16 = {.version = 1, .dtype = CT_DTYPE_Q8_8, .ndims = 2, .dims = {4, 5, 0, 0}, .total_elements = 20, .data = d16};
+        ct_sample_t o32;
+        ct_sample16_t o16;
+        ct_fault_flags_t faults = {0};
+
+        ct_augment_sample(&ctx, &in32, &o32, idx, &faults);
+        ct_augment_sample16(&ctx, &in16, &o16, idx, &faults);
+
+        if (o16.total_elements != 6 || o32.total_elements != 6) return 0;
+        for (uint32_t i = 0; i < 6; i++) {
+            if (dvm_widen16(o16.data[i], CT_FRAC_Q8_8) != o32.data[i]) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_augment16_noise_bounded_deterministic(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.gaussian_noise = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0x1122334455667788ULL, 4, flags);
+    ctx.noise_std = FIXED_ONE / 4;
+
+    enum { N = 301 };
+    int16_t d1[N];
+    int16_t d2[N];
+    for (uint32_t i = 0; i < N; i++) {
+        d1[i] = (int16_t)((int32_t)(i % 32) * 0x0100);
+        d2[i] = d1[i];
+    }
+    ct_sample16_t in1 = {.version = 1, .dtype = CT_DTYPE_Q8_8, .ndims = 2, .dims = {1, N, 0, 0}, .total_elements = N, .data = d1};
+    ct_sample16_t in2 = in1;
+    in2.data = d2;
+    ct_sample16_t o1;
+    ct_sample16_t o2;
+    ct_fault_flags_t f1 = {0};
+    ct_fault_flags_t f2 = {0};
+
+    ct_augment_sample16(&ctx, &in1, &o1, 9, &f1);
+    ct_augment_sample16(&ctx, &in2, &o2, 9, &f2);
+    if (memcmp(d1, d2, sizeof(d1)) != 0) return 0;
+    if (f1.overflow || f1.underflow || f2.overflow || f2.underflow) return 0;
+
+    /* |noise| ≤ std = 0x40 in Q8.8, and not all zero */
+    int changed = 0;
+    for (uint32_t i = 0; i < N; i++) {
+        int32_t orig = (int32_t)(i % 32) * 0x0100;
+        int32_t delta = d1[i] - orig;
+        if (delta > 0x40 || delta < -0x40) return 0;
+        changed |= (delta != 0);
+    }
+    return changed;
+}
+
+static int test_augment16_unknown_dtype(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.gaussian_noise = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 1, 0, flags);
+    ctx.noise_std = FIXED_ONE;
+
+    int16_t d[2] = {1, 2};
+    ct_sample16_t in = {.version = 1, .dtype = CT_DTYPE_Q16_16, .ndims = 1, .dims = {2, 0, 0, 0}, .total_elements = 2, .data = d};
+    ct_sample16_t out;
+    ct_fault_flags_t faults = {0};
+    ct_augment_sample16(&ctx, &in, &out, 0, &faults);
+
+    return faults.domain == 1 && d[0] == 1 && d[1] == 2;
+}
+
+/* ============================================================================
+ * Test: Geometry (CT-MATH-001 §8.7)
+ * ============================================================================ */
+
+#define Q(v)  ((int32_t)((v) * FIXED_ONE))
+
+static ct_sample_t geom_sample(uint32_t ndims, uint32_t d0, uint32_t d1, uint32_t d2,
+                               int32_t *data)
+{
+    ct_sample_t s = { 1, CT_DTYPE_Q16_16, ndims, { d0, d1, d2, 0 },
+                      (ndims == 3) ? d0 * d1 * d2 : d0 * d1, data };
+    return s;
+}
+
+static int test_geometry_identity(void)
+{
+    ct_augment_flags_t flags = {0};
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 7, 1, flags);
+
+    int32_t in[2 * 3 * 5];
+    int32_t out[2 * 3 * 5];
+    for (uint32_t i = 0; i < 30; i++) {
+        in[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+    }
+    ct_sample_t input = geom_sample(3, 2, 3, 5, in);
+    ct_sample_t output = { 0, 0, 0, { 0 }, 0, out };
+    ct_fault_flags_t faults = {0};
+    ct_augment_geometry(&ctx, &input, &output, 3, &faults);
+
+    return !faults.domain && output.data == out && output.ndims == 3 &&
+           output.dims[0] == 2 && output.dims[1] == 3 && output.dims[2] == 5 &&
+           output.total_elements == 30 && memcmp(in, out, sizeof(in)) == 0;
+}
+
+/* Every quarter turn is an exact permutation; turns follow op_id 0x0200 */
+static int test_geometry_rot90_exact(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.rot90 = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0xC0FFEE, 2, flags);
+
+    enum { H = 3, W = 5 };
+    int32_t in[H * W];
+    int32_t out[H * W];
+    for (uint32_t i = 0; i < H * W; i++) {
+        in[i] = Q(i + 1) + (int32_t)i;
+    }
+    ct_sample_t input = geom_sample(2, H, W, 0, in);
+
+    uint32_t seen = 0;
+    for (uint32_t idx = 0; idx < 64; idx++) {
+        uint32_t k = (uint32_t)(ct_prng(ctx.seed, ctx.epoch, (idx << 16) | 0x0200) & 3U);
+        ct_sample_t output = { 0, 0, 0, { 0 }, 0, out };
+        ct_fault_flags_t faults = {0};
+        ct_augment_geometry(&ctx, &input, &output, idx, &faults);
+        if (faults.domain) return 0;
+
+        uint32_t oh = (k & 1U) ? W : H;
+        uint32_t ow = (k & 1U) ? H : W;
+        if (output.dims[0] != oh || output.dims[1] != ow) return 0;
+        for (uint32_t y = 0; y < oh; y++) {
+            for (uint32_t x = 0; x < ow; x++) {
+                uint32_t sy = (k == 0) ? y : (k == 1) ? x : (k == 2) ? H - 1 - y : H - 1 - x;
+                uint32_t sx = (k == 0) ? x : (k == 1) ? W - 1 - y : (k == 2) ? W - 1 - x : y;
+                if (out[y * ow + x] != in[sy * W + sx]) return 0;
+            }
+        }
+        seen |= 1U << k;
+    }
+    return seen == 0xF;
+}
+
+/* 2×2 → 4×4 samples at −¼, ¼, ¾, 1¼ with replicated edges */
+static int test_geometry_resize_vectors(void)
+{
+    static const int32_t EXPECT_UP[16] = {
+        Q(0), Q(1), Q(3), Q(4),
+        Q(2), Q(3), Q(5), Q(6),
+        Q(6), Q(7), Q(9), Q(10),
+        Q(8), Q(9), Q(11), Q(12)
+    };
+    ct_augment_flags_t flags = {0};
+    flags.resize = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 1, 0, flags);
+    ctx.resize_height = 4;
+    ctx.resize_width = 4;
+
+    int32_t in[4] = { Q(0), Q(4), Q(8), Q(12) };
+    int32_t up[16];
+    ct_sample_t input = geom_sample(2, 2, 2, 0, in);
+    ct_sample_t output = { 0, 0, 0, { 0 }, 0, up };
+    ct_fault_flags_t faults = {0};
+    ct_augment_geometry(&ctx, &input, &output, 0, &faults);
+    if (faults.domain || output.total_elements != 16 || output.dims[0] != 4 ||
+        memcmp(up, EXPECT_UP, sizeof(up)) != 0) return 0;
+
+    /* And back: 4×4 → 2×2 samples at ½ and 2½ */
+    static const int32_t EXPECT_DOWN[4] = { Q(1.5), Q(4.5), Q(7.5), Q(10.5) };
+    int32_t down[4];
+    ctx.resize_height = 2;
+    ctx.resize_width = 2;
+    ct_sample_t big = geom_sample(2, 4, 4, 0, up);
+    ct_sample_t small = { 0, 0, 0, { 0 }, 0, down };
+    ct_augment_geometry(&ctx, &big, &small, 0, &faults);
+    return !faults.domain && memcmp(down, EXPECT_DOWN, sizeof(down)) == 0;
+}
+
+/* Interpolation rounds to nearest, ties to even, in both border modes */
+static int test_geometry_kernel_rounding(void)
+{
+    int32_t img[3] = { 0, 1, 2 };
+    int32_t out[3];
+    const ct_dispatch_t *k = ct_dispatch_get();
+
+    k->warp_row(img, 3, 1, CT_WARP_ZERO, FIXED_HALF, 0, FIXED_ONE, 0, out, 3);
+    if (out[0] != 0 || out[1] != 2 || out[2] != 1) return 0;   /* ½, 1½, 2½ → 1 with 0 */
+    k->warp_row(img, 3, 1, CT_WARP_REPLICATE, FIXED_HALF, 0, FIXED_ONE, 0, out, 3);
+    if (out[0] != 0 || out[1] != 2 || out[2] != 2) return 0;
+    k->warp_row(img, 3, 1, CT_WARP_ZERO, -FIXED_ONE / 4, 0, FIXED_HALF, 0, out, 3);
+    return out[0] == 0 && out[1] == 0 && out[2] == 1;           /* −¼, ¼, ¾: 0, 0.25, 0.75 */
+}
+
+/* Fixed 2× zoom of a ramp; rotation keeps the centre and zero-fills corners */
+static int test_geometry_affine(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.affine = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 99, 4, flags);
+    ctx.affine_scale_min = 2 * FIXED_ONE;
+    ctx.affine_scale_max = 2 * FIXED_ONE;
+
+    static const int32_t EXPECT_ZOOM[4] = { Q(3), Q(5), Q(7), Q(9) };
+    int32_t ramp[4] = { Q(0), Q(4), Q(8), Q(12) };
+    int32_t zoom[4];
+    ct_sample_t input = geom_sample(2, 1, 4, 0, ramp);
+    ct_sample_t output = { 0, 0, 0, { 0 }, 0, zoom };
+    ct_fault_flags_t faults = {0};
+    ct_augment_geometry(&ctx, &input, &output, 0, &faults);
+    if (faults.domain || memcmp(zoom, EXPECT_ZOOM, sizeof(zoom)) != 0) return 0;
+
+    /* 9×9 constant; pick a sample whose angle exceeds 0.3 rad */
+    enum { N = 9 };
+    int32_t flat[N * N];
+    int32_t a[N * N];
+    int32_t b[N * N];
+    for (uint32_t i = 0; i < N * N; i++) {
+        flat[i] = Q(3);
+    }
+    ctx.affine_scale_min = FIXED_ONE;
+    ctx.affine_scale_max = FIXED_ONE;
+    ctx.affine_max_angle = CT_AUGMENT_MAX_ANGLE;
+    uint32_t idx = 0;
+    while ((int32_t)ct_prng_uniform(ctx.seed, ctx.epoch, (idx << 16) | 0x0201,
+                                    2U * CT_AUGMENT_MAX_ANGLE + 1U) - CT_AUGMENT_MAX_ANGLE
+           < 19661) {
+        idx++;
+    }
+    ct_sample_t square = geom_sample(2, N, N, 0, flat);
+    ct_sample_t out_a = { 0, 0, 0, { 0 }, 0, a };
+    ct_sample_t out_b = { 0, 0, 0, { 0 }, 0, b };
+    ct_augment_geometry(&ctx, &square, &out_a, idx, &faults);
+    ct_augment_geometry(&ctx, &square, &out_b, idx, &faults);
+    if (faults.domain || memcmp(a, b, sizeof(a)) != 0) return 0;
+
+    for (uint32_t y = 2; y <= 6; y++) {
+        for (uint32_t x = 2; x <= 6; x++) {
+            if (a[y * N + x] != Q(3)) return 0;
+        }
+    }
+    return a[0] < Q(3) && a[N * N - 1] < Q(3);
+}
+
+static int test_geometry_rejects(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.affine = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 5, 0, flags);
+
+    int32_t in[4] = { 1, 2, 3, 4 };
+    int32_t out[4] = { 0 };
+    ct_sample_t input = geom_sample(2, 2, 2, 0, in);
+    ct_sample_t output = { 0, 0, 0, { 0 }, 0, out };
+    uint32_t rejected = 0;
+
+    for (uint32_t c = 0; c < 6; c++) {
+        ct_augment_ctx_t bad = ctx;
+        ct_sample_t s = input;
+        if (c == 0) bad.affine_max_angle = CT_AUGMENT_MAX_ANGLE + 1;
+        if (c == 1) bad.affine_scale_min = 3 * FIXED_ONE / 2;
+        if (c == 2) bad.affine_scale_min = FIXED_HALF - 1;
+        if (c == 3) { bad.flags.resize = 1; bad.resize_width = 4; }
+        if (c == 4) s.ndims = 1;
+        if (c == 5) s.total_elements = 3;
+        ct_fault_flags_t faults = {0};
+        ct_augment_geometry(&bad, &s, &output, 0, &faults);
+        rejected += faults.domain;
+    }
+    return rejected == 6 && output.ndims == 0 && out[0] == 0;
+}
+
+/* ============================================================================
+ * Test: Cutout (CT-MATH-001 §8.8)
+ * ============================================================================ */
+
+#define CUT_H  8U
+#define CUT_W  10U
+
+/* Marks the pixels of an H × W plane that sample idx erases, per §8.8 */
+static void cutout_mask(const ct_augment_ctx_t *ctx, uint32_t idx, uint32_t height,
+                        uint32_t width, uint8_t *mask)
+{
+    uint32_t max_h = (ctx->cutout_height < height) ? ctx->cutout_height : height;
+    uint32_t max_w = (ctx->cutout_width < width) ? ctx->cutout_width : width;
+    uint32_t count = ct_prng_uniform(ctx->seed, ctx->epoch, (idx << 16) | 0x0300,
+                                     ctx->cutout_count) + 1U;
+    memset(mask, 0, (size_t)height * width);
+    for (uint32_t r = 0; r < count; r++) {
+        uint32_t id = (idx << 16) | (0x0400U + 4U * r);
+        uint32_t h = ct_prng_uniform(ctx->seed, ctx->epoch, id, max_h) + 1U;
+        uint32_t w = ct_prng_uniform(ctx->seed, ctx->epoch, id + 1U, max_w) + 1U;
+        uint32_t top = ct_prng_uniform(ctx->seed, ctx->epoch, id + 2U, height - h + 1U);
+        uint32_t left = ct_prng_uniform(ctx->seed, ctx->epoch, id + 3U, width - w + 1U);
+        for (uint32_t y = top; y < top + h; y++) {
+            memset(&mask[y * width + left], 1, w);
+        }
+    }
+}
+
+static ct_augment_ctx_t cutout_ctx(uint32_t count, uint32_t h, uint32_t w, int32_t value)
+{
+    ct_augment_flags_t flags = {0};
+    flags.cutout = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0xE2A5E, 3, flags);
+    ctx.cutout_count = count;
+    ctx.cutout_height = h;
+    ctx.cutout_width = w;
+    ctx.cutout_value = value;
+    return ctx;
+}
+
+static int test_cutout_constant(void)
+{
+    ct_augment_ctx_t ctx = cutout_ctx(3, 4, 5, Q(7) + 3);
+    int32_t data[CUT_H * CUT_W];
+    uint8_t mask[CUT_H * CUT_W];
+    uint32_t erased = 0;
+
+    for (uint32_t idx = 0; idx < 32; idx++) {
+        for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+            data[i] = Q(1) + (int32_t)i;
+        }
+        ct_sample_t input = geom_sample(2, CUT_H, CUT_W, 0, data);
+        ct_sample_t output;
+        ct_fault_flags_t faults = {0};
+        ct_augment_sample(&ctx, &input, &output, idx, &faults);
+        if (faults.domain) return 0;
+
+        cutout_mask(&ctx, idx, CUT_H, CUT_W, mask);
+        for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+            int32_t expect = mask[i] ? Q(7) + 3 : Q(1) + (int32_t)i;
+            if (data[i] != expect) return 0;
+            erased += mask[i];
+        }
+    }
+    return erased > 0;
+}
+
+/* Zero fill (the memset path) hits the same rectangles in every plane;
+ * oversized rectangles clip to the image */
+static int test_cutout_planes_and_clip(void)
+{
+    ct_augment_ctx_t ctx = cutout_ctx(2, 100, 3, 0);
+    int32_t data[3 * CUT_H * CUT_W];
+    uint8_t mask[CUT_H * CUT_W];
+    for (uint32_t i = 0; i < 3 * CUT_H * CUT_W; i++) {
+        data[i] = -Q(2);
+    }
+    ct_sample_t input = geom_sample(3, 3, CUT_H, CUT_W, data);
+    ct_sample_t output;
+    ct_fault_flags_t faults = {0};
+    ct_augment_sample(&ctx, &input, &output, 11, &faults);
+
+    cutout_mask(&ctx, 11, CUT_H, CUT_W, mask);
+    for (uint32_t c = 0; c < 3; c++) {
+        for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+            if (data[c * CUT_H * CUT_W + i] != (mask[i] ? 0 : -Q(2))) return 0;
+        }
+    }
+    return !faults.domain;
+}
+
+static int test_cutout_noise(void)
+{
+    ct_augment_ctx_t ctx = cutout_ctx(1, CUT_H, CUT_W, Q(0.5));
+    ctx.cutout_noise = 1;
+    int32_t a[2 * CUT_H * CUT_W];
+    int32_t b[2 * CUT_H * CUT_W];
+    uint8_t mask[CUT_H * CUT_W];
+    for (uint32_t i = 0; i < 2 * CUT_H * CUT_W; i++) {
+        a[i] = b[i] = Q(9);
+    }
+    ct_sample_t sa = geom_sample(3, 2, CUT_H, CUT_W, a);
+    ct_sample_t sb = geom_sample(3, 2, CUT_H, CUT_W, b);
+    ct_sample_t out;
+    ct_fault_flags_t faults = {0};
+    ct_augment_sample(&ctx, &sa, &out, 5, &faults);
+    ct_augment_sample(&ctx, &sb, &out, 5, &faults);
+    if (faults.domain || memcmp(a, b, sizeof(a)) != 0) return 0;
+
+    cutout_mask(&ctx, 5, CUT_H, CUT_W, mask);
+    int planes_differ = 0;
+    for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+        for (uint32_t c = 0; c < 2; c++) {
+            int32_t v = a[c * CUT_H * CUT_W + i];
+            if (!mask[i] && v != Q(9)) return 0;
+            if (mask[i] && (v < -Q(0.5) || v > Q(0.5))) return 0;
+        }
+        planes_differ |= mask[i] && a[i] != a[CUT_H * CUT_W + i];
+    }
+    return planes_differ;
+}
+
+static int test_cutout_rejects(void)
+{
+    ct_augment_ctx_t ctx = cutout_ctx(CT_AUGMENT_MAX_CUTOUTS + 1U, 2, 2, 0);
+    int32_t data[4] = { 1, 2, 3, 4 };
+    ct_sample_t input = geom_sample(2, 2, 2, 0, data);
+    ct_sample_t output;
+    ct_fault_flags_t faults = {0};
+    ct_augment_sample(&ctx, &input, &output, 0, &faults);
+    if (!faults.domain) return 0;
+
+    ctx.cutout_count = 1;
+    input.ndims = 4;
+    input.dims[3] = 1;
+    faults.domain = 0;
+    ct_augment_sample(&ctx, &input, &output, 0, &faults);
+    return faults.domain && data[0] == 1 && data[1] == 2 && data[2] == 3 && data[3] == 4;
+}
+
+/* ============================================================================
+ * Test: Batch Mixing (CT-MATH-001 §8.9)
+ * ============================================================================ */
+
+#define MIX_B     5U
+#define MIX_C     2U
+#define MIX_SIZE  (MIX_C * CUT_H * CUT_W)
+
+static int32_t g_mix_data[MIX_B][MIX_SIZE];
+static int32_t g_mix_buf[MIX_B * MIX_SIZE];
+static ct_sample_t g_mix_in[MIX_B];
+static ct_sample_t g_mix_out[MIX_B];
+static ct_hash_t g_mix_in_hashes[MIX_B];
+static ct_hash_t g_mix_out_hashes[MIX_B];
+
+/* Batch of `filled` [C, H, W] samples then padding; constant samples hold
+ * (slot + 1) × 1.0, the others a different ramp per slot */
+static void mix_batch(ct_batch_t *in, ct_batch_t *out, uint32_t filled, int constant)
+{
+    ct_batch_init(in, g_mix_in, g_mix_in_hashes, MIX_B);
+    ct_batch_init(out, g_mix_out, g_mix_out_hashes, MIX_B);
+    in->batch_index = 7;
+    for (uint32_t s = 0; s < MIX_B; s++) {
+        for (uint32_t e = 0; e < MIX_SIZE; e++) {
+            g_mix_data[s][e] = constant ? Q(1) * (int32_t)(s + 1U) :
+                               (int32_t)(0x9E3779B9U * (s * MIX_SIZE + e + 1U)) / 4;
+        }
+        memset(&g_mix_in[s], 0, sizeof(ct_sample_t));
+        memset(g_mix_in_hashes[s], 0, 32);
+        if (s < filled) {
+            g_mix_in[s] = geom_sample(3, MIX_C, CUT_H, CUT_W, g_mix_data[s]);
+            g_mix_in_hashes[s][0] = (uint8_t)(s + 1U);
+        }
+    }
+    memset(in->batch_hash, 0xA5, 32);
+}
+
+static ct_augment_ctx_t mix_ctx(int mixup, int cutmix, int32_t lo, int32_t hi)
+{
+    ct_augment_flags_t flags = {0};
+    flags.mixup = mixup ? 1U : 0U;
+    flags.cutmix = cutmix ? 1U : 0U;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0x5EED, 2, flags);
+    ctx.mix_lambda_min = lo;
+    ctx.mix_lambda_max = hi;
+    return ctx;
+}
+
+/* λ·a + (1 − λ)·b, rounded to nearest with ties to even, from first principles */
+static int32_t blend_ref(int32_t a, int32_t b, int32_t lambda)
+{
+    int64_t p = (int64_t)a * lambda + (int64_t)b * (FIXED_ONE - lambda);
+    int64_t q = p >> 16;
+    int64_t r = p & 0xFFFF;
+    if (r > 0x8000 || (r == 0x8000 && (q & 1) != 0)) {
+        q++;
+    }
+    return (int32_t)q;
+}
+
+static int test_mix_mixup_blend(void)
+{
+    ct_batch_t in, out;
+    ct_mix_label_t labels[MIX_B], again[MIX_B];
+    ct_augment_ctx_t ctx = mix_ctx(1, 0, Q(0.25), Q(0.75));
+    mix_batch(&in, &out, MIX_B, 0);
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != 0) return 0;
+
+    for (uint32_t s = 0; s < MIX_B; s++) {
+        uint32_t p = labels[s].partner;
+        if (p == s || p >= MIX_B) return 0;
+        if (labels[s].weight < Q(0.25) || labels[s].weight > Q(0.75)) return 0;
+        if (out.samples[s].data != &g_mix_buf[s * MIX_SIZE] ||
+            out.samples[s].ndims != 3 || out.samples[s].dims[0] != MIX_C) return 0;
+        for (uint32_t e = 0; e < MIX_SIZE; e++) {
+            if (out.samples[s].data[e] !=
+                blend_ref(g_mix_data[s][e], g_mix_data[p][e], labels[s].weight)) return 0;
+        }
+        if (memcmp(out.sample_hashes[s], in.sample_hashes[s], 32) != 0) return 0;
+    }
+    if (memcmp(out.batch_hash, in.batch_hash, 32) != 0 || out.batch_index != 7) return 0;
+
+    /* Replays exactly */
+    static int32_t first[MIX_B * MIX_SIZE];
+    memcpy(first, g_mix_buf, sizeof(first));
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, again) != 0) return 0;
+    return memcmp(first, g_mix_buf, sizeof(first)) == 0 &&
+           memcmp(labels, again, sizeof(labels)) == 0;
+}
+
+/* Every plane gets the same partner rectangle, and the label weight is the
+ * exact share of pixels left alone */
+static int test_mix_cutmix_rectangle(void)
+{
+    ct_batch_t in, out;
+    ct_mix_label_t labels[MIX_B];
+    ct_augment_ctx_t ctx = mix_ctx(0, 1, 0, FIXED_ONE);
+    uint32_t pasted_total = 0;
+
+    for (uint32_t b = 0; b < 8; b++) {
+        mix_batch(&in, &out, MIX_B, 1);
+        in.batch_index = b;
+        if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != 0) {
+            return 0;
+        }
+        for (uint32_t s = 0; s < MIX_B; s++) {
+            const int32_t *v = out.samples[s].data;
+            int32_t own = Q(1) * (int32_t)(s + 1U);
+            int32_t other = Q(1) * (int32_t)(labels[s].partner + 1U);
+            uint32_t pasted = 0;
+            for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+                if (v[i] != own && v[i] != other) return 0;
+                if (v[i] != v[CUT_H * CUT_W + i]) return 0;
+                pasted += (v[i] == other);
+            }
+            int64_t keep = (int64_t)(CUT_H * CUT_W - pasted) * FIXED_ONE;
+            int64_t weight = (keep + CUT_H * CUT_W / 2) / (CUT_H * CUT_W);
+            if (labels[s].weight != (int32_t)weight) return 0;
+            pasted_total += pasted;
+        }
+    }
+    return pasted_total > 0;
+}
+
+/* Padding slots and a lone filled sample pass through with weight 1.0 */
+static int test_mix_padding_and_single(void)
+{
+    ct_batch_t in, out;
+    ct_mix_label_t labels[MIX_B];
+    ct_augment_ctx_t ctx = mix_ctx(1, 1, 0, FIXED_ONE);
+
+    mix_batch(&in, &out, 3, 0);
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, 3 * MIX_SIZE, labels) != 0) return 0;
+    for (uint32_t s = 3; s < MIX_B; s++) {
+        if (labels[s].partner != s || labels[s].weight != FIXED_ONE ||
+            out.samples[s].data != NULL || out.samples[s].total_elements != 0) return 0;
+    }
+
+    mix_batch(&in, &out, 1, 0);
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_SIZE, labels) != 0) return 0;
+    return labels[0].partner == 0 && labels[0].weight == FIXED_ONE &&
+           memcmp(g_mix_buf, g_mix_data[0], sizeof(g_mix_data[0])) == 0;
+}
+
+static int test_mix_rejects(void)
+{
+    ct_batch_t in, out;
+    ct_mix_label_t labels[MIX_B];
+    memset(labels, 0x7E, sizeof(labels));
+    ct_augment_ctx_t ctx = mix_ctx(0, 1, Q(0.5), Q(0.25));
+    mix_batch(&in, &out, MIX_B, 0);
+    const int32_t *untouched = g_mix_out[0].data;
+
+    /* Inverted, negative and above-one λ ranges */
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != -1) return 0;
+    ctx.mix_lambda_min = -1;
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != -1) return 0;
+    ctx.mix_lambda_min = 0;
+    ctx.mix_lambda_max = FIXED_ONE + 1;
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != -1) return 0;
+    ctx.mix_lambda_max = FIXED_ONE;
+
+    /* Buffer one element short; mismatched shapes; a 4-D sample for cutmix */
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE - 1, labels) != -1) return 0;
+    g_mix_in[2].dims[1] = CUT_W;
+    g_mix_in[2].dims[2] = CUT_H;
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != -1) return 0;
+    for (uint32_t s = 0; s < MIX_B; s++) {
+        g_mix_in[s].ndims = 4;
+        g_mix_in[s].dims[3] = 1;
+    }
+    if (ct_augment_mix_batch(&ctx, &in, &out, g_mix_buf, MIX_B * MIX_SIZE, labels) != -1) return 0;
+
+    return labels[0].partner == 0x7E7E7E7EU && out.samples[0].data == untouched;
+}
+
+/* ============================================================================
+ * Test: Decision Planning (CT-MATH-001 §8.10)
+ * ============================================================================ */
+
+#define PLAN_N  150U
+
+static ct_augment_ctx_t plan_ctx(void)
+{
+    ct_augment_flags_t flags = {0};
+    flags.h_flip = 1;
+    flags.random_crop = 1;
+    flags.rot90 = 1;
+    flags.affine = 1;
+    ct_augment_ctx_t ctx;
+    ct_augment_init(&ctx, 0x0DDBA11CAFEF00DULL, 9, flags);
+    ctx.crop_height = 3;
+    ctx.crop_width = 4;
+    ctx.affine_max_angle = Q(0.5);
+    ctx.affine_scale_min = Q(0.75);
+    ctx.affine_scale_max = Q(1.5);
+    return ctx;
+}
+
+/* Every record equals the draw made one op_id at a time, across chunk
+ * boundaries and across the op_id wrap at sample index 2^16 */
+static int test_plan_matches_draws(void)
+{
+    static ct_augment_decision_t plan[PLAN_N];
+    ct_augment_ctx_t ctx = plan_ctx();
+    uint32_t first = 0xFFFFU - 70U;
+    ct_augment_plan_batch(&ctx, first, PLAN_N, plan);
+
+    for (uint32_t i = 0; i < PLAN_N; i++) {
+        uint32_t op = (first + i) << 16;
+        const ct_augment_decision_t *d = &plan[i];
+        if (d->sample_idx != first + i) return 0;
+        if (d->h_flip != (ct_prng(ctx.seed, ctx.epoch, op | 0x0100) & 1U)) return 0;
+        if (d->crop_x != ct_prng(ctx.seed, ctx.epoch, op | 0x0001)) return 0;
+        if (d->crop_y != ct_prng(ctx.seed, ctx.epoch, op | 0x0002)) return 0;
+        if (d->turns != (ct_prng(ctx.seed, ctx.epoch, op | 0x0200) & 3U)) return 0;
+        int32_t angle = (int32_t)ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0201,
+                                                 2U * (uint32_t)Q(0.5) + 1U) - Q(0.5);
+        int32_t scale = Q(0.75) + (int32_t)ct_prng_uniform(ctx.seed, ctx.epoch, op | 0x0202,
+                                                           (uint32_t)Q(0.75) + 1U);
+        if (d->angle != angle || d->scale != scale) return 0;
+    }
+    return 1;
+}
+
+static int test_plan_defaults(void)
+{
+    ct_augment_decision_t plan[3];
+    ct_augment_ctx_t ctx = plan_ctx();
+    ctx.flags.h_flip = 0;
+    ctx.flags.rot90 = 0;
+    ctx.crop_width = 0;
+    ctx.affine_scale_min = Q(3.0);   /* Invalid: faults at execution */
+    ct_augment_plan_batch(&ctx, 40, 3, plan);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        if (plan[i].sample_idx != 40U + i || plan[i].h_flip != 0 || plan[i].turns != 0 ||
+            plan[i].crop_x != 0 || plan[i].crop_y != 0 ||
+            plan[i].angle != 0 || plan[i].scale != FIXED_ONE) return 0;
+    }
+
+    ct_fault_flags_t faults = {0};
+    int32_t out_data[CUT_H * CUT_W];
+    ct_sample_t input = geom_sample(2, CUT_H, CUT_W, 0, g_mix_data[0]);
+    ct_sample_t output = geom_sample(2, 0, 0, 0, out_data);
+    ct_augment_geometry_planned(&ctx, &plan[0], &input, &output, &faults);
+    return faults.domain == 1;
+}
+
+/* Planned execution equals the per-sample entry points, which draw as before */
+static int test_plan_executes_like_sample(void)
+{
+    enum { B = 70 };
+    static int32_t in_data[B][CUT_H * CUT_W];
+    static int32_t out_data[B][CUT_H * CUT_W];
+    static ct_sample_t in_s[B], out_s[B];
+    int32_t ref_data[CUT_H * CUT_W];
+    ct_augment_ctx_t ctx = plan_ctx();
+    ctx.flags.gaussian_noise = 1;
+    ctx.noise_std = Q(0.01);
+
+    for (uint32_t s = 0; s < B; s++) {
+        for (uint32_t i = 0; i < CUT_H * CUT_W; i++) {
+            in_data[s][i] = (int32_t)(0x9E3779B9U * (s * 131U + i + 1U)) >> 8;
+        }
+        in_s[s] = geom_sample(2, CUT_H, CUT_W, 0, in_data[s]);
+        out_s[s] = geom_sample(2, CUT_H, CUT_W, 0, out_data[s]);
+    }
+    ct_batch_t in = { .samples = in_s, .batch_size = B, .batch_index = 3 };
+    ct_batch_t out = { .samples = out_s, .batch_size = B, .batch_index = 0 };
+    ct_fault_flags_t faults = {0};
+    ct_augment_batch(&ctx, &in, &out, &faults);
+
+    for (uint32_t s = 0; s < B; s++) {
+        ct_sample_t ref;
+        ct_fault_flags_t ref_faults = {0};
+        ct_augment_sample(&ctx, &in_s[s], &ref, 3U * B + s, &ref_faults);
+        if (out_s[s].total_elements != 12U || ref.total_elements != 12U) return 0;
+        if (memcmp(out_s[s].data, ref.data, 12U * sizeof(int32_t)) != 0) return 0;
+    }
+
+    /* Geometry: the planned warp of plan[i] is ct_augment_geometry of its index */
+    ct_augment_decision_t plan[4];
+    ct_augment_plan_batch(&ctx, 500, 4, plan);
+    for (uint32_t i = 0; i < 4; i++) {
+        ct_sample_t a = geom_sample(2, 0, 0, 0, out_data[0]);
+        ct_sample_t b = geom_sample(2, 0, 0, 0, ref_data);
+        ct_augment_geometry_planned(&ctx, &plan[i], &in_s[i], &a, &faults);
+        ct_augment_geometry(&ctx, &in_s[i], &b, 500U + i, &faults);
+        if (a.dims[0] != b.dims[0] || a.total_elements != CUT_H * CUT_W) return 0;
+        if (memcmp(out_data[0], ref_data, sizeof(ref_data)) != 0) return 0;
+    }
+    return faults.domain == 0 && faults.overflow == 0 && faults.underflow == 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -478,7 +1303,7 @@ int main(void)
 {
     printf("==============================================\n");
     printf("Certifiable Data - Augmentation Tests\n");
-    printf("Traceability: SRS-003-AUGMENT, CT-MATH-001 §6\n");
+    printf("Traceability: SRS-003-AUGMENT, CT-MATH-001 §6, §8.7, §8.8, §8.9, §8.10\n");
     printf("==============================================\n\n");
     
     printf("Context initialization:\n");
@@ -507,6 +1332,41 @@ int main(void)
     printf("\nBatch augmentation:\n");
     RUN_TEST(test_augment_batch);
     
+    printf("\nNoise range planning:\n");
+    RUN_TEST(test_noise_plan_identical);
+    RUN_TEST(test_noise_plan_rejects_large_std);
+    RUN_TEST(test_noise_plan_tied_to_std);
+    
+    printf("\nNarrow formats:\n");
+    RUN_TEST(test_augment16_geometry_matches_q16);
+    RUN_TEST(test_augment16_noise_bounded_deterministic);
+    RUN_TEST(test_augment16_unknown_dtype);
+    
+    printf("\nGeometry:\n");
+    RUN_TEST(test_geometry_identity);
+    RUN_TEST(test_geometry_rot90_exact);
+    RUN_TEST(test_geometry_resize_vectors);
+    RUN_TEST(test_geometry_kernel_rounding);
+    RUN_TEST(test_geometry_affine);
+    RUN_TEST(test_geometry_rejects);
+    
+    printf("\nCutout:\n");
+    RUN_TEST(test_cutout_constant);
+    RUN_TEST(test_cutout_planes_and_clip);
+    RUN_TEST(test_cutout_noise);
+    RUN_TEST(test_cutout_rejects);
+    
+    printf("\nBatch mixing:\n");
+    RUN_TEST(test_mix_mixup_blend);
+    RUN_TEST(test_mix_cutmix_rectangle);
+    RUN_TEST(test_mix_padding_and_single);
+    RUN_TEST(test_mix_rejects);
+    
+    printf("\nDecision planning:\n");
+    RUN_TEST(test_plan_matches_draws);
+    RUN_TEST(test_plan_defaults);
+    RUN_TEST(test_plan_executes_like_sample);
+    
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
     printf("==============================================\n");
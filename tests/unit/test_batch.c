@@ -15,6 +15,9 @@
 #include <stdlib.h>
 #include "ct_types.h"
 #include "batch.h"
+#include "loader.h"
+#include "merkle.h"
+#include "shuffle.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -399,6 +402,314 @@ static int test_multiple_batches_different_hashes(void)
     return memcmp(batch0.batch_hash, batch1.batch_hash, 32) != 0;
 }
 
+/* ============================================================================
+ * Test: Compact Batch Descriptors (CT-STRUCT-001 §10.1)
+ * ============================================================================ */
+
+#define REF_N 10
+
+static int32_t g_ref_data[REF_N][2];
+static ct_sample_t g_ref_samples[REF_N];
+
+static ct_dataset_t make_ref_dataset(void)
+{
+    for (uint32_t i = 0; i < REF_N; i++) {
+        g_ref_data[i][0] = (int32_t)(i << 16);
+        g_ref_data[i][1] = -(int32_t)i;
+        g_ref_samples[i] = (ct_sample_t){ .version = 1, .ndims = 1, .dims = {2, 0, 0, 0},
+                                          .total_elements = 2, .data = g_ref_data[i] };
+    }
+    ct_dataset_t dataset;
+    ct_dataset_init(&dataset, g_ref_samples, REF_N);
+    return dataset;
+}
+
+static int test_batch_ref_matches_full_batch(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    /* Batch size 4 over 10 samples: batch 2 is partial */
+    for (uint32_t b = 0; b < 3; b++) {
+        ct_sample_t samples[4];
+        ct_hash_t hashes[4];
+        ct_batch_t full;
+        ct_batch_init(&full, samples, hashes, 4);
+        ct_batch_fill(&full, &dataset, b, 5, 0xFACEFEED12345678ULL);
+
+        ct_sample_ref_t refs[4];
+        ct_batch_ref_t compact;
+        ct_batch_ref_init(&compact, refs, 4);
+        ct_batch_ref_fill(&compact, REF_N, (const ct_hash_t *)leaves, b, 5, 0xFACEFEED12345678ULL);
+
+        if (memcmp(full.batch_hash, compact.batch_hash, 32) != 0) return 0;
+        if (compact.count != ((b < 2) ? 4U : 2U)) return 0;
+
+        for (uint32_t i = 0; i < compact.count; i++) {
+            const ct_sample_t *s = ct_batch_ref_resolve(&compact, &dataset, i);
+            if (s == NULL || s->data != samples[i].data) return 0;
+            if (refs[i].original_index != b * 4 + i) return 0;
+        }
+        for (uint32_t i = compact.count; i < 4; i++) {
+            if (ct_batch_ref_resolve(&compact, &dataset, i) != NULL) return 0;
+            if (refs[i].shuffled_index != CT_SAMPLE_REF_NONE) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_batch_weighted_matches_draws(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    static const uint32_t weights[REF_N] = { 5, 0, 1, 1, 9, 0, 2, 3, 1, 4 };
+    uint32_t prob[REF_N], alias[REF_N], work[REF_N];
+    ct_alias_table_t sampler;
+    if (ct_alias_build(&sampler, weights, REF_N, prob, alias, work) != 0) return 0;
+
+    for (uint32_t b = 0; b < 3; b++) {
+        ct_sample_t samples[4];
+        ct_hash_t hashes[4];
+        ct_batch_t full;
+        ct_batch_init(&full, samples, hashes, 4);
+        if (ct_batch_fill_weighted(&full, &dataset, &sampler, b, 2, 99) != 0) return 0;
+
+        ct_sample_ref_t refs[4];
+        ct_batch_ref_t compact;
+        ct_batch_ref_init(&compact, refs, 4);
+        if (ct_batch_ref_fill_weighted(&compact, REF_N, (const ct_hash_t *)leaves,
+                                       &sampler, b, 2, 99) != 0) return 0;
+        if (memcmp(full.batch_hash, compact.batch_hash, 32) != 0) return 0;
+
+        for (uint32_t i = 0; i < compact.count; i++) {
+            uint32_t idx = ct_alias_draw(&sampler, 99, 2, b * 4 + i);
+            if (weights[idx] == 0 || refs[i].shuffled_index != idx) return 0;
+            if (samples[i].data != dataset.samples[idx].data) return 0;
+        }
+        if (b == 2 && (compact.count != 2 || samples[3].total_elements != 0)) return 0;
+    }
+
+    /* A table over another dataset size is refused */
+    ct_sample_t samples[4];
+    ct_hash_t hashes[4];
+    ct_batch_t full;
+    ct_batch_init(&full, samples, hashes, 4);
+    sampler.num_samples = REF_N - 1;
+    return ct_batch_fill_weighted(&full, &dataset, &sampler, 0, 2, 99) == -1 &&
+           full.batch_index == 0;
+}
+
+static int test_batch_stratified_class_mix(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    /* Two of class 0 and one each of classes 1 and 2 in every batch */
+    static const uint32_t labels[REF_N] = { 0, 1, 0, 2, 0, 1, 0, 2, 0, 0 };
+    static const uint32_t quota[3] = { 2, 1, 1 };
+    uint32_t offsets[4], members[REF_N], slots[4], work[3];
+    ct_strata_t strata;
+    if (ct_strata_build(&strata, labels, REF_N, quota, 3, offsets, members, slots, work) != 0) return 0;
+
+    for (uint32_t b = 0; b < 5; b++) {
+        ct_sample_t samples[4];
+        ct_hash_t hashes[4];
+        ct_batch_t full;
+        ct_batch_init(&full, samples, hashes, 4);
+        if (ct_batch_fill_stratified(&full, &dataset, &strata, b, 1, 7) != 0) return 0;
+
+        ct_sample_ref_t refs[4];
+        ct_batch_ref_t compact;
+        ct_batch_ref_init(&compact, refs, 4);
+        if (ct_batch_ref_fill_stratified(&compact, (const ct_hash_t *)leaves,
+                                         &strata, b, 1, 7) != 0) return 0;
+        if (memcmp(full.batch_hash, compact.batch_hash, 32) != 0 || compact.count != 4) return 0;
+
+        uint32_t per_class[3] = { 0, 0, 0 };
+        for (uint32_t i = 0; i < 4; i++) {
+            uint32_t idx = refs[i].shuffled_index;
+            if (samples[i].data != dataset.samples[idx].data) return 0;
+            per_class[labels[idx]]++;
+            if (labels[idx] != (i == 0 || i == 3 ? 0U : i)) return 0;
+        }
+        if (per_class[0] != 2 || per_class[1] != 1 || per_class[2] != 1) return 0;
+    }
+
+    /* Mismatched batch size is refused */
+    ct_sample_t samples[3];
+    ct_hash_t hashes[3];
+    ct_batch_t small;
+    ct_batch_init(&small, samples, hashes, 3);
+    return ct_batch_fill_stratified(&small, &dataset, &strata, 0, 1, 7) == -1;
+}
+
+static int test_batch_subset_epoch(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    /* M = 7 of 10 with batches of 3: two full batches and one of 1 */
+    uint32_t perm[REF_N];
+    ct_permute_range(0, REF_N, REF_N, 0x5EED, 3, perm);
+    for (uint32_t b = 0; b < 3; b++) {
+        ct_sample_t samples[3];
+        ct_hash_t hashes[3];
+        ct_batch_t full;
+        ct_batch_init(&full, samples, hashes, 3);
+        if (ct_batch_fill_subset(&full, &dataset, 7, b, 3, 0x5EED) != 0) return 0;
+
+        ct_sample_ref_t refs[3];
+        ct_batch_ref_t compact;
+        ct_batch_ref_init(&compact, refs, 3);
+        if (ct_batch_ref_fill_subset(&compact, REF_N, (const ct_hash_t *)leaves,
+                                     7, b, 3, 0x5EED) != 0) return 0;
+        if (memcmp(full.batch_hash, compact.batch_hash, 32) != 0) return 0;
+        if (compact.count != ((b < 2) ? 3U : 1U)) return 0;
+
+        for (uint32_t i = 0; i < compact.count; i++) {
+            if (samples[i].data != dataset.samples[perm[b * 3 + i]].data) return 0;
+        }
+        if (b == 2 && (samples[1].total_elements != 0 || samples[2].data != NULL)) return 0;
+    }
+
+    /* M = N is the ordinary epoch; 0 and N + 1 are refused */
+    ct_sample_t a[4], s[4];
+    ct_hash_t ha[4], hs[4];
+    ct_batch_t plain, subset;
+    ct_batch_init(&plain, a, ha, 4);
+    ct_batch_init(&subset, s, hs, 4);
+    ct_batch_fill(&plain, &dataset, 2, 3, 0x5EED);
+    if (ct_batch_fill_subset(&subset, &dataset, REF_N, 2, 3, 0x5EED) != 0) return 0;
+    if (memcmp(plain.batch_hash, subset.batch_hash, 32) != 0) return 0;
+    return ct_batch_fill_subset(&subset, &dataset, 0, 0, 3, 0x5EED) == -1 &&
+           ct_batch_fill_subset(&subset, &dataset, REF_N + 1, 0, 3, 0x5EED) == -1 &&
+           subset.batch_index == 2;
+}
+
+static int test_batch_ref_verify(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    ct_sample_ref_t refs[3];
+    ct_batch_ref_t batch;
+    ct_batch_ref_init(&batch, refs, 3);
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 1, 0, 42);
+    if (!ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves)) return 0;
+
+    /* Pointing a slot at another sample breaks the commitment */
+    refs[0].shuffled_index = (refs[0].shuffled_index + 1) % REF_N;
+    return ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves) == 0;
+}
+
+static int test_batch_ref_compact_size(void)
+{
+    /* Per-slot metadata: 8 bytes instead of a sample copy plus its hash */
+    return sizeof(ct_sample_ref_t) == 8 &&
+           sizeof(ct_sample_ref_t) * 8 <= sizeof(ct_sample_t) + sizeof(ct_hash_t);
+}
+
+static int test_batch_ref_out_of_range(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    ct_sample_ref_t refs[4];
+    ct_batch_ref_t batch;
+    ct_batch_ref_init(&batch, refs, 4);
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 7, 0, 42);
+
+    return batch.count == 0 && ct_batch_ref_resolve(&batch, &dataset, 0) == NULL &&
+           ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves);
+}
+
+static int test_batch_ref_reference_mode(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_hash_t leaves[REF_N];
+    ct_hash_t root, other_root;
+    ct_hash_dataset_leaves(&dataset, leaves);
+    ct_hash_dataset((const ct_hash_t *)leaves, REF_N, root);
+    memset(other_root, 0xAB, sizeof(other_root));
+
+    ct_sample_ref_t refs[4];
+    ct_batch_ref_t batch;
+    ct_batch_ref_init(&batch, refs, 4);
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 1, 3, 42);
+    ct_hash_t content;
+    memcpy(content, batch.batch_hash, sizeof(content));
+
+    if (ct_batch_ref_set_hash_mode(&batch, CT_BATCH_HASH_REFERENCE, root) != 0) return 0;
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 1, 3, 42);
+    if (!ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves)) return 0;
+    if (memcmp(content, batch.batch_hash, sizeof(content)) == 0) return 0;
+
+    /* The same indices under a different dataset root commit differently */
+    ct_hash_t reference;
+    memcpy(reference, batch.batch_hash, sizeof(reference));
+    ct_batch_ref_set_hash_mode(&batch, CT_BATCH_HASH_REFERENCE, other_root);
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 1, 3, 42);
+    if (memcmp(reference, batch.batch_hash, sizeof(reference)) == 0) return 0;
+
+    /* Position and epoch are bound into the reference commitment */
+    ct_batch_ref_set_hash_mode(&batch, CT_BATCH_HASH_REFERENCE, root);
+    ct_batch_ref_fill(&batch, REF_N, (const ct_hash_t *)leaves, 1, 3, 42);
+    refs[0].shuffled_index = (refs[0].shuffled_index + 1) % REF_N;
+    if (ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves)) return 0;
+    refs[0].shuffled_index = (refs[0].shuffled_index + REF_N - 1) % REF_N;
+    batch.epoch = 4;
+    return ct_batch_ref_verify(&batch, (const ct_hash_t *)leaves) == 0;
+}
+
+static int test_batch_ref_unknown_hash_mode(void)
+{
+    ct_hash_t root = {0};
+    ct_sample_ref_t refs[2];
+    ct_batch_ref_t batch;
+    ct_batch_ref_init(&batch, refs, 2);
+
+    return ct_batch_ref_set_hash_mode(&batch, 2, root) == -1 &&
+           batch.hash_mode == CT_BATCH_HASH_CONTENT;
+}
+
+/* ============================================================================
+ * Test: Packing
+ * ============================================================================ */
+
+static int test_batch_pack_contiguous(void)
+{
+    ct_dataset_t dataset = make_ref_dataset();
+    ct_sample_t samples[4];
+    ct_hash_t hashes[4];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, 4);
+    ct_batch_fill(&batch, &dataset, 0, 1, 42);
+
+    const int32_t *orig[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        orig[i] = samples[i].data;
+    }
+
+    int32_t small[7];
+    if (ct_batch_pack(&batch, small, 7) != -1) return 0;
+    if (samples[0].data != orig[0]) return 0;
+
+    int32_t buf[8];
+    if (ct_batch_pack(&batch, buf, 8) != 0) return 0;
+    for (uint32_t i = 0; i < 4; i++) {
+        if (samples[i].data != &buf[2 * i]) return 0;
+        if (memcmp(&buf[2 * i], orig[i], 2 * sizeof(int32_t)) != 0) return 0;
+    }
+    return ct_batch_verify(&batch);
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -432,6 +743,20 @@ int main(void)
     printf("\nMultiple batches:\n");
     RUN_TEST(test_multiple_batches_different_hashes);
     
+    printf("\nCompact batch descriptors:\n");
+    RUN_TEST(test_batch_ref_matches_full_batch);
+    RUN_TEST(test_batch_weighted_matches_draws);
+    RUN_TEST(test_batch_stratified_class_mix);
+    RUN_TEST(test_batch_subset_epoch);
+    RUN_TEST(test_batch_ref_verify);
+    RUN_TEST(test_batch_ref_compact_size);
+    RUN_TEST(test_batch_ref_out_of_range);
+    RUN_TEST(test_batch_ref_reference_mode);
+    RUN_TEST(test_batch_ref_unknown_hash_mode);
+    
+    printf("\nPacking:\n");
+    RUN_TEST(test_batch_pack_contiguous);
+    
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
     printf("==============================================\n");
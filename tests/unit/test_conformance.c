@@ -0,0 +1,1344 @@
+/**
+ * @file test_conformance.c
+ * @project Certifiable Data Pipeline
+ * @brief Differential conformance harness for accelerated kernels
+ *
+ * @details Runs every kernel of every supported dispatch backend against the
+ *          scalar reference on randomized, edge-biased inputs and compares
+ *          outputs and fault flags bit for bit. The first mismatch is shrunk
+ *          to a minimal case and printed as a C reproducer.
+ *
+ *          The workload is CONF_BASE_ELEMENTS elements per kernel per backend,
+ *          multiplied by argv[1] or the CT_CONFORMANCE_SCALE environment
+ *          variable (default 1). The generator seed can be overridden with
+ *          CT_CONFORMANCE_SEED.
+ *
+ * @traceability CT-MATH-001 §14.4
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ct_types.h"
+#include "dvm.h"
+#include "prng.h"
+#include "dispatch.h"
+#include "kernels.h"
+#include "shuffle.h"
+#include "normalize.h"
+#include "augment.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    fflush(stdout); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+#define CONF_BASE_ELEMENTS  1000000U
+#define CONF_CASE_MAX       1024U
+#define CONF_SHA_MAX_BLOCKS (CONF_CASE_MAX / 64U)
+
+static uint32_t g_scale = 1;
+static uint64_t g_seed = 0xC0DEC0DE2026ULL;
+static int g_quiet = 0;
+
+/* ============================================================================
+ * Generators
+ * ============================================================================ */
+
+typedef struct {
+    uint64_t state;
+} conf_rng_t;
+
+static uint64_t rng_next(conf_rng_t *r)
+{
+    uint64_t z = (r->state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static const int32_t EDGE_I32[] = {
+    0, 1, -1, 2, -2,
+    INT32_MAX, INT32_MIN, INT32_MAX - 1, INT32_MIN + 1,
+    FIXED_ONE, -FIXED_ONE, FIXED_HALF, -FIXED_HALF,
+    0x7FFF, 0x8000, 0x8001, -0x8000, -0x8001, 0xFFFF, 0x18000,
+    0x00B504F3, 0x00B504F4, -0x00B504F3, -0x00B504F4,
+    0x40000000, -0x40000000, 0x3FFFFFFF, -0x3FFFFFFF
+};
+
+#define EDGE_I32_COUNT (sizeof(EDGE_I32) / sizeof(EDGE_I32[0]))
+
+static const uint64_t EDGE_U64[] = {
+    0, UINT64_MAX, 0x8000000000000000ULL, 0x7FFFFFFFFFFFFFFFULL,
+    0x7FFF000000000000ULL, 0x8000FFFFFFFFFFFFULL, 0xFFFF0000FFFFFFFFULL,
+    0x0000FFFFFFFFFFFFULL
+};
+
+#define EDGE_U64_COUNT (sizeof(EDGE_U64) / sizeof(EDGE_U64[0]))
+
+static int32_t gen_i32(conf_rng_t *r)
+{
+    uint64_t x = rng_next(r);
+    uint32_t hi = (uint32_t)(x >> 32);
+
+    switch (x & 7U) {
+    case 0:
+    case 1:
+        return EDGE_I32[hi % EDGE_I32_COUNT];
+    case 2:
+        return (int32_t)(int8_t)(hi & 0xFFU);
+    case 3: {
+        /* Near a power of two, either sign */
+        int32_t p = (int32_t)(1U << (hi % 31U));
+        int32_t v = p + (int32_t)(int8_t)((hi >> 8) & 0xFFU);
+        return ((hi >> 16) & 1U) ? -v : v;
+    }
+    default:
+        return (int32_t)hi;
+    }
+}
+
+static const int16_t EDGE_I16[] = {
+    0, 1, -1, 2, -2, INT16_MAX, INT16_MIN, INT16_MAX - 1, INT16_MIN + 1,
+    0x0100, -0x0100, 0x0080, -0x0080, 0x4000, -0x4000, 0x00FF, 0x7F80
+};
+
+#define EDGE_I16_COUNT (sizeof(EDGE_I16) / sizeof(EDGE_I16[0]))
+
+static int16_t gen_i16(conf_rng_t *r)
+{
+    uint64_t x = rng_next(r);
+    uint32_t hi = (uint32_t)(x >> 32);
+
+    switch (x & 3U) {
+    case 0:
+        return EDGE_I16[hi % EDGE_I16_COUNT];
+    case 1:
+        return (int16_t)(int8_t)(hi & 0xFFU);
+    default:
+        return (int16_t)(uint16_t)hi;
+    }
+}
+
+static uint64_t gen_u64(conf_rng_t *r)
+{
+    uint64_t x = rng_next(r);
+    if ((x & 7U) == 0) {
+        return EDGE_U64[(x >> 32) % EDGE_U64_COUNT];
+    }
+    return rng_next(r);
+}
+
+static uint32_t gen_len(conf_rng_t *r, uint32_t max)
+{
+    /* Mostly short lengths to exercise vector tails, some long runs */
+    uint64_t x = rng_next(r);
+    if ((x & 7U) == 0) {
+        return (uint32_t)((x >> 32) % (max + 1U));
+    }
+    uint32_t short_max = (max < 67U) ? max : 67U;
+    return (uint32_t)((x >> 32) % (short_max + 1U));
+}
+
+/* ============================================================================
+ * Cases
+ * ============================================================================ */
+
+typedef enum {
+    K_ADD32,
+    K_SUB32,
+    K_MUL_Q16,
+    K_NORMALIZE,
+    K_PRNG_FILL,
+    K_NOISE,
+    K_SHA256,
+    K_PERMUTE,
+    K_ADD32_UNCHECKED,
+    K_NORMALIZE_UNCHECKED,
+    K_DIV_Q16,
+    K_ADD16,
+    K_NORMALIZE16,
+    K_NOISE16,
+    K_TO_F32,
+    K_TO_F64,
+    K_TO_BF16,
+    K_TRANSPOSE32,
+    K_WARP_ROW,
+    K_LERP_Q16,
+    K_PRNG_STRIDE,
+    K_BOUND_V2
+} conf_kernel_t;
+
+static const char *const KERNEL_NAMES[] = {
+    "add32", "sub32", "mul_q16", "normalize",
+    "prng_fill", "noise", "sha256_blocks", "permute_range",
+    "add32_unchecked", "normalize_unchecked", "div_q16",
+    "add16", "normalize16", "noise16",
+    "to_f32", "to_f64", "to_bf16", "transpose32", "warp_row", "lerp_q16",
+    "prng_stride", "bound_v2"
+};
+
+typedef struct {
+    conf_kernel_t kernel;
+    uint32_t n;                      /* Elements (blocks for sha256) */
+    uint32_t alias;                  /* Binops, lerp_q16: 0 none, 1 out=a, 2 out=b;
+                                        warp_row: border mode */
+    int32_t a[CONF_CASE_MAX];        /* a / x (int16 values for narrow kernels) */
+    int32_t b[CONF_CASE_MAX];        /* b / means */
+    int32_t c[CONF_CASE_MAX];        /* inv_stds */
+    uint64_t u[CONF_CASE_MAX];       /* noise, bound_v2 input */
+    uint8_t bytes[CONF_CASE_MAX];    /* sha256 blocks */
+    int32_t std;                     /* noise_std; div_q16: denominator; warp_row: sx;
+                                        lerp_q16: weight */
+    uint64_t seed;                   /* prng_fill, prng_stride, permute;
+                                        warp_row: dx | dy << 32 */
+    uint32_t epoch;                  /* prng_fill, permute; normalize16: frac_bits;
+                                        transpose32: rows; warp_row: sy */
+    uint32_t op_base;                /* prng_fill; prng_stride: first op_id;
+                                        bound_v2: bound; permute: start;
+                                        warp_row: width */
+    uint32_t op_offset;              /* prng_fill; prng_stride: stride; permute: N;
+                                        warp_row: height */
+} conf_case_t;
+
+typedef struct {
+    int32_t i32[CONF_CASE_MAX];
+    uint64_t u64[CONF_CASE_MAX];     /* Also the bit patterns of export outputs */
+    uint32_t state[8];
+    ct_fault_flags_t faults;
+} conf_result_t;
+
+/* Large scratch kept off the stack */
+static conf_case_t g_case;
+static conf_case_t g_trial;
+static conf_result_t g_expected;
+static conf_result_t g_actual;
+
+static uint32_t fault_bits(const ct_fault_flags_t *f)
+{
+    uint32_t bits;
+    memcpy(&bits, f, sizeof(bits));
+    return bits;
+}
+
+static void run_binop(ct_kernel_binop_fn fn, const conf_case_t *c, conf_result_t *res)
+{
+    int32_t a[CONF_CASE_MAX];
+    int32_t b[CONF_CASE_MAX];
+    memcpy(a, c->a, c->n * sizeof(int32_t));
+    memcpy(b, c->b, c->n * sizeof(int32_t));
+
+    int32_t *out = (c->alias == 1) ? a : (c->alias == 2) ? b : res->i32;
+    fn(a, b, out, c->n, &res->faults);
+    if (out != res->i32) {
+        memcpy(res->i32, out, c->n * sizeof(int32_t));
+    }
+}
+
+static void run_lerp(ct_kernel_lerp_fn fn, const conf_case_t *c, conf_result_t *res)
+{
+    int32_t a[CONF_CASE_MAX];
+    int32_t b[CONF_CASE_MAX];
+    memcpy(a, c->a, c->n * sizeof(int32_t));
+    memcpy(b, c->b, c->n * sizeof(int32_t));
+
+    int32_t *out = (c->alias == 1) ? a : (c->alias == 2) ? b : res->i32;
+    fn(a, b, c->std, out, c->n);
+    if (out != res->i32) {
+        memcpy(res->i32, out, c->n * sizeof(int32_t));
+    }
+}
+
+/* Narrow kernels run on int16 copies; results are stored sign-extended */
+static void run_narrow(const ct_dispatch_t *t, const conf_case_t *c, conf_result_t *res)
+{
+    int16_t a[CONF_CASE_MAX];
+    int16_t b[CONF_CASE_MAX];
+    int16_t s[CONF_CASE_MAX];
+    int16_t out[CONF_CASE_MAX];
+    for (uint32_t i = 0; i < c->n; i++) {
+        a[i] = (int16_t)c->a[i];
+        b[i] = (int16_t)c->b[i];
+        s[i] = (int16_t)c->c[i];
+    }
+
+    int16_t *dst = out;
+    if (c->kernel == K_ADD16) {
+        dst = (c->alias == 1) ? a : (c->alias == 2) ? b : out;
+        t->add16(a, b, dst, c->n, &res->faults);
+    } else if (c->kernel == K_NORMALIZE16) {
+        t->normalize16(a, b, s, out, c->n, c->epoch, &res->faults);
+    } else {
+        t->noise16(c->u, out, c->n, (int16_t)c->std, &res->faults);
+    }
+
+    for (uint32_t i = 0; i < c->n; i++) {
+        res->i32[i] = dst[i];
+    }
+}
+
+/* Export references come straight from the exact binary64 value: hardware
+ * RNE for binary32, and RNE of the binary64 significand to 8 bits for
+ * bfloat16, independent of the integer rounding the kernels use */
+static uint64_t double_bits(double d)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    return bits;
+}
+
+static uint16_t bf16_reference(int32_t x)
+{
+    uint64_t bits = double_bits((double)x / 65536.0);
+    uint64_t lsb = 1ULL << 45;
+    bits += (lsb >> 1) - 1U + ((bits >> 45) & 1U);
+    bits &= ~(lsb - 1U);
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    float f = (float)d;
+    uint32_t fb;
+    memcpy(&fb, &f, sizeof(fb));
+    return (uint16_t)(fb >> 16);
+}
+
+static void run_export(const ct_dispatch_t *t, int reference,
+                       const conf_case_t *c, conf_result_t *res)
+{
+    float f[CONF_CASE_MAX];
+    double d[CONF_CASE_MAX];
+    uint16_t h[CONF_CASE_MAX];
+
+    for (uint32_t i = 0; i < c->n; i++) {
+        f[i] = (float)((double)c->a[i] / 65536.0);
+        d[i] = (double)c->a[i] / 65536.0;
+        h[i] = bf16_reference(c->a[i]);
+    }
+    if (!reference) {
+        if (c->kernel == K_TO_F32) {
+            t->to_f32(c->a, f, c->n);
+        } else if (c->kernel == K_TO_F64) {
+            t->to_f64(c->a, d, c->n);
+        } else {
+            t->to_bf16(c->a, h, c->n);
+        }
+    }
+
+    for (uint32_t i = 0; i < c->n; i++) {
+        uint32_t fb;
+        memcpy(&fb, &f[i], sizeof(fb));
+        res->u64[i] = (c->kernel == K_TO_F32) ? fb :
+                      (c->kernel == K_TO_F64) ? double_bits(d[i]) : h[i];
+    }
+}
+
+/* Reference runs use the scalar table (and ct_permute_index for permute) */
+static void run_case(const ct_dispatch_t *t, int reference,
+                     const conf_case_t *c, conf_result_t *res)
+{
+    memset(res->i32, 0, c->n * sizeof(int32_t));
+    memset(res->u64, 0, c->n * sizeof(uint64_t));
+    memset(res->state, 0, sizeof(res->state));
+    memset(&res->faults, 0, sizeof(res->faults));
+
+    switch (c->kernel) {
+    case K_ADD32:
+        run_binop(t->add32, c, res);
+        break;
+    case K_SUB32:
+        run_binop(t->sub32, c, res);
+        break;
+    case K_MUL_Q16:
+        run_binop(t->mul_q16, c, res);
+        break;
+    case K_NORMALIZE:
+        t->normalize(c->a, c->b, c->c, res->i32, c->n, &res->faults);
+        break;
+    case K_DIV_Q16: {
+        /* Reference is the hardware divide itself */
+        dvm_divisor_t div;
+        dvm_divisor_init(&div, c->std);
+        if (reference) {
+            for (uint32_t i = 0; i < c->n; i++) {
+                res->i32[i] = dvm_div_q16(c->a[i], c->std, &res->faults);
+            }
+        } else {
+            t->div_q16(c->a, &div, res->i32, c->n, &res->faults);
+        }
+        break;
+    }
+    case K_ADD32_UNCHECKED:
+        run_binop(reference ? t->add32 : t->add32_unchecked, c, res);
+        break;
+    case K_NORMALIZE_UNCHECKED:
+        (reference ? t->normalize : t->normalize_unchecked)(c->a, c->b, c->c, res->i32,
+                                                            c->n, &res->faults);
+        break;
+    case K_PRNG_FILL:
+        t->prng_fill(res->u64, c->n, c->seed, c->epoch, c->op_base, c->op_offset);
+        break;
+    case K_PRNG_STRIDE:
+        t->prng_stride(res->u64, c->n, c->seed, c->epoch, c->op_base, c->op_offset);
+        break;
+    case K_BOUND_V2:
+        t->bound_v2(c->u, (uint32_t *)(void *)res->i32, c->n, c->op_base);
+        break;
+    case K_NOISE:
+        t->noise(c->u, res->i32, c->n, c->std, &res->faults);
+        break;
+    case K_ADD16:
+    case K_NORMALIZE16:
+    case K_NOISE16:
+        run_narrow(t, c, res);
+        break;
+    case K_TO_F32:
+    case K_TO_F64:
+    case K_TO_BF16:
+        run_export(t, reference, c, res);
+        break;
+    case K_TRANSPOSE32: {
+        /* Column count follows n, so minimization narrows the matrix */
+        uint32_t rows = (c->epoch < c->n) ? c->epoch : c->n;
+        if (rows > 0) {
+            t->transpose32(c->a, c->n / rows, res->i32, rows, rows, c->n / rows);
+        }
+        break;
+    }
+    case K_WARP_ROW:
+        /* The image in a is op_base × op_offset; only the row length is n */
+        t->warp_row(c->a, c->op_base, c->op_offset, c->alias, c->std, (int32_t)c->epoch,
+                    (int32_t)(uint32_t)c->seed, (int32_t)(uint32_t)(c->seed >> 32),
+                    res->i32, c->n);
+        break;
+    case K_LERP_Q16:
+        run_lerp(t->lerp_q16, c, res);
+        break;
+    case K_SHA256:
+        res->state[0] = 0x6a09e667; res->state[1] = 0xbb67ae85;
+        res->state[2] = 0x3c6ef372; res->state[3] = 0xa54ff53a;
+        res->state[4] = 0x510e527f; res->state[5] = 0x9b05688c;
+        res->state[6] = 0x1f83d9ab; res->state[7] = 0x5be0cd19;
+        t->sha256_blocks(res->state, c->bytes, c->n);
+        break;
+    case K_PERMUTE:
+        if (reference) {
+            for (uint32_t i = 0; i < c->n; i++) {
+                res->i32[i] = (int32_t)ct_permute_index(c->op_base + i, c->op_offset,
+                                                        c->seed, c->epoch);
+            }
+        } else {
+            ct_permute_range(c->op_base, c->n, c->op_offset, c->seed, c->epoch,
+                             (uint32_t *)res->i32);
+        }
+        break;
+    }
+}
+
+static int results_equal(const conf_result_t *x, const conf_result_t *y, uint32_t n)
+{
+    return memcmp(x->i32, y->i32, n * sizeof(int32_t)) == 0 &&
+           memcmp(x->u64, y->u64, n * sizeof(uint64_t)) == 0 &&
+           memcmp(x->state, y->state, sizeof(x->state)) == 0 &&
+           fault_bits(&x->faults) == fault_bits(&y->faults);
+}
+
+static ct_dispatch_t g_reference;
+
+static int is_unchecked(conf_kernel_t kernel)
+{
+    return kernel == K_ADD32_UNCHECKED || kernel == K_NORMALIZE_UNCHECKED;
+}
+
+static int is_export(conf_kernel_t kernel)
+{
+    return kernel == K_TO_F32 || kernel == K_TO_F64 || kernel == K_TO_BF16;
+}
+
+static int case_fails(const ct_dispatch_t *t, const conf_case_t *c)
+{
+    run_case(&g_reference, 1, c, &g_expected);
+
+    /* Unchecked kernels are only defined where the checked one cannot
+     * saturate; such cases (e.g. from minimization) do not count */
+    if (is_unchecked(c->kernel) && (g_expected.faults.overflow || g_expected.faults.underflow)) {
+        return 0;
+    }
+
+    run_case(t, 0, c, &g_actual);
+    return !results_equal(&g_expected, &g_actual, c->n);
+}
+
+/* ============================================================================
+ * Minimization and Reporting
+ * ============================================================================ */
+
+static void case_slice(const conf_case_t *src, uint32_t lo, uint32_t len, conf_case_t *dst)
+{
+    if (dst != src) {
+        memcpy(dst, src, sizeof(*dst));
+    }
+    if (src->kernel != K_WARP_ROW) {
+        memmove(dst->a, &src->a[lo], len * sizeof(int32_t));
+    }
+    memmove(dst->b, &src->b[lo], len * sizeof(int32_t));
+    memmove(dst->c, &src->c[lo], len * sizeof(int32_t));
+    memmove(dst->u, &src->u[lo], len * sizeof(uint64_t));
+    if (src->kernel == K_SHA256) {
+        memmove(dst->bytes, &src->bytes[lo * 64U], len * 64U);
+    }
+    if (src->kernel == K_PRNG_FILL) {
+        dst->op_offset = src->op_offset + lo;
+    }
+    if (src->kernel == K_PRNG_STRIDE) {
+        dst->op_base = src->op_base + lo * src->op_offset;
+    }
+    if (src->kernel == K_PERMUTE) {
+        dst->op_base = src->op_base + lo;
+    }
+    if (src->kernel == K_WARP_ROW) {
+        /* Same image; the row starts lo steps further on */
+        dst->std = (int32_t)((uint32_t)src->std + lo * (uint32_t)src->seed);
+        dst->epoch = src->epoch + lo * (uint32_t)(src->seed >> 32);
+    }
+    dst->n = len;
+}
+
+static int try_trial(const ct_dispatch_t *t, conf_case_t *c)
+{
+    if (case_fails(t, &g_trial)) {
+        memcpy(c, &g_trial, sizeof(*c));
+        return 1;
+    }
+    return 0;
+}
+
+static int is_narrow(conf_kernel_t kernel)
+{
+    return kernel == K_ADD16 || kernel == K_NORMALIZE16 || kernel == K_NOISE16;
+}
+
+static void simplify_i32(const ct_dispatch_t *t, conf_case_t *c, int32_t *field)
+{
+    /* 1.0 in Q16.16, or in Q8.8 for the narrow kernels */
+    const int32_t simple[] = { 0, is_narrow(c->kernel) ? 0x0100 : FIXED_ONE };
+    size_t offset = (size_t)((uint8_t *)field - (uint8_t *)c);
+
+    for (uint32_t i = 0; i < c->n; i++) {
+        for (uint32_t s = 0; s < 2; s++) {
+            if (field[i] == simple[s]) {
+                break;
+            }
+            memcpy(&g_trial, c, sizeof(*c));
+            ((int32_t *)((uint8_t *)&g_trial + offset))[i] = simple[s];
+            if (try_trial(t, c)) {
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Shrink a failing case: drop halves, then ever smaller prefix/suffix runs,
+ * then replace individual inputs by 0 or 1.0 while it keeps failing.
+ */
+static void minimize(const ct_dispatch_t *t, conf_case_t *c)
+{
+    int shrunk = 1;
+    while (shrunk && c->n > 1) {
+        shrunk = 0;
+        for (uint32_t cut = c->n / 2U; cut >= 1U && !shrunk; cut /= 2U) {
+            case_slice(c, cut, c->n - cut, &g_trial);
+            if (try_trial(t, c)) {
+                shrunk = 1;
+                break;
+            }
+            case_slice(c, 0, c->n - cut, &g_trial);
+            if (try_trial(t, c)) {
+                shrunk = 1;
+            }
+        }
+    }
+
+    switch (c->kernel) {
+    case K_ADD32:
+    case K_SUB32:
+    case K_MUL_Q16:
+    case K_ADD32_UNCHECKED:
+    case K_LERP_Q16:
+        simplify_i32(t, c, c->a);
+        simplify_i32(t, c, c->b);
+        break;
+    case K_NORMALIZE:
+    case K_NORMALIZE_UNCHECKED:
+    case K_NORMALIZE16:
+        simplify_i32(t, c, c->a);
+        simplify_i32(t, c, c->b);
+        simplify_i32(t, c, c->c);
+        break;
+    case K_DIV_Q16:
+    case K_TRANSPOSE32:
+    case K_TO_F32:
+    case K_TO_F64:
+    case K_TO_BF16:
+    case K_WARP_ROW:
+        simplify_i32(t, c, c->a);
+        break;
+    case K_ADD16:
+        simplify_i32(t, c, c->a);
+        simplify_i32(t, c, c->b);
+        break;
+    case K_NOISE:
+    case K_NOISE16:
+    case K_BOUND_V2:
+        for (uint32_t i = 0; i < c->n; i++) {
+            if (c->u[i] != 0) {
+                memcpy(&g_trial, c, sizeof(*c));
+                g_trial.u[i] = 0;
+                try_trial(t, c);
+            }
+        }
+        if (c->kernel != K_BOUND_V2 &&
+            c->std != (is_narrow(c->kernel) ? 0x0100 : FIXED_ONE)) {
+            memcpy(&g_trial, c, sizeof(*c));
+            g_trial.std = is_narrow(c->kernel) ? 0x0100 : FIXED_ONE;
+            try_trial(t, c);
+        }
+        break;
+    case K_SHA256:
+        for (uint32_t i = 0; i < c->n * 64U; i++) {
+            if (c->bytes[i] != 0) {
+                memcpy(&g_trial, c, sizeof(*c));
+                g_trial.bytes[i] = 0;
+                try_trial(t, c);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    /* Leave g_expected/g_actual describing the minimized case */
+    (void)case_fails(t, c);
+}
+
+static void print_i32_array(const char *name, const int32_t *v, uint32_t n)
+{
+    printf("    static const int32_t %s[%u] = {", name, n);
+    for (uint32_t i = 0; i < n; i++) {
+        printf("%s%s(int32_t)0x%08X", i ? "," : "", (i % 4U) ? " " : "\n        ",
+               (unsigned)(uint32_t)v[i]);
+    }
+    printf("\n    };\n");
+}
+
+static void print_i16_array(const char *name, const int32_t *v, uint32_t n)
+{
+    printf("    static const int16_t %s[%u] = {", name, n);
+    for (uint32_t i = 0; i < n; i++) {
+        printf("%s%s(int16_t)0x%04X", i ? "," : "", (i % 6U) ? " " : "\n        ",
+               (unsigned)(uint16_t)v[i]);
+    }
+    printf("\n    };\n");
+}
+
+static void print_u64_array(const char *name, const uint64_t *v, uint32_t n)
+{
+    printf("    static const uint64_t %s[%u] = {", name, n);
+    for (uint32_t i = 0; i < n; i++) {
+        printf("%s%s0x%016llXULL", i ? "," : "", (i % 3U) ? " " : "\n        ",
+               (unsigned long long)v[i]);
+    }
+    printf("\n    };\n");
+}
+
+static void report(const ct_dispatch_t *t, const conf_case_t *c)
+{
+    if (g_quiet) {
+        return;
+    }
+
+    printf("\n    MISMATCH: %s on backend %s%s (minimized to n=%u)\n",
+           KERNEL_NAMES[c->kernel], ct_backend_name(t->backend),
+           t->sha256_accel ? "+sha" : "", c->n);
+    printf("    /* Reproducer: CT_DISPATCH_BACKEND=%s */\n", ct_backend_name(t->backend));
+
+    switch (c->kernel) {
+    case K_ADD32:
+    case K_SUB32:
+    case K_MUL_Q16:
+    case K_ADD32_UNCHECKED:
+        printf("    /* alias = %u */\n", c->alias);
+        print_i32_array("a", c->a, c->n);
+        print_i32_array("b", c->b, c->n);
+        break;
+    case K_NORMALIZE:
+    case K_NORMALIZE_UNCHECKED:
+        print_i32_array("x", c->a, c->n);
+        print_i32_array("means", c->b, c->n);
+        print_i32_array("inv_stds", c->c, c->n);
+        break;
+    case K_DIV_Q16:
+        printf("    int32_t denom = (int32_t)0x%08X;\n", (unsigned)(uint32_t)c->std);
+        print_i32_array("num", c->a, c->n);
+        break;
+    case K_TO_F32:
+    case K_TO_F64:
+    case K_TO_BF16:
+        print_i32_array("x", c->a, c->n);
+        break;
+    case K_TRANSPOSE32:
+        printf("    uint32_t rows = %u, cols = %u;\n", c->epoch, c->epoch ? c->n / c->epoch : 0U);
+        print_i32_array("src", c->a, c->n);
+        break;
+    case K_WARP_ROW:
+        printf("    uint32_t width = %u, height = %u, border = %u;\n",
+               c->op_base, c->op_offset, c->alias);
+        printf("    int32_t sx = (int32_t)0x%08X, sy = (int32_t)0x%08X;\n",
+               (unsigned)(uint32_t)c->std, (unsigned)c->epoch);
+        printf("    int32_t dx = (int32_t)0x%08X, dy = (int32_t)0x%08X;\n",
+               (unsigned)(uint32_t)c->seed, (unsigned)(uint32_t)(c->seed >> 32));
+        print_i32_array("src", c->a, c->op_base * c->op_offset);
+        break;
+    case K_LERP_Q16:
+        printf("    /* alias = %u */\n", c->alias);
+        printf("    int32_t t = (int32_t)0x%08X;\n", (unsigned)(uint32_t)c->std);
+        print_i32_array("a", c->a, c->n);
+        print_i32_array("b", c->b, c->n);
+        break;
+    case K_NOISE:
+        printf("    int32_t noise_std = (int32_t)0x%08X;\n", (unsigned)(uint32_t)c->std);
+        print_u64_array("u", c->u, c->n);
+        break;
+    case K_BOUND_V2:
+        printf("    uint32_t bound = 0x%08X;\n", c->op_base);
+        print_u64_array("u", c->u, c->n);
+        break;
+    case K_ADD16:
+        printf("    /* alias = %u */\n", c->alias);
+        print_i16_array("a", c->a, c->n);
+        print_i16_array("b", c->b, c->n);
+        break;
+    case K_NORMALIZE16:
+        printf("    uint32_t frac_bits = %u;\n", c->epoch);
+        print_i16_array("x", c->a, c->n);
+        print_i16_array("means", c->b, c->n);
+        print_i16_array("inv_stds", c->c, c->n);
+        break;
+    case K_NOISE16:
+        printf("    int16_t noise_std = (int16_t)0x%04X;\n", (unsigned)(uint16_t)c->std);
+        print_u64_array("u", c->u, c->n);
+        break;
+    case K_PRNG_FILL:
+    case K_PRNG_STRIDE:
+    case K_PERMUTE:
+        printf("    uint64_t seed = 0x%016llXULL; uint32_t epoch = %u;\n",
+               (unsigned long long)c->seed, c->epoch);
+        printf("    uint32_t %s = 0x%08X, %s = 0x%08X;\n",
+               (c->kernel == K_PERMUTE) ? "start" :
+               (c->kernel == K_PRNG_STRIDE) ? "op_first" : "op_base", c->op_base,
+               (c->kernel == K_PERMUTE) ? "N" :
+               (c->kernel == K_PRNG_STRIDE) ? "op_stride" : "op_offset", c->op_offset);
+        break;
+    case K_SHA256:
+        printf("    static const uint8_t blocks[%u] = {", c->n * 64U);
+        for (uint32_t i = 0; i < c->n * 64U; i++) {
+            printf("%s%s0x%02X", i ? "," : "", (i % 12U) ? " " : "\n        ", c->bytes[i]);
+        }
+        printf("\n    };\n");
+        break;
+    }
+
+    for (uint32_t i = 0; i < c->n; i++) {
+        if (g_expected.i32[i] != g_actual.i32[i] || g_expected.u64[i] != g_actual.u64[i]) {
+            printf("    /* [%u] expected 0x%08X / 0x%016llX, actual 0x%08X / 0x%016llX */\n",
+                   i, (unsigned)(uint32_t)g_expected.i32[i],
+                   (unsigned long long)g_expected.u64[i],
+                   (unsigned)(uint32_t)g_actual.i32[i],
+                   (unsigned long long)g_actual.u64[i]);
+            break;
+        }
+    }
+    if (memcmp(g_expected.state, g_actual.state, sizeof(g_expected.state)) != 0) {
+        printf("    /* state[0] expected 0x%08X, actual 0x%08X */\n",
+               g_expected.state[0], g_actual.state[0]);
+    }
+    printf("    /* faults expected 0x%02X, actual 0x%02X */\n",
+           fault_bits(&g_expected.faults), fault_bits(&g_actual.faults));
+}
+
+/* ============================================================================
+ * Driver
+ * ============================================================================ */
+
+/* Neutralize elements the checked kernel would saturate on */
+static void repair_unchecked(conf_case_t *c)
+{
+    for (uint32_t i = 0; i < c->n; i++) {
+        ct_fault_flags_t f = {0};
+        int32_t out;
+        if (c->kernel == K_ADD32_UNCHECKED) {
+            ct_kernel_add32_scalar(&c->a[i], &c->b[i], &out, 1, &f);
+        } else {
+            ct_kernel_normalize_scalar(&c->a[i], &c->b[i], &c->c[i], &out, 1, &f);
+        }
+        if (f.overflow || f.underflow) {
+            c->b[i] = 0;
+            c->c[i] = 0;
+        }
+    }
+}
+
+static void gen_case(conf_rng_t *r, conf_kernel_t kernel, conf_case_t *c)
+{
+    c->kernel = kernel;
+    c->alias = 0;
+
+    switch (kernel) {
+    case K_ADD32:
+    case K_SUB32:
+    case K_MUL_Q16:
+    case K_NORMALIZE:
+    case K_ADD32_UNCHECKED:
+    case K_NORMALIZE_UNCHECKED:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->alias = (kernel == K_NORMALIZE || kernel == K_NORMALIZE_UNCHECKED) ?
+                   0U : (uint32_t)(rng_next(r) % 3U);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i32(r);
+            c->b[i] = gen_i32(r);
+            c->c[i] = gen_i32(r);
+        }
+        if (is_unchecked(kernel)) {
+            repair_unchecked(c);
+        }
+        break;
+    case K_DIV_Q16:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->std = gen_i32(r);
+        if ((rng_next(r) & 3U) == 0) {
+            /* Small and power-of-two denominators */
+            c->std = (int32_t)(1U << (rng_next(r) % 31U)) + (int32_t)(rng_next(r) % 3U) - 1;
+        }
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i32(r);
+        }
+        break;
+    case K_TO_F32:
+    case K_TO_F64:
+    case K_TO_BF16:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i32(r);
+            /* Now and then a rounding tie at 24 or 8 significant bits */
+            if ((rng_next(r) & 7U) == 0) {
+                uint32_t sh = (uint32_t)(rng_next(r) % 24U) + 1U;
+                c->a[i] = (int32_t)(((uint32_t)c->a[i] & ~((1U << sh) - 1U)) | (1U << (sh - 1U)));
+            }
+        }
+        break;
+    case K_TRANSPOSE32: {
+        /* Shapes around the 4 and 8 lane tiles and the 64-element block */
+        uint32_t rows = (uint32_t)(rng_next(r) % 80U) + 1U;
+        uint32_t cols = (uint32_t)(rng_next(r) % (CONF_CASE_MAX / rows)) + 1U;
+        c->epoch = rows;
+        c->n = rows * cols;
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i32(r);
+        }
+        break;
+    }
+    case K_WARP_ROW: {
+        /* Small images, rows that start and wander outside them, steps
+         * with exact and half-pixel fractions */
+        uint32_t w = (uint32_t)(rng_next(r) % 40U) + 1U;
+        uint32_t h = (uint32_t)(rng_next(r) % 40U) + 1U;
+        int32_t d[2];
+        for (uint32_t k = 0; k < 2; k++) {
+            uint64_t x = rng_next(r);
+            d[k] = (int32_t)((x >> 8) % 0x40001U) - 0x20000;
+            if ((x & 7U) == 0) {
+                d[k] = (int32_t)(x >> 40 & 1U) * FIXED_ONE;
+            } else if ((x & 7U) == 1) {
+                d[k] = (int32_t)(d[k] & ~0x7FFF);
+            }
+        }
+        c->op_base = w;
+        c->op_offset = h;
+        c->std = (int32_t)(rng_next(r) % (5U * w * FIXED_ONE)) - 2 * (int32_t)w * FIXED_ONE;
+        c->epoch = (uint32_t)((int32_t)(rng_next(r) % (5U * h * FIXED_ONE)) -
+                              2 * (int32_t)h * FIXED_ONE);
+        if ((rng_next(r) & 3U) == 0) {
+            c->std = (int32_t)((uint32_t)c->std & ~0xFFFFU) | FIXED_HALF;
+        }
+        c->seed = (uint64_t)(uint32_t)d[0] | ((uint64_t)(uint32_t)d[1] << 32);
+        c->alias = (uint32_t)(rng_next(r) & 1U);
+        c->n = gen_len(r, CONF_CASE_MAX);
+        for (uint32_t i = 0; i < w * h; i++) {
+            c->a[i] = gen_i32(r);
+        }
+        break;
+    }
+    case K_LERP_Q16: {
+        /* Weights over [0, 1.0], often an end, the half-way tie or one step
+         * inside an end */
+        static const int32_t SPECIAL[6] = { 0, 1, FIXED_HALF, 0xFFFF, FIXED_ONE, 0x8001 };
+        uint64_t x = rng_next(r);
+        c->std = ((x & 3U) == 0) ? SPECIAL[(x >> 8) % 6U] : (int32_t)((x >> 8) % 0x10001U);
+        c->alias = (uint32_t)(rng_next(r) % 3U);
+        c->n = gen_len(r, CONF_CASE_MAX);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i32(r);
+            c->b[i] = gen_i32(r);
+        }
+        break;
+    }
+    case K_NOISE:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->std = gen_i32(r);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->u[i] = gen_u64(r);
+        }
+        break;
+    case K_BOUND_V2: {
+        /* Small bounds, bounds just above 2^31 (rejection window near half
+         * the words), the trivial bounds and arbitrary ones; low words often
+         * inside the window */
+        static const uint32_t SPECIAL[6] = { 0, 1, 2, 0x80000001U, 0xFFFFFFFFU, 65536U };
+        uint64_t x = rng_next(r);
+        c->op_base = ((x & 3U) == 0) ? SPECIAL[(x >> 8) % 6U] :
+                     ((x & 3U) == 1) ? (uint32_t)((x >> 8) % 1000U) :
+                     ((x & 3U) == 2) ? 0x80000000U + (uint32_t)((x >> 8) % 4096U) :
+                     (uint32_t)(x >> 32);
+        c->n = gen_len(r, CONF_CASE_MAX);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->u[i] = gen_u64(r);
+            if (rng_next(r) % 4U == 0) {
+                c->u[i] &= 0xFFFFFFFF00000000ULL | (uint64_t)(c->op_base / 2U);
+            }
+        }
+        break;
+    }
+    case K_ADD16:
+    case K_NORMALIZE16:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->alias = (kernel == K_ADD16) ? (uint32_t)(rng_next(r) % 3U) : 0U;
+        /* Both dtype scales, and now and then an invalid one */
+        c->epoch = (rng_next(r) & 1U) ? CT_FRAC_Q8_8 : CT_FRAC_Q1_15;
+        if (rng_next(r) % 32U == 0) {
+            c->epoch = (uint32_t)(rng_next(r) % 18U);
+        }
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->a[i] = gen_i16(r);
+            c->b[i] = gen_i16(r);
+            c->c[i] = gen_i16(r);
+        }
+        break;
+    case K_NOISE16:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->std = gen_i16(r);
+        for (uint32_t i = 0; i < c->n; i++) {
+            c->u[i] = gen_u64(r);
+        }
+        break;
+    case K_PRNG_FILL:
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->seed = gen_u64(r);
+        c->epoch = (uint32_t)gen_i32(r);
+        c->op_base = (uint32_t)gen_i32(r);
+        /* Bias offsets toward the 32-bit wrap */
+        c->op_offset = (rng_next(r) & 1U) ? (uint32_t)gen_i32(r)
+                                          : 0xFFFFFFFFU - (uint32_t)(rng_next(r) % 2048U);
+        break;
+    case K_PRNG_STRIDE:
+        /* Mostly the per-sample stride 2^16, with starts near the wrap */
+        c->n = gen_len(r, CONF_CASE_MAX);
+        c->seed = gen_u64(r);
+        c->epoch = (uint32_t)gen_i32(r);
+        c->op_offset = (rng_next(r) & 1U) ? (1U << 16) : (uint32_t)gen_i32(r);
+        c->op_base = (rng_next(r) & 1U) ? (uint32_t)gen_i32(r)
+                                        : 0U - (uint32_t)(rng_next(r) % 64U) * (1U << 16);
+        break;
+    case K_SHA256:
+        c->n = gen_len(r, CONF_SHA_MAX_BLOCKS);
+        for (uint32_t i = 0; i < c->n * 64U; i++) {
+            c->bytes[i] = (uint8_t)rng_next(r);
+        }
+        break;
+    case K_PERMUTE: {
+        /* Dataset sizes around powers of two exercise the cycle walk */
+        uint32_t shift = (uint32_t)(rng_next(r) % 21U);
+        uint32_t N = (1U << shift) + (uint32_t)(int8_t)rng_next(r);
+        if ((int32_t)N <= 0) {
+            N = (uint32_t)(rng_next(r) % 4U);
+        }
+        c->op_offset = N;
+        c->n = gen_len(r, 256U);
+        c->seed = gen_u64(r);
+        c->epoch = (uint32_t)(rng_next(r) % 1000U);
+        /* Mostly in range; occasionally past N (index % N fallback) */
+        c->op_base = (rng_next(r) % 16U == 0) ? (uint32_t)rng_next(r)
+                                               : (uint32_t)(rng_next(r) % (N + 1U));
+        break;
+    }
+    }
+}
+
+/**
+ * Run generated cases for one kernel against a table until the element
+ * budget is exhausted. Returns 1 if every case matched.
+ */
+static int conform_kernel(const ct_dispatch_t *t, conf_kernel_t kernel,
+                          uint64_t budget, uint64_t stream)
+{
+    conf_rng_t r = { g_seed ^ (stream * 0xD6E8FEB86659FD93ULL) };
+    uint64_t done = 0;
+
+    while (done < budget) {
+        gen_case(&r, kernel, &g_case);
+        if (case_fails(t, &g_case)) {
+            minimize(t, &g_case);
+            report(t, &g_case);
+            return 0;
+        }
+        done += (g_case.n > 0) ? g_case.n : 1U;
+    }
+    return 1;
+}
+
+/* Every supported backend, with and without SHA-NI, except pure scalar
+ * (which is the reference, unless the kernel has a separate reference) */
+static int conform_all_backends(conf_kernel_t kernel, uint64_t budget)
+{
+    for (uint32_t b = 0; b < CT_BACKEND_COUNT; b++) {
+        for (int sha = 0; sha <= 1; sha++) {
+            ct_dispatch_t t;
+            if (ct_dispatch_build(&t, (ct_backend_t)b, sha) != 0) {
+                continue;
+            }
+            if (sha && !t.sha256_accel) {
+                continue;
+            }
+            if (t.backend == CT_BACKEND_SCALAR && !t.sha256_accel &&
+                !is_unchecked(kernel) && !is_export(kernel) && kernel != K_DIV_Q16) {
+                continue;
+            }
+            if (!conform_kernel(&t, kernel, budget, (uint64_t)kernel * 16U + b * 2U + (uint64_t)sha)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static uint64_t budget(void)
+{
+    return (uint64_t)CONF_BASE_ELEMENTS * g_scale;
+}
+
+/* ============================================================================
+ * Test: Kernel Conformance
+ * ============================================================================ */
+
+static int test_add32_conformance(void)
+{
+    return conform_all_backends(K_ADD32, budget());
+}
+
+static int test_sub32_conformance(void)
+{
+    return conform_all_backends(K_SUB32, budget());
+}
+
+static int test_mul_q16_conformance(void)
+{
+    return conform_all_backends(K_MUL_Q16, budget());
+}
+
+static int test_normalize_conformance(void)
+{
+    return conform_all_backends(K_NORMALIZE, budget());
+}
+
+static int test_add32_unchecked_conformance(void)
+{
+    return conform_all_backends(K_ADD32_UNCHECKED, budget());
+}
+
+static int test_normalize_unchecked_conformance(void)
+{
+    return conform_all_backends(K_NORMALIZE_UNCHECKED, budget());
+}
+
+static int test_div_q16_conformance(void)
+{
+    return conform_all_backends(K_DIV_Q16, budget());
+}
+
+static int test_add16_conformance(void)
+{
+    return conform_all_backends(K_ADD16, budget());
+}
+
+static int test_normalize16_conformance(void)
+{
+    return conform_all_backends(K_NORMALIZE16, budget());
+}
+
+static int test_noise16_conformance(void)
+{
+    return conform_all_backends(K_NOISE16, budget());
+}
+
+static int test_to_f32_conformance(void)
+{
+    return conform_all_backends(K_TO_F32, budget());
+}
+
+static int test_to_f64_conformance(void)
+{
+    return conform_all_backends(K_TO_F64, budget());
+}
+
+static int test_to_bf16_conformance(void)
+{
+    return conform_all_backends(K_TO_BF16, budget());
+}
+
+static int test_transpose32_conformance(void)
+{
+    return conform_all_backends(K_TRANSPOSE32, budget());
+}
+
+static int test_warp_row_conformance(void)
+{
+    return conform_all_backends(K_WARP_ROW, budget());
+}
+
+static int test_lerp_q16_conformance(void)
+{
+    return conform_all_backends(K_LERP_Q16, budget());
+}
+
+static int test_prng_fill_conformance(void)
+{
+    return conform_all_backends(K_PRNG_FILL, budget());
+}
+
+static int test_prng_stride_conformance(void)
+{
+    return conform_all_backends(K_PRNG_STRIDE, budget());
+}
+
+static int test_bound_v2_conformance(void)
+{
+    return conform_all_backends(K_BOUND_V2, budget());
+}
+
+static int test_noise_conformance(void)
+{
+    return conform_all_backends(K_NOISE, budget());
+}
+
+static int test_sha256_conformance(void)
+{
+    /* Budget counts 64-byte blocks */
+    return conform_all_backends(K_SHA256, budget() / 8U);
+}
+
+static int test_permute_range_conformance(void)
+{
+    /* Batched permutation against per-index ct_permute_index */
+    return conform_kernel(ct_dispatch_get(), K_PERMUTE, budget() / 16U, 0xFEED);
+}
+
+/* ============================================================================
+ * Test: End-to-End Against the Primitive Definitions
+ * ============================================================================ */
+
+static int test_normalize_end_to_end(void)
+{
+    conf_rng_t r = { g_seed ^ 0x4E4F524DULL };
+    static int32_t x[CONF_CASE_MAX], means[CONF_CASE_MAX], inv[CONF_CASE_MAX];
+    static int32_t out[CONF_CASE_MAX], ref[CONF_CASE_MAX];
+    uint64_t done = 0;
+
+    while (done < budget() / 4U) {
+        uint32_t total = gen_len(&r, CONF_CASE_MAX);
+        uint32_t features = gen_len(&r, CONF_CASE_MAX);
+        for (uint32_t i = 0; i < CONF_CASE_MAX; i++) {
+            x[i] = gen_i32(&r);
+            means[i] = gen_i32(&r);
+            inv[i] = gen_i32(&r);
+        }
+
+        ct_normalize_ctx_t ctx;
+        ct_normalize_init(&ctx, means, inv, features);
+        ct_sample_t in = { 1, 0, 1, { total }, total, x };
+        ct_sample_t o = { 0, 0, 0, { 0 }, 0, out };
+        ct_fault_flags_t f = {0};
+        ct_fault_flags_t rf = {0};
+        ct_normalize_sample(&ctx, &in, &o, &f);
+
+        for (uint32_t i = 0; i < total; i++) {
+            ref[i] = (i < features) ?
+                dvm_mul_q16(dvm_sub32(x[i], means[i], &rf), inv[i], &rf) : x[i];
+        }
+
+        if (memcmp(out, ref, total * sizeof(int32_t)) != 0) return 0;
+        if (fault_bits(&f) != fault_bits(&rf)) return 0;
+        done += total + 1U;
+    }
+    return 1;
+}
+
+static int test_augment_noise_end_to_end(void)
+{
+    conf_rng_t r = { g_seed ^ 0x4E4F4953ULL };
+    static int32_t data[CONF_CASE_MAX], ref[CONF_CASE_MAX];
+    uint64_t done = 0;
+
+    while (done < budget() / 4U) {
+        uint32_t total = gen_len(&r, CONF_CASE_MAX);
+        uint32_t sample_idx = (uint32_t)(rng_next(&r) % 70000U);
+        ct_augment_ctx_t ctx;
+        ct_augment_flags_t flags = {0};
+        flags.gaussian_noise = 1;
+        ct_augment_init(&ctx, gen_u64(&r), (uint32_t)(rng_next(&r) % 100U), flags);
+        ctx.noise_std = gen_i32(&r);
+        if (ctx.noise_std <= 0) {
+            ctx.noise_std = FIXED_ONE;
+        }
+        for (uint32_t i = 0; i < total; i++) {
+            data[i] = gen_i32(&r);
+            ref[i] = data[i];
+        }
+
+        /* Reference: the pairwise primitive loop of CT-MATH-001 §6.3 */
+        ct_fault_flags_t rf = {0};
+        for (uint32_t i = 0; i < total; i += 2) {
+            for (uint32_t j = 0; j < 2; j++) {
+                uint64_t u = ct_prng(ctx.seed, ctx.epoch,
+                                     (sample_idx << 16) | (0x1000 + i + j));
+                int32_t u_fixed = (int32_t)((u >> 32) & 0xFFFF0000);
+                int32_t n = dvm_mul_q16(ctx.noise_std,
+                                        dvm_sub32(u_fixed, FIXED_HALF, &rf), &rf);
+                n = dvm_add32(n, n, &rf);
+                if (i + j < total) {
+                    ref[i + j] = dvm_add32(ref[i + j], n, &rf);
+                }
+            }
+        }
+
+        ct_sample_t in = { 1, 0, 2, { 1, total }, total, data };
+        ct_sample_t o;
+        ct_fault_flags_t f = {0};
+        ct_augment_sample(&ctx, &in, &o, sample_idx, &f);
+
+        if (memcmp(o.data, ref, total * sizeof(int32_t)) != 0) return 0;
+        if (fault_bits(&f) != fault_bits(&rf)) return 0;
+        done += total + 1U;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Harness Self-Test
+ * ============================================================================ */
+
+static void broken_mul_q16(const int32_t *a, const int32_t *b,
+                           int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    /* Truncating instead of round-to-nearest-even */
+    (void)faults;
+    for (uint32_t i = 0; i < n; i++) {
+        int64_t p = ((int64_t)a[i] * (int64_t)b[i]) >> 16;
+        out[i] = (p > INT32_MAX) ? INT32_MAX : (p < INT32_MIN) ? INT32_MIN : (int32_t)p;
+    }
+}
+
+static int test_harness_detects_and_minimizes(void)
+{
+    ct_dispatch_t t;
+    ct_dispatch_build(&t, CT_BACKEND_SCALAR, 0);
+    t.mul_q16 = broken_mul_q16;
+
+    g_quiet = 1;
+    int passed = conform_kernel(&t, K_MUL_Q16, 100000U, 0xBAD);
+    g_quiet = 0;
+
+    /* Must fail, and the reproducer must be a single element */
+    return !passed && g_case.n == 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(int argc, char **argv)
+{
+    const char *scale = (argc > 1) ? argv[1] : getenv("CT_CONFORMANCE_SCALE");
+    const char *seed = getenv("CT_CONFORMANCE_SEED");
+    if (scale != NULL && atoi(scale) > 0) {
+        g_scale = (uint32_t)atoi(scale);
+    }
+    if (seed != NULL) {
+        g_seed = strtoull(seed, NULL, 0);
+    }
+
+    ct_kernels_scalar_populate(&g_reference);
+
+    printf("==============================================\n");
+    printf("Certifiable Data - Kernel Conformance Tests\n");
+    printf("Traceability: CT-MATH-001 §14.4\n");
+    printf("CPU features: 0x%02x, active backend: %s\n",
+           ct_cpu_features(), ct_backend_name(ct_dispatch_get()->backend));
+    printf("Scale: %u (%llu elements per kernel per backend), seed 0x%llX\n",
+           g_scale, (unsigned long long)budget(), (unsigned long long)g_seed);
+    printf("==============================================\n\n");
+
+    printf("Kernel conformance:\n");
+    RUN_TEST(test_add32_conformance);
+    RUN_TEST(test_sub32_conformance);
+    RUN_TEST(test_mul_q16_conformance);
+    RUN_TEST(test_normalize_conformance);
+    RUN_TEST(test_div_q16_conformance);
+    RUN_TEST(test_add32_unchecked_conformance);
+    RUN_TEST(test_normalize_unchecked_conformance);
+    RUN_TEST(test_add16_conformance);
+    RUN_TEST(test_normalize16_conformance);
+    RUN_TEST(test_noise16_conformance);
+    RUN_TEST(test_to_f32_conformance);
+    RUN_TEST(test_to_f64_conformance);
+    RUN_TEST(test_to_bf16_conformance);
+    RUN_TEST(test_transpose32_conformance);
+    RUN_TEST(test_warp_row_conformance);
+    RUN_TEST(test_lerp_q16_conformance);
+    RUN_TEST(test_prng_fill_conformance);
+    RUN_TEST(test_prng_stride_conformance);
+    RUN_TEST(test_bound_v2_conformance);
+    RUN_TEST(test_noise_conformance);
+    RUN_TEST(test_sha256_conformance);
+    RUN_TEST(test_permute_range_conformance);
+
+    printf("\nEnd-to-end:\n");
+    RUN_TEST(test_normalize_end_to_end);
+    RUN_TEST(test_augment_noise_end_to_end);
+
+    printf("\nHarness:\n");
+    RUN_TEST(test_harness_detects_and_minimizes);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
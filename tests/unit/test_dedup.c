@@ -0,0 +1,267 @@
+/**
+ * @file test_dedup.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for duplicate detection by leaf hash
+ *
+ * @details Reports are checked against a direct comparison of sample values.
+ *
+ * @traceability CT-MATH-001 §7.11, CT-STRUCT-001 §26
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ct_types.h"
+#include "dedup.h"
+#include "exclusion.h"
+#include "loader.h"
+#include "merkle.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define DD_N     1000U
+#define DD_CAP   2048U
+#define DD_PMAX  7U
+
+static int32_t g_data[DD_N];
+static ct_sample_t g_samples[DD_N];
+static ct_hash_t g_leaves[DD_N];
+static uint32_t g_first[DD_N];           /* first sample with the same value */
+
+static ct_dedup_slot_t g_slots[DD_PMAX][DD_CAP];
+static ct_dedup_pair_t g_pairs[DD_PMAX][DD_N];
+static ct_dedup_t g_parts[DD_PMAX];
+
+static uint64_t g_words[CT_EXCLUSION_WORDS(DD_N)];
+static uint64_t g_blocks[CT_EXCLUSION_BLOCKS(DD_N)];
+static uint32_t g_hints[CT_EXCLUSION_HINTS(DD_N)];
+
+/* Values repeat irregularly: roughly 40% of the samples are duplicates */
+static void setup(void)
+{
+    for (uint32_t i = 0; i < DD_N; i++) {
+        g_data[i] = (int32_t)(((i * 0x9E3779B1U) >> 7) % 600U);
+        g_samples[i] = (ct_sample_t){ .version = 1, .ndims = 1, .dims = {1, 0, 0, 0},
+                                      .total_elements = 1, .data = &g_data[i] };
+
+        g_first[i] = i;
+        for (uint32_t j = 0; j < i; j++) {
+            if (g_data[j] == g_data[i]) {
+                g_first[i] = j;
+                break;
+            }
+        }
+    }
+    ct_dataset_t dataset;
+    ct_dataset_init(&dataset, g_samples, DD_N);
+    ct_hash_dataset_leaves(&dataset, g_leaves);
+}
+
+/* All partitions of a pass, leaves fed in runs of the given length */
+static int run_pass(uint32_t num_partitions, uint32_t run)
+{
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        if (ct_dedup_init(&g_parts[p], g_slots[p], DD_CAP, g_pairs[p], DD_N,
+                          num_partitions, p) != 0) return 0;
+        for (uint32_t base = 0; base < DD_N; base += run) {
+            uint32_t len = (DD_N - base < run) ? DD_N - base : run;
+            if (ct_dedup_add(&g_parts[p], (const ct_hash_t *)&g_leaves[base], len) != 0) return 0;
+        }
+    }
+    return 1;
+}
+
+/* Every report entry and no other, canonical at the first occurrence */
+static int reports_match(uint32_t num_partitions)
+{
+    uint32_t reported = 0;
+    uint32_t unique = 0;
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        const ct_dedup_t *d = &g_parts[p];
+        for (uint32_t j = 0; j < d->num_duplicates; j++) {
+            uint32_t i = d->pairs[j].index;
+            if (j > 0 && i <= d->pairs[j - 1].index) return 0;
+            if (g_first[i] == i || d->pairs[j].canonical != g_first[i]) return 0;
+            if (ct_dedup_partition_of(g_leaves[i], num_partitions) != p) return 0;
+        }
+        reported += d->num_duplicates;
+        unique += d->num_unique;
+    }
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < DD_N; i++) {
+        expected += (g_first[i] != i) ? 1U : 0U;
+    }
+    return reported == expected && unique == DD_N - expected;
+}
+
+/* ============================================================================
+ * Test: Table
+ * ============================================================================ */
+
+static int test_init_rejects(void)
+{
+    ct_dedup_t d;
+    memset(&d, 0, sizeof(d));
+    if (ct_dedup_init(&d, g_slots[0], 0, g_pairs[0], DD_N, 1, 0) != -1) return 0;
+    if (ct_dedup_init(&d, g_slots[0], 1000, g_pairs[0], DD_N, 1, 0) != -1) return 0;
+    if (ct_dedup_init(&d, g_slots[0], DD_CAP, g_pairs[0], DD_N, 4, 4) != -1) return 0;
+    if (ct_dedup_init(&d, g_slots[0], DD_CAP, g_pairs[0], DD_N, 0, 0) != -1) return 0;
+    return d.capacity == 0;
+}
+
+static int test_single_partition(void)
+{
+    return run_pass(1, DD_N) && reports_match(1);
+}
+
+/* Runs and partition counts change nothing but where entries are kept */
+static int test_partitions_and_runs(void)
+{
+    static const uint32_t CASES[4][2] = { { 1, 13 }, { 4, DD_N }, { 7, 64 }, { 2, 1 } };
+    for (uint32_t k = 0; k < 4; k++) {
+        if (!run_pass(CASES[k][0], CASES[k][1]) || !reports_match(CASES[k][0])) return 0;
+    }
+
+    /* Partitions divide the digest space evenly */
+    uint32_t count[4] = { 0 };
+    for (uint32_t i = 0; i < DD_N; i++) {
+        uint32_t p = ct_dedup_partition_of(g_leaves[i], 4);
+        if (p >= 4) return 0;
+        count[p]++;
+    }
+    for (uint32_t p = 0; p < 4; p++) {
+        if (count[p] < DD_N / 8U) return 0;
+    }
+    return ct_dedup_partition_of(g_leaves[0], 1) == 0;
+}
+
+static int test_full_table_and_report(void)
+{
+    /* Eight slots hold seven digests */
+    ct_dedup_t d;
+    ct_hash_t distinct[8];
+    for (uint32_t i = 0; i < 8; i++) {
+        memset(distinct[i], (int)(i + 1U), 32);
+    }
+    if (ct_dedup_init(&d, g_slots[0], 8, g_pairs[0], DD_N, 1, 0) != 0) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)distinct, 7) != 0 || d.num_unique != 7) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)distinct, 1) != 0 || d.num_duplicates != 1) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)&distinct[7], 1) != -1) return 0;
+
+    /* No room to report */
+    ct_hash_t same[2];
+    memset(same, 0x5A, sizeof(same));
+    if (ct_dedup_init(&d, g_slots[0], 8, g_pairs[0], 0, 1, 0) != 0) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)same, 2) != -1) return 0;
+
+    /* Indices stop short of CT_DEDUP_EMPTY */
+    if (ct_dedup_init(&d, g_slots[0], 8, g_pairs[0], DD_N, 1, 0) != 0) return 0;
+    d.next_index = CT_DEDUP_EMPTY - 1U;
+    if (ct_dedup_add(&d, (const ct_hash_t *)same, 2) != -1 || d.next_index != CT_DEDUP_EMPTY - 1U) return 0;
+    return ct_dedup_add(&d, (const ct_hash_t *)same, 1) == 0 && d.num_unique == 1;
+}
+
+static int test_small_tables_keep_a_free_slot(void)
+{
+    ct_dedup_t d;
+    ct_hash_t distinct[5];
+    for (uint32_t i = 0; i < 5; i++) {
+        memset(distinct[i], (int)(i + 1U), 32);
+    }
+
+    /* Four slots hold three digests; the fourth new digest is refused */
+    if (ct_dedup_init(&d, g_slots[0], 4, g_pairs[0], DD_N, 1, 0) != 0) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)distinct, 3) != 0 || d.num_unique != 3) return 0;
+    if (ct_dedup_add(&d, (const ct_hash_t *)&distinct[3], 2) != -1 || d.num_unique != 3) return 0;
+
+    /* Probes for known digests still end at the free slot */
+    if (ct_dedup_add(&d, (const ct_hash_t *)distinct, 3) != 0 || d.num_duplicates != 3) return 0;
+
+    /* One slot holds nothing */
+    if (ct_dedup_init(&d, g_slots[0], 1, g_pairs[0], DD_N, 1, 0) != 0) return 0;
+    return ct_dedup_add(&d, (const ct_hash_t *)distinct, 1) == -1 && d.num_unique == 0;
+}
+
+/* ============================================================================
+ * Test: Results
+ * ============================================================================ */
+
+static int test_exclude_and_unique(void)
+{
+    if (!run_pass(4, 100)) return 0;
+
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, DD_N, g_words, g_blocks, g_hints);
+    if (ct_dedup_exclude(g_parts, 4, &ex) != 0) return 0;
+
+    uint32_t unique[DD_N];
+    uint32_t n = ct_dedup_unique(&ex, unique);
+    if (n != ex.num_kept) return 0;
+    uint32_t k = 0;
+    for (uint32_t i = 0; i < DD_N; i++) {
+        if (g_first[i] == i) {
+            if (k >= n || unique[k++] != i) return 0;
+        }
+    }
+    if (k != n) return 0;
+
+    /* Same result whatever the partition count */
+    ct_hash_t root4, root1;
+    memcpy(root4, ex.bitmap_hash, 32);
+    if (!run_pass(1, DD_N)) return 0;
+    ct_exclusion_init(&ex, DD_N, g_words, g_blocks, g_hints);
+    if (ct_dedup_exclude(g_parts, 1, &ex) != 0) return 0;
+    memcpy(root1, ex.bitmap_hash, 32);
+    if (memcmp(root4, root1, 32) != 0) return 0;
+
+    /* An exclusion over fewer samples is left alone */
+    ct_exclusion_init(&ex, DD_N - 1U, g_words, g_blocks, g_hints);
+    if (g_first[DD_N - 1U] == DD_N - 1U) return 0;  /* fixture: last is a duplicate */
+    if (ct_dedup_exclude(g_parts, 1, &ex) != -1) return 0;
+    return ex.num_kept == DD_N - 1U;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Deduplication Tests\n");
+    printf("Traceability: CT-MATH-001 §7.11, CT-STRUCT-001 §26\n");
+    printf("==============================================\n\n");
+
+    setup();
+
+    printf("Table:\n");
+    RUN_TEST(test_init_rejects);
+    RUN_TEST(test_single_partition);
+    RUN_TEST(test_partitions_and_runs);
+    RUN_TEST(test_full_table_and_report);
+    RUN_TEST(test_small_tables_keep_a_free_slot);
+
+    printf("\nResults:\n");
+    RUN_TEST(test_exclude_and_unique);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
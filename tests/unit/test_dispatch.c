@@ -0,0 +1,243 @@
+/**
+ * @file test_dispatch.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for CPU feature detection and kernel dispatch
+ *
+ * @traceability CT-MATH-001 §14.4
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ct_types.h"
+#include "dispatch.h"
+#include "kernels.h"
+#include "sha256.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Test: Environment Override
+ * ============================================================================ */
+
+static int test_env_forces_scalar(void)
+{
+    /* Must run before anything touches the process-wide table */
+    setenv(CT_DISPATCH_ENV, "scalar", 1);
+    int status = ct_dispatch_init();
+    unsetenv(CT_DISPATCH_ENV);
+
+    const ct_dispatch_t *t = ct_dispatch_get();
+    if (status != 0) return 0;
+    if (t->backend != CT_BACKEND_SCALAR) return 0;
+    if (t->sha256_accel != 0) return 0;
+    if (t->add32 != ct_kernel_add32_scalar) return 0;
+    if (t->sha256_blocks != ct_sha256_blocks_scalar) return 0;
+
+    return 1;
+}
+
+static int test_init_idempotent(void)
+{
+    int first = ct_dispatch_init();
+    const ct_dispatch_t *t1 = ct_dispatch_get();
+    int second = ct_dispatch_init();
+    const ct_dispatch_t *t2 = ct_dispatch_get();
+
+    return first == second && t1 == t2 && t1->backend == CT_BACKEND_SCALAR;
+}
+
+/* ============================================================================
+ * Test: Table Construction
+ * ============================================================================ */
+
+static int test_build_scalar_always_supported(void)
+{
+    ct_dispatch_t t;
+    if (ct_dispatch_build(&t, CT_BACKEND_SCALAR, 0) != 0) return 0;
+
+    return t.backend == CT_BACKEND_SCALAR &&
+           t.mul_q16 == ct_kernel_mul_q16_scalar &&
+           t.normalize == ct_kernel_normalize_scalar &&
+           t.prng_fill == ct_kernel_prng_fill_scalar &&
+           t.noise == ct_kernel_noise_scalar;
+}
+
+static int test_build_invalid_backend_rejected(void)
+{
+    ct_dispatch_t t;
+    return ct_dispatch_build(&t, (ct_backend_t)CT_BACKEND_COUNT, 1) == -1;
+}
+
+static int test_build_matches_cpu_features(void)
+{
+    uint32_t f = ct_cpu_features();
+    ct_dispatch_t t;
+
+    if ((ct_dispatch_build(&t, CT_BACKEND_SSE41, 0) == 0) != ((f & CT_CPU_SSE41) != 0)) return 0;
+    if ((ct_dispatch_build(&t, CT_BACKEND_AVX2, 0) == 0) != ((f & CT_CPU_AVX2) != 0)) return 0;
+    if ((ct_dispatch_build(&t, CT_BACKEND_AVX512, 0) == 0) != ((f & CT_CPU_AVX512) != 0)) return 0;
+
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Self-Check
+ * ============================================================================ */
+
+static int test_self_check_every_supported_backend(void)
+{
+    for (uint32_t b = 0; b < CT_BACKEND_COUNT; b++) {
+        for (int sha = 0; sha <= 1; sha++) {
+            ct_dispatch_t t;
+            if (ct_dispatch_build(&t, (ct_backend_t)b, sha) != 0) {
+                continue;
+            }
+            if (!ct_dispatch_self_check(&t)) return 0;
+        }
+    }
+    return 1;
+}
+
+static void broken_add32(const int32_t *a, const int32_t *b,
+                         int32_t *out, uint32_t n, ct_fault_flags_t *faults)
+{
+    /* Wrapping add: wrong on overflow and never raises faults */
+    (void)faults;
+    for (uint32_t i = 0; i < n; i++) {
+        out[i] = (int32_t)((uint32_t)a[i] + (uint32_t)b[i]);
+    }
+}
+
+static int test_self_check_detects_mismatch(void)
+{
+    ct_dispatch_t t;
+    ct_dispatch_build(&t, CT_BACKEND_SCALAR, 0);
+    t.add32 = broken_add32;
+
+    return ct_dispatch_self_check(&t) == 0;
+}
+
+/* ============================================================================
+ * Test: SHA-256 Backends
+ * ============================================================================ */
+
+static int test_sha256_blocks_known_vector(void)
+{
+    /* FIPS 180-2: SHA256("abc"), single padded block */
+    uint8_t block[64] = {0};
+    block[0] = 'a';
+    block[1] = 'b';
+    block[2] = 'c';
+    block[3] = 0x80;
+    block[63] = 24;
+
+    static const uint32_t expected[8] = {
+        0xba7816bf, 0x8f01cfea, 0x414140de, 0x5dae2223,
+        0xb00361a3, 0x96177a9c, 0xb410ff61, 0xf20015ad
+    };
+
+    for (int sha = 0; sha <= 1; sha++) {
+        ct_dispatch_t t;
+        ct_dispatch_build(&t, CT_BACKEND_SCALAR, sha);
+        uint32_t state[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                              0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        t.sha256_blocks(state, block, 1);
+        if (memcmp(state, expected, sizeof(expected)) != 0) return 0;
+    }
+
+    return 1;
+}
+
+static int test_sha256_update_split_invariant(void)
+{
+    /* Hashing in odd-sized pieces must equal hashing in one call */
+    uint8_t msg[1000];
+    for (uint32_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = (uint8_t)(i * 131U + 7U);
+    }
+
+    ct_sha256_ctx_t ctx;
+    uint8_t whole[32];
+    ct_sha256_init(&ctx);
+    ct_sha256_update(&ctx, msg, sizeof(msg));
+    ct_sha256_final(&ctx, whole);
+
+    static const size_t pieces[] = { 1, 63, 64, 65, 127, 3, 200, 477 };
+    uint8_t split[32];
+    size_t off = 0;
+    ct_sha256_init(&ctx);
+    for (size_t p = 0; p < sizeof(pieces) / sizeof(pieces[0]); p++) {
+        ct_sha256_update(&ctx, &msg[off], pieces[p]);
+        off += pieces[p];
+    }
+    ct_sha256_final(&ctx, split);
+
+    return off == sizeof(msg) && memcmp(whole, split, 32) == 0;
+}
+
+/* ============================================================================
+ * Test: Backend Names
+ * ============================================================================ */
+
+static int test_backend_names(void)
+{
+    if (strcmp(ct_backend_name(CT_BACKEND_SCALAR), "scalar") != 0) return 0;
+    if (strcmp(ct_backend_name(CT_BACKEND_SSE41), "sse4.1") != 0) return 0;
+    if (strcmp(ct_backend_name(CT_BACKEND_AVX2), "avx2") != 0) return 0;
+    if (strcmp(ct_backend_name(CT_BACKEND_AVX512), "avx512") != 0) return 0;
+    if (strcmp(ct_backend_name((ct_backend_t)CT_BACKEND_COUNT), "unknown") != 0) return 0;
+
+    return 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Kernel Dispatch Tests\n");
+    printf("Traceability: CT-MATH-001 §14.4\n");
+    printf("CPU features: 0x%02x\n", ct_cpu_features());
+    printf("==============================================\n\n");
+
+    printf("Environment override:\n");
+    RUN_TEST(test_env_forces_scalar);
+    RUN_TEST(test_init_idempotent);
+
+    printf("\nTable construction:\n");
+    RUN_TEST(test_build_scalar_always_supported);
+    RUN_TEST(test_build_invalid_backend_rejected);
+    RUN_TEST(test_build_matches_cpu_features);
+
+    printf("\nSelf-check:\n");
+    RUN_TEST(test_self_check_every_supported_backend);
+    RUN_TEST(test_self_check_detects_mismatch);
+
+    printf("\nSHA-256 backends:\n");
+    RUN_TEST(test_sha256_blocks_known_vector);
+    RUN_TEST(test_sha256_update_split_invariant);
+
+    printf("\nBackend names:\n");
+    RUN_TEST(test_backend_names);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,273 @@
+/**
+ * @file test_exclusion.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for the exclusion bitmap and its rank/select directories
+ *
+ * @details Rank and select are checked against a plain scan of the bitmap.
+ *
+ * @traceability CT-MATH-001 §7.9, CT-STRUCT-001 §24
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ct_types.h"
+#include "batch.h"
+#include "exclusion.h"
+#include "loader.h"
+#include "merkle.h"
+#include "shuffle.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define EX_MAX  5000U
+
+static uint64_t g_words[CT_EXCLUSION_WORDS(EX_MAX)];
+static uint64_t g_blocks[CT_EXCLUSION_BLOCKS(EX_MAX)];
+static uint32_t g_hints[CT_EXCLUSION_HINTS(EX_MAX)];
+static uint32_t g_kept[EX_MAX];
+
+static int excluded(const ct_exclusion_t *ex, uint32_t i)
+{
+    return (int)((ex->words[i / 64U] >> (i % 64U)) & 1U);
+}
+
+/* Rank at every i ∈ [0, N] and select at every k against a plain scan */
+static int matches_scan(const ct_exclusion_t *ex)
+{
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < ex->num_samples; i++) {
+        if (ct_exclusion_rank(ex, i) != kept) return 0;
+        if (!excluded(ex, i)) {
+            g_kept[kept++] = i;
+        }
+    }
+    if (ct_exclusion_rank(ex, ex->num_samples) != kept || ex->num_kept != kept) return 0;
+    for (uint32_t k = 0; k < kept; k++) {
+        if (ct_exclusion_select(ex, k) != g_kept[k]) return 0;
+    }
+    return 1;
+}
+
+/* Exclude i when the hash of i falls below density / 256 */
+static void exclude_pattern(ct_exclusion_t *ex, uint32_t density, uint32_t salt)
+{
+    for (uint32_t i = 0; i < ex->num_samples; i++) {
+        uint32_t h = (i + salt) * 0x9E3779B1U;
+        if ((h >> 24) < density) {
+            (void)ct_exclusion_add(ex, &i, 1);
+        }
+    }
+}
+
+/* ============================================================================
+ * Test: Rank and Select
+ * ============================================================================ */
+
+static int test_all_kept(void)
+{
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, EX_MAX, g_words, g_blocks, g_hints);
+    if (ex.num_kept != EX_MAX) return 0;
+    for (uint32_t i = 0; i < EX_MAX; i += 7) {
+        if (ct_exclusion_rank(&ex, i) != i || ct_exclusion_select(&ex, i) != i) return 0;
+    }
+    return matches_scan(&ex);
+}
+
+static int test_densities(void)
+{
+    static const uint32_t DENSITIES[5] = { 1, 16, 128, 240, 255 };
+    for (uint32_t d = 0; d < 5; d++) {
+        ct_exclusion_t ex;
+        ct_exclusion_init(&ex, EX_MAX, g_words, g_blocks, g_hints);
+        exclude_pattern(&ex, DENSITIES[d], d);
+        if (!matches_scan(&ex)) return 0;
+    }
+    return 1;
+}
+
+static int test_empty_blocks_and_edges(void)
+{
+    /* Sizes around word and block boundaries; whole blocks excluded */
+    static const uint32_t SIZES[7] = { 1, 63, 64, 65, 511, 513, 4097 };
+    for (uint32_t s = 0; s < 7; s++) {
+        uint32_t n = SIZES[s];
+        ct_exclusion_t ex;
+        ct_exclusion_init(&ex, n, g_words, g_blocks, g_hints);
+        for (uint32_t i = 0; i < n; i++) {
+            if ((i / 512U) % 2U == 1U || (i % 64U) == 63U) {
+                (void)ct_exclusion_add(&ex, &i, 1);
+            }
+        }
+        if (!matches_scan(&ex)) return 0;
+    }
+
+    /* Every sample excluded */
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, 600, g_words, g_blocks, g_hints);
+    for (uint32_t i = 0; i < 600; i++) {
+        (void)ct_exclusion_add(&ex, &i, 1);
+    }
+    return ex.num_kept == 0 && ct_exclusion_rank(&ex, 600) == 0;
+}
+
+static int test_add_rejects_and_rebuild(void)
+{
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, 1000, g_words, g_blocks, g_hints);
+    ct_hash_t before;
+    memcpy(before, ex.bitmap_hash, 32);
+
+    uint32_t bad[3] = { 5, 1000, 7 };
+    if (ct_exclusion_add(&ex, bad, 3) != -1) return 0;
+    if (ex.num_kept != 1000 || excluded(&ex, 5) || memcmp(before, ex.bitmap_hash, 32) != 0) return 0;
+
+    uint32_t good[3] = { 5, 7, 5 };
+    if (ct_exclusion_add(&ex, good, 3) != 0 || ex.num_kept != 998) return 0;
+    if (ct_exclusion_select(&ex, 5) != 6 || ct_exclusion_select(&ex, 6) != 8) return 0;
+
+    /* Re-admit sample 5 by editing the bitmap */
+    g_words[0] &= ~(1ULL << 5);
+    ct_exclusion_rebuild(&ex);
+    return ex.num_kept == 999 && ct_exclusion_select(&ex, 5) == 5 && matches_scan(&ex);
+}
+
+/* ============================================================================
+ * Test: Commitment
+ * ============================================================================ */
+
+static int test_commitment(void)
+{
+    ct_hash_t root = { 0xAB };
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, 3000, g_words, g_blocks, g_hints);
+    ct_hash_t none, one, again, other;
+    ct_hash_dataset_excluding(root, &ex, none);
+
+    uint32_t idx = 2047;
+    (void)ct_exclusion_add(&ex, &idx, 1);
+    ct_hash_dataset_excluding(root, &ex, one);
+    ct_hash_dataset_excluding(root, &ex, again);
+    if (memcmp(none, one, 32) == 0 || memcmp(one, again, 32) != 0) return 0;
+
+    /* Same bitmap over another dataset root */
+    root[0] ^= 1;
+    ct_hash_dataset_excluding(root, &ex, other);
+    if (memcmp(one, other, 32) == 0) return 0;
+
+    /* A different sample removed */
+    ct_exclusion_init(&ex, 3000, g_words, g_blocks, g_hints);
+    idx = 2046;
+    (void)ct_exclusion_add(&ex, &idx, 1);
+    root[0] ^= 1;
+    ct_hash_dataset_excluding(root, &ex, other);
+    return memcmp(one, other, 32) != 0;
+}
+
+/* ============================================================================
+ * Test: Batches
+ * ============================================================================ */
+
+#define BX_N  40
+#define BX_B  6
+
+static int32_t g_data[BX_N];
+static ct_sample_t g_samples[BX_N];
+
+static int test_batches_skip_excluded(void)
+{
+    for (uint32_t i = 0; i < BX_N; i++) {
+        g_data[i] = (int32_t)i;
+        g_samples[i] = (ct_sample_t){ .version = 1, .ndims = 1, .dims = {1, 0, 0, 0},
+                                      .total_elements = 1, .data = &g_data[i] };
+    }
+    ct_dataset_t dataset;
+    ct_dataset_init(&dataset, g_samples, BX_N);
+    ct_hash_t leaves[BX_N];
+    ct_hash_dataset_leaves(&dataset, leaves);
+
+    ct_exclusion_t ex;
+    ct_exclusion_init(&ex, BX_N, g_words, g_blocks, g_hints);
+    uint32_t bad[4] = { 0, 13, 14, 39 };
+    if (ct_exclusion_add(&ex, bad, 4) != 0) return 0;
+
+    /* 36 survivors in six batches of six, each exactly once */
+    uint32_t seen[BX_N] = { 0 };
+    for (uint32_t b = 0; b < 6; b++) {
+        ct_sample_t samples[BX_B];
+        ct_hash_t hashes[BX_B];
+        ct_batch_t full;
+        ct_batch_init(&full, samples, hashes, BX_B);
+        if (ct_batch_fill_excluding(&full, &dataset, &ex, b, 2, 77) != 0) return 0;
+
+        ct_sample_ref_t refs[BX_B];
+        ct_batch_ref_t compact;
+        ct_batch_ref_init(&compact, refs, BX_B);
+        if (ct_batch_ref_fill_excluding(&compact, BX_N, (const ct_hash_t *)leaves,
+                                        &ex, b, 2, 77) != 0) return 0;
+        if (memcmp(full.batch_hash, compact.batch_hash, 32) != 0 || compact.count != BX_B) return 0;
+
+        for (uint32_t i = 0; i < BX_B; i++) {
+            uint32_t idx = (uint32_t)*(const int32_t *)samples[i].data;
+            if (excluded(&ex, idx) || refs[i].shuffled_index != idx) return 0;
+            seen[idx]++;
+        }
+    }
+    for (uint32_t i = 0; i < BX_N; i++) {
+        if (seen[i] != (excluded(&ex, i) ? 0U : 1U)) return 0;
+    }
+
+    /* Exclusion over another dataset size */
+    ct_sample_t samples[BX_B];
+    ct_hash_t hashes[BX_B];
+    ct_batch_t full;
+    ct_batch_init(&full, samples, hashes, BX_B);
+    ct_exclusion_init(&ex, BX_N - 1, g_words, g_blocks, g_hints);
+    return ct_batch_fill_excluding(&full, &dataset, &ex, 0, 2, 77) == -1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Exclusion Bitmap Tests\n");
+    printf("Traceability: CT-MATH-001 §7.9, CT-STRUCT-001 §24\n");
+    printf("==============================================\n\n");
+
+    printf("Rank and select:\n");
+    RUN_TEST(test_all_kept);
+    RUN_TEST(test_densities);
+    RUN_TEST(test_empty_blocks_and_edges);
+    RUN_TEST(test_add_rejects_and_rebuild);
+
+    printf("\nCommitment:\n");
+    RUN_TEST(test_commitment);
+
+    printf("\nBatches:\n");
+    RUN_TEST(test_batches_skip_excluded);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,394 @@
+/**
+ * @file test_export.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for zero-copy batch export
+ *
+ * @traceability CT-MATH-001 §3.11, CT-STRUCT-001 §22
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "batch.h"
+#include "loader.h"
+#include "export.h"
+#include "dispatch.h"
+#include "shm.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define EXP_N  10
+#define EXP_B  4
+#define EXP_H  2
+#define EXP_W  3
+
+static int32_t g_data[EXP_N][EXP_H * EXP_W];
+static ct_sample_t g_samples[EXP_N];
+static ct_dataset_t g_dataset;
+
+static void setup(void)
+{
+    for (uint32_t i = 0; i < EXP_N; i++) {
+        for (uint32_t j = 0; j < EXP_H * EXP_W; j++) {
+            g_data[i][j] = (int32_t)((i * 16U + j) << 16);
+        }
+        g_samples[i] = (ct_sample_t){ .version = 1, .ndims = 2, .dims = {EXP_H, EXP_W, 0, 0},
+                                      .total_elements = EXP_H * EXP_W, .data = g_data[i] };
+    }
+    ct_dataset_init(&g_dataset, g_samples, EXP_N);
+}
+
+static int g_released = 0;
+
+static void count_release(void *ctx)
+{
+    (void)ctx;
+    g_released++;
+}
+
+/* Element [b][r][c] through the exported strides */
+static int32_t at(const ct_dl_tensor_t *t, int64_t b, int64_t r, int64_t c)
+{
+    const int32_t *p = (const int32_t *)t->data;
+    return p[b * t->strides[0] + r * t->strides[1] + c * t->strides[2]];
+}
+
+/* ============================================================================
+ * Test: ABI
+ * ============================================================================ */
+
+static int test_dlpack_layout(void)
+{
+    /* DLPack on LP64: field offsets consumers rely on */
+    if (sizeof(void *) != 8) return 1;
+    return sizeof(ct_dl_device_t) == 8 && sizeof(ct_dl_dtype_t) == 4 &&
+           offsetof(ct_dl_tensor_t, device) == 8 &&
+           offsetof(ct_dl_tensor_t, ndim) == 16 &&
+           offsetof(ct_dl_tensor_t, dtype) == 20 &&
+           offsetof(ct_dl_tensor_t, shape) == 24 &&
+           offsetof(ct_dl_tensor_t, strides) == 32 &&
+           offsetof(ct_dl_tensor_t, byte_offset) == 40 &&
+           offsetof(ct_dl_managed_tensor_t, manager_ctx) == 48 &&
+           offsetof(ct_dl_managed_tensor_t, deleter) == 56;
+}
+
+/* ============================================================================
+ * Test: Export
+ * ============================================================================ */
+
+static int test_export_packed_batch(void)
+{
+    ct_sample_t samples[EXP_B];
+    ct_hash_t hashes[EXP_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, EXP_B);
+    ct_batch_fill(&batch, &g_dataset, 0, 0, 42);
+
+    int32_t packed[EXP_B * EXP_H * EXP_W];
+    ct_batch_export_t e;
+    if (ct_batch_pack(&batch, packed, EXP_B * EXP_H * EXP_W) != 0) return 0;
+    if (ct_batch_export_dlpack(&batch, &e, count_release, NULL) != 0) return 0;
+
+    const ct_dl_tensor_t *t = &e.managed.dl_tensor;
+    if (t->data != packed || t->ndim != 3 || t->byte_offset != 0) return 0;
+    if (t->device.device_type != CT_DL_DEVICE_CPU || t->device.device_id != 0) return 0;
+    if (t->dtype.code != CT_DL_CODE_INT || t->dtype.bits != 32 || t->dtype.lanes != 1) return 0;
+    if (t->shape[0] != EXP_B || t->shape[1] != EXP_H || t->shape[2] != EXP_W) return 0;
+    if (t->strides[0] != EXP_H * EXP_W || t->strides[1] != EXP_W || t->strides[2] != 1) return 0;
+
+    for (int64_t b = 0; b < EXP_B; b++) {
+        for (int64_t r = 0; r < EXP_H; r++) {
+            for (int64_t c = 0; c < EXP_W; c++) {
+                if (at(t, b, r, c) != samples[b].data[r * EXP_W + c]) return 0;
+            }
+        }
+    }
+
+    /* Deleter releases exactly once */
+    g_released = 0;
+    e.managed.deleter(&e.managed);
+    e.managed.deleter(&e.managed);
+    return g_released == 1;
+}
+
+static int test_export_partial_batch(void)
+{
+    ct_sample_t samples[EXP_B];
+    ct_hash_t hashes[EXP_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, EXP_B);
+    ct_batch_fill(&batch, &g_dataset, 2, 0, 42);
+
+    int32_t packed[EXP_B * EXP_H * EXP_W];
+    ct_batch_export_t e;
+    return ct_batch_pack(&batch, packed, EXP_B * EXP_H * EXP_W) == 0 &&
+           ct_batch_export_dlpack(&batch, &e, NULL, NULL) == 0 &&
+           e.managed.dl_tensor.shape[0] == 2;
+}
+
+static int test_export_rejects_scattered_and_mixed(void)
+{
+    ct_sample_t samples[3] = { g_samples[0], g_samples[2], g_samples[1] };
+    ct_hash_t hashes[3];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, 3);
+    ct_batch_export_t e;
+
+    /* Samples 0, 2, 1 of the dataset: not at a constant stride */
+    if (ct_batch_export_dlpack(&batch, &e, NULL, NULL) != -1) return 0;
+
+    /* Constant stride but a different shape */
+    samples[1] = g_samples[1];
+    samples[2] = g_samples[2];
+    if (ct_batch_export_dlpack(&batch, &e, NULL, NULL) != 0) return 0;
+    samples[2].dims[0] = EXP_W;
+    samples[2].dims[1] = EXP_H;
+    if (ct_batch_export_dlpack(&batch, &e, NULL, NULL) != -1) return 0;
+
+    /* Nothing filled */
+    ct_sample_t empty[2];
+    memset(empty, 0, sizeof(empty));
+    ct_batch_init(&batch, empty, hashes, 2);
+    return ct_batch_export_dlpack(&batch, &e, NULL, NULL) == -1;
+}
+
+/* ============================================================================
+ * Test: Converting Export
+ * ============================================================================ */
+
+#define CONV_N  37   /* Covers every vector width plus a scalar tail */
+
+static int test_export_f32_any_layout(void)
+{
+    /* Samples 0, 2, 1: scattered, which the in-place export rejects */
+    ct_sample_t samples[3] = { g_samples[0], g_samples[2], g_samples[1] };
+    ct_hash_t hashes[3];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, 3);
+
+    float buf[3 * EXP_H * EXP_W];
+    ct_batch_export_t e;
+    memset(buf, 0, sizeof(buf));
+    if (ct_batch_export_f32(&batch, buf, 3 * EXP_H * EXP_W - 1, &e, NULL, NULL) != -1) return 0;
+    if (buf[0] != 0.0f) return 0;
+
+    g_released = 0;
+    if (ct_batch_export_f32(&batch, buf, 3 * EXP_H * EXP_W, &e, count_release, NULL) != 0) return 0;
+
+    const ct_dl_tensor_t *t = &e.managed.dl_tensor;
+    if (t->data != buf || t->ndim != 3) return 0;
+    if (t->dtype.code != CT_DL_CODE_FLOAT || t->dtype.bits != 32 || t->dtype.lanes != 1) return 0;
+    if (t->strides[0] != EXP_H * EXP_W || t->strides[1] != EXP_W || t->strides[2] != 1) return 0;
+
+    for (uint32_t b = 0; b < 3; b++) {
+        for (uint32_t j = 0; j < EXP_H * EXP_W; j++) {
+            if (buf[b * EXP_H * EXP_W + j] != (float)(samples[b].data[j] >> 16)) return 0;
+        }
+    }
+    e.managed.deleter(&e.managed);
+    return g_released == 1;
+}
+
+static int test_export_f32_rounding(void)
+{
+    /* Exact below 2^24; RNE above, including the ties and INT32 limits */
+    static const int32_t x[8] = {
+        0x00FFFFFF, 0x01000001, 0x01000003, -0x01000003,
+        INT32_MAX, INT32_MIN, 1, -1
+    };
+    static const float want[8] = {
+        (float)0x00FFFFFF / 65536.0f, 256.0f,
+        (float)0x01000004 / 65536.0f, -(float)0x01000004 / 65536.0f,
+        32768.0f, -32768.0f, 1.0f / 65536.0f, -1.0f / 65536.0f
+    };
+
+    int32_t in[CONV_N];
+    float out[CONV_N];
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        in[i] = x[i % 8];
+    }
+    ct_dispatch_get()->to_f32(in, out, CONV_N);
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        if (memcmp(&out[i], &want[i % 8], sizeof(float)) != 0) return 0;
+    }
+    return 1;
+}
+
+static int test_export_bf16_rounding(void)
+{
+    /* 0x0102FFFF rounds down when rounded once; via binary32 it would tie
+     * and round up to 0x4382 */
+    static const int32_t x[8] = {
+        FIXED_ONE, -FIXED_ONE, 0x181, 0x183,
+        0x0102FFFF, INT32_MAX, INT32_MIN, 0
+    };
+    static const uint16_t want[8] = {
+        0x3F80, 0xBF80, 0x3BC0, 0x3BC2,
+        0x4381, 0x4700, 0xC700, 0x0000
+    };
+
+    int32_t in[CONV_N];
+    uint16_t out[CONV_N];
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        in[i] = x[i % 8];
+    }
+    ct_dispatch_get()->to_bf16(in, out, CONV_N);
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        if (out[i] != want[i % 8]) return 0;
+    }
+
+    /* Batch export carries the bfloat16 dtype */
+    ct_sample_t samples[EXP_B];
+    ct_hash_t hashes[EXP_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, EXP_B);
+    ct_batch_fill(&batch, &g_dataset, 0, 0, 42);
+    uint16_t buf[EXP_B * EXP_H * EXP_W];
+    ct_batch_export_t e;
+    if (ct_batch_export_bf16(&batch, buf, EXP_B * EXP_H * EXP_W, &e, NULL, NULL) != 0) return 0;
+    return e.managed.dl_tensor.dtype.code == CT_DL_CODE_BFLOAT &&
+           e.managed.dl_tensor.dtype.bits == 16;
+}
+
+static int test_export_f64_exact(void)
+{
+    int32_t in[CONV_N];
+    double out[CONV_N];
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        in[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+    }
+    in[0] = INT32_MIN;
+    in[1] = INT32_MAX;
+    ct_dispatch_get()->to_f64(in, out, CONV_N);
+    for (uint32_t i = 0; i < CONV_N; i++) {
+        /* Exact: scaling back recovers the integer */
+        if (out[i] * 65536.0 != (double)in[i]) return 0;
+    }
+
+    ct_sample_t samples[EXP_B];
+    ct_hash_t hashes[EXP_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, EXP_B);
+    ct_batch_fill(&batch, &g_dataset, 1, 0, 42);
+    double buf[EXP_B * EXP_H * EXP_W];
+    ct_batch_export_t e;
+    if (ct_batch_export_f64(&batch, buf, EXP_B * EXP_H * EXP_W, &e, NULL, NULL) != 0) return 0;
+    return e.managed.dl_tensor.dtype.code == CT_DL_CODE_FLOAT &&
+           e.managed.dl_tensor.dtype.bits == 64 &&
+           buf[EXP_H * EXP_W + 1] * 65536.0 == (double)samples[1].data[1];
+}
+
+/* ============================================================================
+ * Test: Shared-Memory Views
+ * ============================================================================ */
+
+static void release_slot(void *ctx)
+{
+    ct_shm_client_release((ct_shm_client_t *)ctx);
+}
+
+static int publish(ct_shm_server_t *server, uint32_t b)
+{
+    ct_sample_t samples[EXP_B];
+    ct_hash_t hashes[EXP_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, EXP_B);
+    ct_batch_fill(&batch, &g_dataset, b, 0, 42);
+    return ct_shm_server_publish(server, &batch, 0);
+}
+
+static int test_export_ring_view_tied_to_slot(void)
+{
+    char name[CT_SHM_NAME_MAX];
+    snprintf(name, sizeof(name), "/ct_test_export_%ld", (long)getpid());
+
+    ct_shm_params_t p;
+    memset(&p, 0, sizeof(p));
+    p.slot_count = 1;
+    p.batch_size = EXP_B;
+    p.max_elements = 8;   /* Wider than a sample: stride exceeds the shape */
+
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&client, name);
+
+    ct_sample_t view_samples[EXP_B];
+    ct_batch_t view;
+    ct_batch_export_t e;
+    int ok = publish(&server, 0) == CT_SHM_OK &&
+             ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_OK &&
+             ct_batch_export_dlpack(&view, &e, release_slot, &client) == 0;
+
+    const ct_dl_tensor_t *t = &e.managed.dl_tensor;
+    ok = ok && t->strides[0] == 8 && t->shape[0] == EXP_B &&
+         at(t, 3, 1, 2) == view_samples[3].data[1 * EXP_W + 2];
+
+    /* The single slot stays held until the consumer drops the tensor */
+    ok = ok && publish(&server, 1) == CT_SHM_AGAIN;
+    if (ok) {
+        e.managed.deleter(&e.managed);
+    }
+    ok = ok && publish(&server, 1) == CT_SHM_OK;
+
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Batch Export Tests\n");
+    printf("Traceability: CT-MATH-001 §3.11, CT-STRUCT-001 §22\n");
+    printf("==============================================\n\n");
+
+    setup();
+
+    printf("ABI:\n");
+    RUN_TEST(test_dlpack_layout);
+
+    printf("\nExport:\n");
+    RUN_TEST(test_export_packed_batch);
+    RUN_TEST(test_export_partial_batch);
+    RUN_TEST(test_export_rejects_scattered_and_mixed);
+
+    printf("\nConverting export:\n");
+    RUN_TEST(test_export_f32_any_layout);
+    RUN_TEST(test_export_f32_rounding);
+    RUN_TEST(test_export_bf16_rounding);
+    RUN_TEST(test_export_f64_exact);
+
+    printf("\nShared-memory views:\n");
+    RUN_TEST(test_export_ring_view_tied_to_slot);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+/**
+ * @file test_layout.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for tensor layout conversion
+ *
+ * @traceability CT-STRUCT-001 §23
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ct_types.h"
+#include "batch.h"
+#include "loader.h"
+#include "export.h"
+#include "layout.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define LAY_N  10
+#define LAY_B  4
+#define LAY_H  4
+#define LAY_W  5
+#define LAY_C  3
+#define LAY_SIZE  (LAY_H * LAY_W * LAY_C)
+
+/* Element value names its (sample, h, w, c) coordinate */
+static int32_t code(uint32_t n, uint32_t h, uint32_t w, uint32_t c)
+{
+    return (int32_t)((n * 1000U + h * 100U + w * 10U + c) << 8);
+}
+
+static int32_t g_data[LAY_N][LAY_SIZE];
+static ct_sample_t g_samples[LAY_N];
+static ct_dataset_t g_dataset;
+
+/* Dataset of HWC samples */
+static void setup(void)
+{
+    for (uint32_t n = 0; n < LAY_N; n++) {
+        for (uint32_t h = 0; h < LAY_H; h++) {
+            for (uint32_t w = 0; w < LAY_W; w++) {
+                for (uint32_t c = 0; c < LAY_C; c++) {
+                    g_data[n][(h * LAY_W + w) * LAY_C + c] = code(n, h, w, c);
+                }
+            }
+        }
+        g_samples[n] = (ct_sample_t){ .version = 1, .ndims = 3, .dims = {LAY_H, LAY_W, LAY_C, 0},
+                                      .total_elements = LAY_SIZE, .data = g_data[n] };
+    }
+    ct_dataset_init(&g_dataset, g_samples, LAY_N);
+}
+
+/* Sample n of the dataset in CHW order, as the reference */
+static int chw_matches(const int32_t *v, uint32_t n)
+{
+    for (uint32_t c = 0; c < LAY_C; c++) {
+        for (uint32_t h = 0; h < LAY_H; h++) {
+            for (uint32_t w = 0; w < LAY_W; w++) {
+                if (v[(c * LAY_H + h) * LAY_W + w] != code(n, h, w, c)) return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Sample Conversion
+ * ============================================================================ */
+
+static int test_hwc_to_chw(void)
+{
+    int32_t out_data[LAY_SIZE];
+    ct_sample_t out = { 0, 0, 0, { 0 }, 0, out_data };
+    if (ct_layout_sample(&g_samples[7], CT_LAYOUT_HWC, CT_LAYOUT_CHW, &out) != 0) return 0;
+
+    if (out.ndims != 3 || out.total_elements != LAY_SIZE || out.version != 1) return 0;
+    if (out.dims[0] != LAY_C || out.dims[1] != LAY_H || out.dims[2] != LAY_W) return 0;
+    return out.data == out_data && chw_matches(out_data, 7);
+}
+
+/* 224×224×3 plus shapes that leave ragged edges on every tile width */
+#define RT_MAX  (224 * 224 * 3)
+static int32_t g_rt_src[RT_MAX];
+static int32_t g_rt_mid[RT_MAX];
+static int32_t g_rt_back[RT_MAX];
+
+static int test_roundtrip_shapes(void)
+{
+    static const uint32_t SHAPES[6][3] = {
+        { 1, 1, 1 }, { 3, 17, 19 }, { 8, 8, 8 }, { 5, 1, 70 }, { 65, 9, 7 }, { 224, 224, 3 }
+    };
+
+    for (uint32_t k = 0; k < 6; k++) {
+        uint32_t H = SHAPES[k][0];
+        uint32_t W = SHAPES[k][1];
+        uint32_t C = SHAPES[k][2];
+        uint32_t total = H * W * C;
+        for (uint32_t i = 0; i < total; i++) {
+            g_rt_src[i] = (int32_t)(0x9E3779B9U * (i + 1U));
+        }
+
+        ct_sample_t hwc = { 1, CT_DTYPE_Q16_16, 3, { H, W, C }, total, g_rt_src };
+        ct_sample_t chw = { 0, 0, 0, { 0 }, 0, g_rt_mid };
+        ct_sample_t back = { 0, 0, 0, { 0 }, 0, g_rt_back };
+        if (ct_layout_sample(&hwc, CT_LAYOUT_HWC, CT_LAYOUT_CHW, &chw) != 0) return 0;
+
+        for (uint32_t p = 0; p < H * W; p++) {
+            for (uint32_t c = 0; c < C; c++) {
+                if (g_rt_mid[c * H * W + p] != g_rt_src[p * C + c]) return 0;
+            }
+        }
+
+        if (ct_layout_sample(&chw, CT_LAYOUT_CHW, CT_LAYOUT_HWC, &back) != 0) return 0;
+        if (back.dims[0] != H || back.dims[1] != W || back.dims[2] != C) return 0;
+        if (memcmp(g_rt_back, g_rt_src, total * sizeof(int32_t)) != 0) return 0;
+    }
+    return 1;
+}
+
+static int test_rejects_and_copies(void)
+{
+    int32_t out_data[LAY_SIZE];
+    ct_sample_t out = { 0, 0, 0, { 0 }, 0, out_data };
+    ct_sample_t s = g_samples[0];
+
+    /* Same layout: plain copy */
+    if (ct_layout_sample(&s, CT_LAYOUT_HWC, CT_LAYOUT_HWC, &out) != 0) return 0;
+    if (memcmp(out_data, g_data[0], sizeof(out_data)) != 0 || out.dims[2] != LAY_C) return 0;
+
+    memset(&out, 0, sizeof(out));
+    out.data = out_data;
+    if (ct_layout_sample(&s, CT_LAYOUT_HWC, (ct_layout_t)7, &out) != -1) return 0;
+    s.dtype = CT_DTYPE_Q8_8;
+    if (ct_layout_sample(&s, CT_LAYOUT_HWC, CT_LAYOUT_CHW, &out) != -1) return 0;
+    s = g_samples[0];
+    s.ndims = 2;
+    if (ct_layout_sample(&s, CT_LAYOUT_HWC, CT_LAYOUT_CHW, &out) != -1) return 0;
+    s = g_samples[0];
+    s.total_elements = LAY_SIZE - 1;
+    if (ct_layout_sample(&s, CT_LAYOUT_HWC, CT_LAYOUT_CHW, &out) != -1) return 0;
+
+    return out.ndims == 0 && out.data == out_data;
+}
+
+/* ============================================================================
+ * Test: Batch Packing
+ * ============================================================================ */
+
+static int test_batch_pack_nchw(void)
+{
+    ct_sample_t samples[LAY_B];
+    ct_hash_t hashes[LAY_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, LAY_B);
+    ct_batch_fill(&batch, &g_dataset, 0, 0, 42);
+
+    /* Too small: nothing moves */
+    int32_t buf[LAY_B * LAY_SIZE];
+    if (ct_batch_pack_layout(&batch, buf, LAY_B * LAY_SIZE - 1,
+                             CT_LAYOUT_HWC, CT_LAYOUT_CHW) != -1) return 0;
+    for (uint32_t i = 0; i < LAY_B; i++) {
+        if (samples[i].dims[0] != LAY_H || samples[i].data == &buf[i * LAY_SIZE]) return 0;
+    }
+
+    if (ct_batch_pack_layout(&batch, buf, LAY_B * LAY_SIZE,
+                             CT_LAYOUT_HWC, CT_LAYOUT_CHW) != 0) return 0;
+    for (uint32_t i = 0; i < LAY_B; i++) {
+        uint32_t n = (uint32_t)(((const int32_t *)samples[i].data)[0] >> 8) / 1000U;
+        if (samples[i].data != &buf[i * LAY_SIZE] || samples[i].dims[0] != LAY_C) return 0;
+        if (!chw_matches(samples[i].data, n)) return 0;
+    }
+
+    /* Commitment untouched; the packed batch exports as NCHW */
+    ct_batch_export_t e;
+    if (!ct_batch_verify(&batch)) return 0;
+    if (ct_batch_export_dlpack(&batch, &e, NULL, NULL) != 0) return 0;
+    const int64_t *shape = e.managed.dl_tensor.shape;
+    return shape[0] == LAY_B && shape[1] == LAY_C && shape[2] == LAY_H && shape[3] == LAY_W;
+}
+
+static int test_batch_pack_partial(void)
+{
+    ct_sample_t samples[LAY_B];
+    ct_hash_t hashes[LAY_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, LAY_B);
+    ct_batch_fill(&batch, &g_dataset, 2, 0, 42);
+
+    /* Padding takes no space and stays empty */
+    int32_t buf[2 * LAY_SIZE];
+    if (ct_batch_pack_layout(&batch, buf, 2 * LAY_SIZE, CT_LAYOUT_HWC, CT_LAYOUT_CHW) != 0) {
+        return 0;
+    }
+    return samples[1].data == &buf[LAY_SIZE] &&
+           samples[2].total_elements == 0 && samples[2].data == NULL &&
+           samples[3].total_elements == 0;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Layout Conversion Tests\n");
+    printf("Traceability: CT-STRUCT-001 §23\n");
+    printf("==============================================\n\n");
+
+    setup();
+
+    printf("Sample conversion:\n");
+    RUN_TEST(test_hwc_to_chw);
+    RUN_TEST(test_roundtrip_shapes);
+    RUN_TEST(test_rejects_and_copies);
+
+    printf("\nBatch packing:\n");
+    RUN_TEST(test_batch_pack_nchw);
+    RUN_TEST(test_batch_pack_partial);
+
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -3,7 +3,7 @@
  * @project Certifiable Data Pipeline
  * @brief Unit tests for Merkle trees and provenance
  *
- * @traceability SRS-006-MERKLE, CT-MATH-001 §10
+ * @traceability SRS-006-MERKLE, CT-MATH-001 §10, §10.9, §10.10
  *
  * @author William Murray
  * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
@@ -14,6 +14,7 @@
 #include <string.h>
 #include "ct_types.h"
 #include "merkle.h"
+#include "shuffle.h"
 
 static int tests_run = 0;
 static int tests_passed = 0;
@@ -246,6 +247,320 @@ static int test_merkle_root_odd_count(void)
     return 1;
 }
 
+static void levelwise_root(ct_hash_t *nodes, uint32_t count, ct_hash_t out)
+{
+    /* Level-by-level definition: pair neighbours, promote an odd last node */
+    while (count > 1) {
+        uint32_t next = (count + 1) / 2;
+        for (uint32_t i = 0; i < next; i++) {
+            if (2 * i + 1 < count) {
+                ct_hash_internal(nodes[2 * i], nodes[2 * i + 1], nodes[i]);
+            } else {
+                memcpy(nodes[i], nodes[2 * i], 32);
+            }
+        }
+        count = next;
+    }
+    memcpy(out, nodes[0], 32);
+}
+
+static int test_merkle_root_matches_levelwise(void)
+{
+    static ct_hash_t leaves[1500];
+    static ct_hash_t scratch[1500];
+    for (uint32_t i = 0; i < 1500; i++) {
+        memset(leaves[i], (int)(i & 0xFF), 32);
+        leaves[i][0] = (uint8_t)(i >> 8);
+    }
+
+    /* Every size up to 70, and sizes past the old 1024-leaf limit */
+    static const uint32_t big[] = { 127, 128, 129, 1024, 1025, 1500 };
+    for (uint32_t k = 1; k <= 70 + 6; k++) {
+        uint32_t n = (k <= 70) ? k : big[k - 71];
+        ct_hash_t expected, actual;
+        memcpy(scratch, leaves, n * sizeof(ct_hash_t));
+        levelwise_root(scratch, n, expected);
+        ct_merkle_root((const ct_hash_t *)leaves, n, actual);
+        if (memcmp(expected, actual, 32) != 0) return 0;
+    }
+    return 1;
+}
+
+static int test_merkle_acc_prefix_roots(void)
+{
+    /* Finishing mid-stream gives the root of the prefix, and may continue */
+    ct_hash_t leaves[13];
+    for (uint32_t i = 0; i < 13; i++) {
+        memset(leaves[i], (int)(i * 17U + 3U), 32);
+    }
+
+    ct_merkle_acc_t acc;
+    ct_merkle_acc_init(&acc);
+    for (uint32_t n = 1; n <= 13; n++) {
+        ct_hash_t expected, actual;
+        ct_merkle_acc_push(&acc, leaves[n - 1]);
+        ct_merkle_acc_finish(&acc, actual);
+        ct_merkle_root((const ct_hash_t *)leaves, n, expected);
+        if (memcmp(expected, actual, 32) != 0) return 0;
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Retained Tree
+ * ============================================================================ */
+
+#define TREE_MAX 1500U
+
+static ct_hash_t g_tree_leaves[TREE_MAX + 8];
+static ct_hash_t g_nodes_a[CT_MERKLE_TREE_NODES(TREE_MAX + 8)];
+static ct_hash_t g_nodes_b[CT_MERKLE_TREE_NODES(TREE_MAX + 8)];
+
+static void tree_leaves(ct_hash_t *leaves, uint32_t n, uint32_t salt)
+{
+    for (uint32_t i = 0; i < n; i++) {
+        memset(leaves[i], (int)((i * 31U + salt) & 0xFF), 32);
+        leaves[i][0] = (uint8_t)(i >> 8);
+        leaves[i][1] = (uint8_t)i;
+    }
+}
+
+static int test_merkle_tree_matches_root(void)
+{
+    tree_leaves(g_tree_leaves, TREE_MAX, 0);
+    static const uint32_t big[] = { 127, 128, 129, 1024, 1025, 1500 };
+    for (uint32_t k = 1; k <= 70 + 6; k++) {
+        uint32_t n = (k <= 70) ? k : big[k - 71];
+        ct_merkle_tree_t tree;
+        ct_hash_t expected, actual;
+        if (ct_merkle_tree_build(&tree, (const ct_hash_t *)g_tree_leaves, n, g_nodes_a) != 0) return 0;
+        ct_merkle_root((const ct_hash_t *)g_tree_leaves, n, expected);
+        ct_merkle_tree_root(&tree, actual);
+        if (memcmp(expected, actual, 32) != 0) return 0;
+        if (memcmp(g_nodes_a[0], g_tree_leaves[0], 32) != 0) return 0;
+    }
+
+    ct_merkle_tree_t empty;
+    empty.num_leaves = 7;
+    return ct_merkle_tree_build(&empty, (const ct_hash_t *)g_tree_leaves, 0, g_nodes_a) == -1 &&
+           empty.num_leaves == 7;
+}
+
+static int test_merkle_tree_update(void)
+{
+    /* Every leaf of an odd-sized tree, including the promoted last one */
+    static const uint32_t sizes[] = { 1, 2, 5, 77 };
+    for (uint32_t c = 0; c < 4; c++) {
+        uint32_t n = sizes[c];
+        tree_leaves(g_tree_leaves, n, 0);
+        ct_merkle_tree_t tree;
+        if (ct_merkle_tree_build(&tree, (const ct_hash_t *)g_tree_leaves, n, g_nodes_a) != 0) return 0;
+        for (uint32_t i = 0; i < n; i++) {
+            ct_hash_t leaf, expected, actual;
+            memset(leaf, (int)(0xA0U + i), 32);
+            if (ct_merkle_tree_update(&tree, i, leaf) != 0) return 0;
+            memcpy(g_tree_leaves[i], leaf, 32);
+            ct_merkle_root((const ct_hash_t *)g_tree_leaves, n, expected);
+            ct_merkle_tree_root(&tree, actual);
+            if (memcmp(expected, actual, 32) != 0) return 0;
+        }
+        if (ct_merkle_tree_update(&tree, n, g_tree_leaves[0]) != -1) return 0;
+    }
+    return 1;
+}
+
+/* Changed leaves found by the diff, against a leaf-by-leaf comparison */
+static int diff_matches(uint32_t na, uint32_t nb, const uint32_t *changes, uint32_t num_changes)
+{
+    static ct_hash_t leaves_b[TREE_MAX + 8];
+    tree_leaves(g_tree_leaves, na, 0);
+    tree_leaves(leaves_b, nb, 0);
+    for (uint32_t c = 0; c < num_changes; c++) {
+        leaves_b[changes[c]][31] ^= 0x5A;
+    }
+
+    ct_merkle_tree_t a, b;
+    if (ct_merkle_tree_build(&a, (const ct_hash_t *)g_tree_leaves, na, g_nodes_a) != 0) return 0;
+    if (ct_merkle_tree_build(&b, (const ct_hash_t *)leaves_b, nb, g_nodes_b) != 0) return 0;
+
+    uint32_t out[TREE_MAX + 8];
+    uint32_t found = ct_merkle_diff(&a, &b, out, TREE_MAX + 8);
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < ((na > nb) ? na : nb); i++) {
+        if (i >= na || i >= nb || memcmp(g_tree_leaves[i], leaves_b[i], 32) != 0) {
+            if (expected >= found || out[expected] != i) return 0;
+            expected++;
+        }
+    }
+    return found == expected;
+}
+
+static int test_merkle_diff(void)
+{
+    static const uint32_t few[] = { 0, 3, 4, 200, 1023, 1024, 1499 };
+    static const uint32_t last[] = { 76 };
+    if (!diff_matches(TREE_MAX, TREE_MAX, few, 0)) return 0;
+    if (!diff_matches(TREE_MAX, TREE_MAX, few, 7)) return 0;
+    if (!diff_matches(77, 77, last, 1)) return 0;
+    if (!diff_matches(1, 1, few, 1)) return 0;
+
+    /* Appended and removed samples, alone and with edits */
+    if (!diff_matches(1024, 1025, few, 0)) return 0;
+    if (!diff_matches(1025, 1024, few, 0)) return 0;
+    if (!diff_matches(1024, TREE_MAX, few, 5)) return 0;
+    if (!diff_matches(TREE_MAX, 129, few, 4)) return 0;
+    if (!diff_matches(1, 70, few, 1)) return 0;
+    if (!diff_matches(70, 1, few, 1)) return 0;
+
+    /* Only max_out written; the count is still exact */
+    uint32_t out[2] = { 0, 0 };
+    ct_merkle_tree_t a, b;
+    tree_leaves(g_tree_leaves, 10, 0);
+    if (ct_merkle_tree_build(&a, (const ct_hash_t *)g_tree_leaves, 10, g_nodes_a) != 0) return 0;
+    tree_leaves(g_tree_leaves, 10, 1);
+    if (ct_merkle_tree_build(&b, (const ct_hash_t *)g_tree_leaves, 10, g_nodes_b) != 0) return 0;
+    return ct_merkle_diff(&a, &b, out, 2) == 10 && out[0] == 0 && out[1] == 1 &&
+           ct_merkle_diff(&a, &a, NULL, 0) == 0;
+}
+
+/* ============================================================================
+ * Test: Divergence Bisection
+ * ============================================================================ */
+
+/* First divergent leaf against a leaf-by-leaf scan */
+static int first_diff_matches(uint32_t na, uint32_t nb, const uint32_t *changes, uint32_t num_changes)
+{
+    static ct_hash_t leaves_b[TREE_MAX + 8];
+    tree_leaves(g_tree_leaves, na, 0);
+    tree_leaves(leaves_b, nb, 0);
+    for (uint32_t c = 0; c < num_changes; c++) {
+        leaves_b[changes[c]][31] ^= 0x5A;
+    }
+
+    ct_merkle_tree_t a, b;
+    if (ct_merkle_tree_build(&a, (const ct_hash_t *)g_tree_leaves, na, g_nodes_a) != 0) return 0;
+    if (ct_merkle_tree_build(&b, (const ct_hash_t *)leaves_b, nb, g_nodes_b) != 0) return 0;
+
+    uint32_t n = (na > nb) ? na : nb;
+    uint32_t expected = 0;
+    while (expected < n && expected < na && expected < nb &&
+           memcmp(g_tree_leaves[expected], leaves_b[expected], 32) == 0) {
+        expected++;
+    }
+    return ct_merkle_first_diff(&a, &b) == expected && ct_merkle_first_diff(&b, &a) == expected;
+}
+
+static int test_merkle_first_diff(void)
+{
+    static const uint32_t one[][1] = { {0}, {1}, {511}, {512}, {1023}, {1499} };
+    for (uint32_t c = 0; c < 6; c++) {
+        if (!first_diff_matches(TREE_MAX, TREE_MAX, one[c], 1)) return 0;
+    }
+    static const uint32_t many[] = { 1400, 700, 701, 3 };
+    if (!first_diff_matches(TREE_MAX, TREE_MAX, many, 4)) return 0;
+    if (!first_diff_matches(TREE_MAX, TREE_MAX, many, 0)) return 0;
+    if (!first_diff_matches(77, 77, (const uint32_t[]){ 76 }, 1)) return 0;
+    if (!first_diff_matches(1, 1, one[0], 1)) return 0;
+    if (!first_diff_matches(1, 1, one[0], 0)) return 0;
+
+    /* A run that stopped early diverges where it stopped */
+    if (!first_diff_matches(1024, 1025, many, 0)) return 0;
+    if (!first_diff_matches(1000, TREE_MAX, many, 0)) return 0;
+    if (!first_diff_matches(1, 70, many, 0)) return 0;
+    return first_diff_matches(1000, TREE_MAX, many, 3);
+}
+
+static int test_provenance_first_diff(void)
+{
+    enum { EPOCHS = 40 };
+    ct_hash_t dataset_hash = {0x01};
+    ct_hash_t config_hash = {0x02};
+    static ct_hash_t heads_a[EPOCHS + 1];
+    static ct_hash_t heads_b[EPOCHS + 1];
+
+    for (uint32_t diverge = 0; diverge <= EPOCHS + 1U; diverge++) {
+        ct_provenance_t a, b;
+        ct_provenance_init(&a, dataset_hash, config_hash, 42);
+        ct_provenance_init(&b, dataset_hash, config_hash, (diverge == 0) ? 43 : 42);
+        memcpy(heads_a[0], a.current_hash, 32);
+        memcpy(heads_b[0], b.current_hash, 32);
+        for (uint32_t e = 0; e < EPOCHS; e++) {
+            ct_hash_t epoch_a = {(uint8_t)e};
+            ct_hash_t epoch_b = {(uint8_t)e};
+            if (e + 1U == diverge) {
+                epoch_b[31] = 1;
+            }
+            ct_provenance_advance(&a, epoch_a);
+            ct_provenance_advance(&b, epoch_b);
+            memcpy(heads_a[e + 1U], a.current_hash, 32);
+            memcpy(heads_b[e + 1U], b.current_hash, 32);
+        }
+        uint32_t expected = (diverge <= EPOCHS) ? diverge : EPOCHS + 1U;
+        if (ct_provenance_first_diff((const ct_hash_t *)heads_a, (const ct_hash_t *)heads_b,
+                                     EPOCHS + 1) != expected) return 0;
+    }
+    return ct_provenance_first_diff((const ct_hash_t *)heads_a, (const ct_hash_t *)heads_b, 0) == 0;
+}
+
+/* Two runs differing in one sample: chain, then epoch tree, then batch tree */
+static int test_bisect_runs(void)
+{
+    enum { EPOCHS = 12, BATCHES = 37, SLOTS = 20 };
+    static ct_hash_t leaves[2][BATCHES][SLOTS];
+    static ct_hash_t batches[2][BATCHES];
+    static ct_hash_t heads[2][EPOCHS + 1];
+    static ct_hash_t epoch_nodes[2][CT_MERKLE_TREE_NODES(BATCHES)];
+    static ct_hash_t batch_nodes[2][CT_MERKLE_TREE_NODES(SLOTS)];
+    const uint32_t bad_epoch = 7, bad_batch = 29, bad_slot = 13;
+    ct_hash_t dataset_hash = {0x01};
+    ct_hash_t config_hash = {0x02};
+
+    /* Each run keeps only its chain heads; one epoch is replayed below */
+    for (uint32_t r = 0; r < 2; r++) {
+        ct_provenance_t prov;
+        ct_provenance_init(&prov, dataset_hash, config_hash, 42);
+        memcpy(heads[r][0], prov.current_hash, 32);
+        for (uint32_t e = 0; e < EPOCHS; e++) {
+            for (uint32_t t = 0; t < BATCHES; t++) {
+                tree_leaves(leaves[r][t], SLOTS, e * BATCHES + t);
+                if (r == 1 && e == bad_epoch && t == bad_batch) {
+                    leaves[r][t][bad_slot][31] ^= 1;
+                }
+                ct_merkle_root((const ct_hash_t *)leaves[r][t], SLOTS, batches[r][t]);
+            }
+            ct_hash_t epoch_hash;
+            ct_hash_epoch((const ct_hash_t *)batches[r], BATCHES, epoch_hash);
+            ct_provenance_advance(&prov, epoch_hash);
+            memcpy(heads[r][e + 1U], prov.current_hash, 32);
+        }
+    }
+    uint32_t head = ct_provenance_first_diff((const ct_hash_t *)heads[0],
+                                             (const ct_hash_t *)heads[1], EPOCHS + 1);
+    if (head != bad_epoch + 1U) return 0;
+
+    /* Replay the divergent epoch in both runs, retaining its trees */
+    ct_merkle_tree_t epoch_tree[2], batch_tree[2];
+    for (uint32_t r = 0; r < 2; r++) {
+        for (uint32_t t = 0; t < BATCHES; t++) {
+            tree_leaves(leaves[r][t], SLOTS, (head - 1U) * BATCHES + t);
+            if (r == 1 && t == bad_batch) {
+                leaves[r][t][bad_slot][31] ^= 1;
+            }
+            ct_merkle_root((const ct_hash_t *)leaves[r][t], SLOTS, batches[r][t]);
+        }
+        if (ct_merkle_tree_build(&epoch_tree[r], (const ct_hash_t *)batches[r], BATCHES,
+                                 epoch_nodes[r]) != 0) return 0;
+    }
+    uint32_t batch = ct_merkle_first_diff(&epoch_tree[0], &epoch_tree[1]);
+    if (batch != bad_batch) return 0;
+
+    for (uint32_t r = 0; r < 2; r++) {
+        if (ct_merkle_tree_build(&batch_tree[r], (const ct_hash_t *)leaves[r][batch], SLOTS,
+                                 batch_nodes[r]) != 0) return 0;
+    }
+    return ct_merkle_first_diff(&batch_tree[0], &batch_tree[1]) == bad_slot;
+}
+
 /* ============================================================================
  * Test: Batch Hashing
  * ============================================================================ */
@@ -454,6 +769,180 @@ static int test_provenance_multiple_epochs(void)
     return 1;
 }
 
+/* ============================================================================
+ * Test: Configuration Hashing (CT-MATH-001 §11.4)
+ * ============================================================================ */
+
+static int test_hash_config_binds_hash_mode(void)
+{
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = NULL,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT };
+    ct_hash_t content, content2, reference;
+    ct_hash_config(&config, content);
+    ct_hash_config(&config, content2);
+    config.batch_hash_mode = CT_BATCH_HASH_REFERENCE;
+    ct_hash_config(&config, reference);
+
+    return memcmp(content, content2, 32) == 0 && memcmp(content, reference, 32) != 0;
+}
+
+static int test_hash_config_sensitive_to_fields(void)
+{
+    int32_t means[2] = {0, FIXED_ONE};
+    int32_t inv_stds[2] = {FIXED_ONE, FIXED_HALF};
+    ct_normalize_ctx_t norm = { .means = means, .inv_stds = inv_stds, .num_features = 2, .unchecked = 0 };
+    ct_augment_ctx_t aug;
+    memset(&aug, 0, sizeof(aug));
+    aug.flags.h_flip = 1;
+
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = &aug,
+                           .normalize = &norm, .batch_hash_mode = CT_BATCH_HASH_CONTENT };
+    ct_hash_t base, h;
+    ct_hash_config(&config, base);
+
+    config.seed = 0x1235;
+    ct_hash_config(&config, h);
+    if (memcmp(base, h, 32) == 0) return 0;
+    config.seed = 0x1234;
+
+    aug.flags.gaussian_noise = 1;
+    ct_hash_config(&config, h);
+    if (memcmp(base, h, 32) == 0) return 0;
+    aug.flags.gaussian_noise = 0;
+
+    inv_stds[1] = FIXED_ONE;
+    ct_hash_config(&config, h);
+    if (memcmp(base, h, 32) == 0) return 0;
+    inv_stds[1] = FIXED_HALF;
+
+    ct_hash_config(&config, h);
+    return memcmp(base, h, 32) == 0;
+}
+
+static int test_hash_config_binds_geometry(void)
+{
+    ct_augment_ctx_t aug;
+    memset(&aug, 0, sizeof(aug));
+    aug.flags.h_flip = 1;
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = &aug,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT };
+    ct_hash_t base, h, resized;
+    ct_hash_config(&config, base);
+
+    /* Geometry parameters only count once a geometry flag is set */
+    aug.resize_width = 224;
+    ct_hash_config(&config, h);
+    if (memcmp(base, h, 32) != 0) return 0;
+
+    aug.flags.resize = 1;
+    ct_hash_config(&config, resized);
+    if (memcmp(base, resized, 32) == 0) return 0;
+    aug.resize_width = 256;
+    ct_hash_config(&config, h);
+    if (memcmp(resized, h, 32) == 0) return 0;
+
+    aug.flags.resize = 0;
+    aug.flags.affine = 1;
+    ct_hash_config(&config, h);
+    return memcmp(resized, h, 32) != 0 && memcmp(base, h, 32) != 0;
+}
+
+static int test_hash_config_binds_mixing(void)
+{
+    ct_augment_ctx_t aug;
+    memset(&aug, 0, sizeof(aug));
+    aug.flags.cutout = 1;
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = &aug,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT };
+    ct_hash_t base, h, mixup;
+    ct_hash_config(&config, base);
+
+    /* The λ range only counts once mixup or cutmix is set */
+    aug.mix_lambda_max = FIXED_ONE;
+    ct_hash_config(&config, h);
+    if (memcmp(base, h, 32) != 0) return 0;
+
+    aug.flags.mixup = 1;
+    ct_hash_config(&config, mixup);
+    if (memcmp(base, mixup, 32) == 0) return 0;
+    aug.mix_lambda_min = FIXED_HALF;
+    ct_hash_config(&config, h);
+    if (memcmp(mixup, h, 32) == 0) return 0;
+
+    aug.mix_lambda_min = 0;
+    aug.flags.mixup = 0;
+    aug.flags.cutmix = 1;
+    ct_hash_config(&config, h);
+    return memcmp(mixup, h, 32) != 0 && memcmp(base, h, 32) != 0;
+}
+
+static int test_hash_config_binds_sampler(void)
+{
+    static const uint32_t weights[4] = { 1, 2, 3, 4 };
+    uint32_t prob[4], alias[4], work[4];
+    ct_alias_table_t sampler;
+    if (ct_alias_build(&sampler, weights, 4, prob, alias, work) != 0) return 0;
+
+    /* With and without an augmentation context */
+    ct_augment_ctx_t aug;
+    memset(&aug, 0, sizeof(aug));
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = NULL,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT,
+                           .sampler = NULL };
+    for (int pass = 0; pass < 2; pass++) {
+        ct_hash_t uniform, weighted, h;
+        config.sampler = NULL;
+        ct_hash_config(&config, uniform);
+        config.sampler = &sampler;
+        ct_hash_config(&config, weighted);
+        if (memcmp(uniform, weighted, 32) == 0) return 0;
+
+        sampler.table_hash[0] ^= 1;
+        ct_hash_config(&config, h);
+        sampler.table_hash[0] ^= 1;
+        if (memcmp(weighted, h, 32) == 0) return 0;
+        config.augment = &aug;
+    }
+    return 1;
+}
+
+static int test_hash_config_binds_strata(void)
+{
+    static const uint32_t labels[6] = { 0, 1, 1, 0, 1, 0 };
+    static const uint32_t quota[2] = { 1, 1 };
+    uint32_t offsets[3], members[6], slots[2], work[2];
+    ct_strata_t strata;
+    if (ct_strata_build(&strata, labels, 6, quota, 2, offsets, members, slots, work) != 0) return 0;
+
+    ct_config_t config = { .batch_size = 2, .seed = 0x1234, .augment = NULL,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT,
+                           .sampler = NULL, .strata = NULL };
+    ct_hash_t plain, stratified, h;
+    ct_hash_config(&config, plain);
+    config.strata = &strata;
+    ct_hash_config(&config, stratified);
+    if (memcmp(plain, stratified, 32) == 0) return 0;
+
+    strata.strata_hash[31] ^= 1;
+    ct_hash_config(&config, h);
+    strata.strata_hash[31] ^= 1;
+    return memcmp(stratified, h, 32) != 0;
+}
+
+static int test_hash_config_binds_epoch_samples(void)
+{
+    ct_config_t config = { .batch_size = 32, .seed = 0x1234, .augment = NULL,
+                           .normalize = NULL, .batch_hash_mode = CT_BATCH_HASH_CONTENT,
+                           .sampler = NULL, .strata = NULL, .epoch_samples = 0 };
+    ct_hash_t all, tenth, h;
+    ct_hash_config(&config, all);
+    config.epoch_samples = 6000;
+    ct_hash_config(&config, tenth);
+    config.epoch_samples = 6001;
+    ct_hash_config(&config, h);
+    return memcmp(all, tenth, 32) != 0 && memcmp(tenth, h, 32) != 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -481,6 +970,18 @@ int main(void)
     RUN_TEST(test_merkle_root_deterministic);
     RUN_TEST(test_merkle_root_zero_leaves);
     RUN_TEST(test_merkle_root_odd_count);
+    RUN_TEST(test_merkle_root_matches_levelwise);
+    RUN_TEST(test_merkle_acc_prefix_roots);
+
+    printf("\nRetained tree:\n");
+    RUN_TEST(test_merkle_tree_matches_root);
+    RUN_TEST(test_merkle_tree_update);
+    RUN_TEST(test_merkle_diff);
+
+    printf("\nDivergence bisection:\n");
+    RUN_TEST(test_merkle_first_diff);
+    RUN_TEST(test_provenance_first_diff);
+    RUN_TEST(test_bisect_runs);
     
     printf("\nBatch hashing:\n");
     RUN_TEST(test_hash_batch);
@@ -496,6 +997,15 @@ int main(void)
     RUN_TEST(test_provenance_chain_deterministic);
     RUN_TEST(test_provenance_multiple_epochs);
     
+    printf("\nConfiguration hashing:\n");
+    RUN_TEST(test_hash_config_binds_hash_mode);
+    RUN_TEST(test_hash_config_sensitive_to_fields);
+    RUN_TEST(test_hash_config_binds_geometry);
+    RUN_TEST(test_hash_config_binds_mixing);
+    RUN_TEST(test_hash_config_binds_sampler);
+    RUN_TEST(test_hash_config_binds_strata);
+    RUN_TEST(test_hash_config_binds_epoch_samples);
+    
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
     printf("==============================================\n");
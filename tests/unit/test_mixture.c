@@ -0,0 +1,300 @@
+/**
+ * @file test_mixture.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for weighted mixtures of datasets
+ *
+ * @traceability CT-MATH-001 §7.10, CT-STRUCT-001 §25
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "ct_types.h"
+#include "batch.h"
+#include "loader.h"
+#include "merkle.h"
+#include "mixture.h"
+#include "shuffle.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define MX_S      3
+#define MX_TOTAL  24
+#define MX_M      53
+
+static const uint32_t SIZES[MX_S] = { 7, 12, 5 };
+static const uint32_t WEIGHTS[MX_S] = { 3, 1, 2 };
+
+static int32_t g_data[MX_TOTAL];
+static ct_sample_t g_samples[MX_TOTAL];
+static ct_dataset_t g_datasets[MX_S];
+static uint32_t g_schedule[64];
+static uint32_t g_ranks[64];
+static uint32_t g_work[8];
+
+/* Three datasets whose values name (source, index); each has its root */
+static void setup(void)
+{
+    uint32_t first = 0;
+    for (uint32_t s = 0; s < MX_S; s++) {
+        for (uint32_t i = 0; i < SIZES[s]; i++) {
+            g_data[first + i] = (int32_t)(s * 1000U + i);
+            g_samples[first + i] = (ct_sample_t){ .version = 1, .ndims = 1, .dims = {1, 0, 0, 0},
+                                                  .total_elements = 1, .data = &g_data[first + i] };
+        }
+        ct_dataset_init(&g_datasets[s], &g_samples[first], SIZES[s]);
+
+        ct_hash_t leaves[16];
+        ct_hash_dataset_leaves(&g_datasets[s], leaves);
+        ct_hash_dataset((const ct_hash_t *)leaves, SIZES[s], g_datasets[s].dataset_hash);
+        first += SIZES[s];
+    }
+}
+
+static int build(ct_mixture_t *mixture, const uint32_t *weights, uint32_t epoch_samples)
+{
+    return ct_mixture_build(mixture, g_datasets, weights, MX_S, epoch_samples,
+                            g_schedule, g_ranks, g_work);
+}
+
+/* ============================================================================
+ * Test: Schedule
+ * ============================================================================ */
+
+static int test_build_rejects(void)
+{
+    ct_mixture_t mixture;
+    memset(&mixture, 0, sizeof(mixture));
+    static const uint32_t none[MX_S] = { 0, 0, 0 };
+    static const uint32_t huge[MX_S] = { 0x7FFFFFFFU, 1, 0 };
+    if (ct_mixture_build(&mixture, g_datasets, WEIGHTS, 0, MX_M,
+                         g_schedule, g_ranks, g_work) != -1) return 0;
+    if (build(&mixture, WEIGHTS, 0) != -1) return 0;
+    if (build(&mixture, none, MX_M) != -1) return 0;
+    if (build(&mixture, huge, MX_M) != -1) return 0;
+
+    /* A weighted source must have samples; an unweighted one need not */
+    ct_dataset_t datasets[MX_S] = { g_datasets[0], g_datasets[1], g_datasets[2] };
+    static const uint32_t skip_last[MX_S] = { 1, 1, 0 };
+    datasets[2].num_samples = 0;
+    if (ct_mixture_build(&mixture, datasets, WEIGHTS, MX_S, MX_M,
+                         g_schedule, g_ranks, g_work) != -1) return 0;
+    if (mixture.num_sources != 0) return 0;
+    if (ct_mixture_build(&mixture, datasets, skip_last, MX_S, MX_M,
+                         g_schedule, g_ranks, g_work) != 0) return 0;
+    return mixture.total_weight == 2 && g_schedule[0] == 0 && g_schedule[1] == 1;
+}
+
+/* Every prefix of the cycle holds each source within one slot of its share */
+static int test_schedule_spread(void)
+{
+    static const uint32_t WIDE[MX_S] = { 17, 5, 29 };
+    const uint32_t *cases[2] = { WEIGHTS, WIDE };
+    for (uint32_t k = 0; k < 2; k++) {
+        const uint32_t *weights = cases[k];
+        ct_mixture_t mixture;
+        if (build(&mixture, weights, MX_M) != 0) return 0;
+        uint32_t w = mixture.total_weight;
+
+        uint32_t held[MX_S] = { 0 };
+        for (uint32_t i = 0; i < w; i++) {
+            uint32_t s = g_schedule[i];
+            if (s >= MX_S || g_ranks[i] != held[s]) return 0;
+            held[s]++;
+            for (uint32_t c = 0; c < MX_S; c++) {
+                int64_t ideal = (int64_t)(i + 1U) * weights[c];
+                int64_t have = (int64_t)held[c] * w;
+                if (have - ideal >= (int64_t)w || ideal - have >= (int64_t)w) return 0;
+            }
+        }
+        for (uint32_t c = 0; c < MX_S; c++) {
+            if (held[c] != weights[c]) return 0;
+        }
+    }
+    return 1;
+}
+
+/* ============================================================================
+ * Test: Positions
+ * ============================================================================ */
+
+static uint32_t g_source[MX_M];
+static uint32_t g_index[MX_M];
+
+static int test_range_follows_streams(void)
+{
+    ct_mixture_t mixture;
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    ct_mixture_range(&mixture, 42, 3, 0, MX_M, g_source, g_index);
+
+    /* Sources follow the schedule; each pass over a source visits every
+     * sample once */
+    uint32_t drawn[MX_S] = { 0 };
+    uint32_t seen[MX_S][16];
+    memset(seen, 0, sizeof(seen));
+    for (uint32_t p = 0; p < MX_M; p++) {
+        uint32_t s = g_source[p];
+        if (s != g_schedule[p % mixture.total_weight] || g_index[p] >= SIZES[s]) return 0;
+        uint32_t pass = drawn[s] / SIZES[s];
+        if (seen[s][g_index[p]] != pass) return 0;
+        seen[s][g_index[p]]++;
+        drawn[s]++;
+    }
+
+    /* Random access: any run gives the same positions */
+    for (uint32_t start = 0; start < MX_M; start += 5) {
+        uint32_t source[7];
+        uint32_t index[7];
+        uint32_t len = (MX_M - start < 7U) ? MX_M - start : 7U;
+        ct_mixture_range(&mixture, 42, 3, start, len, source, index);
+        for (uint32_t j = 0; j < len; j++) {
+            if (source[j] != g_source[start + j] || index[j] != g_index[start + j]) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_epochs_and_seeds_differ(void)
+{
+    ct_mixture_t mixture;
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    uint32_t source[MX_M];
+    uint32_t index[MX_M];
+    uint32_t other[MX_M];
+    ct_mixture_range(&mixture, 42, 3, 0, MX_M, source, index);
+
+    ct_mixture_range(&mixture, 42, 4, 0, MX_M, source, other);
+    if (memcmp(index, other, sizeof(index)) == 0) return 0;
+    ct_mixture_range(&mixture, 43, 3, 0, MX_M, source, other);
+    if (memcmp(index, other, sizeof(index)) == 0) return 0;
+    ct_mixture_range(&mixture, 42, 3, 0, MX_M, source, other);
+    return memcmp(index, other, sizeof(index)) == 0;
+}
+
+/* ============================================================================
+ * Test: Batches
+ * ============================================================================ */
+
+#define MX_B  8
+
+static int test_batches_name_sources(void)
+{
+    ct_mixture_t mixture;
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    ct_mixture_range(&mixture, 7, 1, 0, MX_M, g_source, g_index);
+
+    /* 53 positions: six full batches and one of five */
+    ct_sample_t samples[MX_B];
+    ct_hash_t hashes[MX_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, MX_B);
+    for (uint32_t b = 0; b < 7; b++) {
+        if (ct_batch_fill_mixture(&batch, &mixture, b, 1, 7) != 0) return 0;
+        if (batch.batch_index != b || !ct_batch_verify(&batch)) return 0;
+
+        for (uint32_t i = 0; i < MX_B; i++) {
+            uint32_t p = b * MX_B + i;
+            if (p >= MX_M) {
+                static const ct_hash_t zero = { 0 };
+                if (samples[i].data != NULL || memcmp(hashes[i], zero, 32) != 0) return 0;
+                continue;
+            }
+            int32_t v = *(const int32_t *)samples[i].data;
+            if (v != (int32_t)(g_source[p] * 1000U + g_index[p])) return 0;
+
+            ct_hash_t sample_hash, leaf;
+            ct_hash_sample(&samples[i], sample_hash);
+            ct_hash_mixture_leaf(g_source[p], sample_hash, leaf);
+            if (memcmp(hashes[i], leaf, 32) != 0) return 0;
+        }
+    }
+
+    /* The same sample under another source is another leaf */
+    ct_hash_t sample_hash, a, b;
+    ct_hash_sample(&g_samples[0], sample_hash);
+    ct_hash_mixture_leaf(0, sample_hash, a);
+    ct_hash_mixture_leaf(1, sample_hash, b);
+    if (memcmp(a, b, 32) == 0 || memcmp(a, sample_hash, 32) == 0) return 0;
+
+    /* Past the epoch: batch unchanged */
+    ct_hash_t before;
+    memcpy(before, batch.batch_hash, 32);
+    if (ct_batch_fill_mixture(&batch, &mixture, 7, 1, 7) != -1) return 0;
+    return batch.batch_index == 6 && memcmp(before, batch.batch_hash, 32) == 0;
+}
+
+/* ============================================================================
+ * Test: Commitment
+ * ============================================================================ */
+
+static int test_commitment(void)
+{
+    ct_mixture_t mixture;
+    ct_hash_t base, h;
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    memcpy(base, mixture.mixture_hash, 32);
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    if (memcmp(base, mixture.mixture_hash, 32) != 0) return 0;
+
+    /* Weights, epoch size and every source root are bound */
+    static const uint32_t other[MX_S] = { 3, 2, 1 };
+    if (build(&mixture, other, MX_M) != 0) return 0;
+    if (memcmp(base, mixture.mixture_hash, 32) == 0) return 0;
+    if (build(&mixture, WEIGHTS, MX_M + 1) != 0) return 0;
+    if (memcmp(base, mixture.mixture_hash, 32) == 0) return 0;
+
+    if (build(&mixture, WEIGHTS, MX_M) != 0) return 0;
+    g_datasets[1].dataset_hash[31] ^= 1;
+    ct_hash_mixture(&mixture, h);
+    g_datasets[1].dataset_hash[31] ^= 1;
+    return memcmp(base, h, 32) != 0;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Dataset Mixture Tests\n");
+    printf("Traceability: CT-MATH-001 §7.10, CT-STRUCT-001 §25\n");
+    printf("==============================================\n\n");
+
+    setup();
+
+    printf("Schedule:\n");
+    RUN_TEST(test_build_rejects);
+    RUN_TEST(test_schedule_spread);
+
+    printf("\nPositions:\n");
+    RUN_TEST(test_range_follows_streams);
+    RUN_TEST(test_epochs_and_seeds_differ);
+
+    printf("\nBatches:\n");
+    RUN_TEST(test_batches_name_sources);
+
+    printf("\nCommitment:\n");
+    RUN_TEST(test_commitment);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -14,6 +14,7 @@
 #include <string.h>
 #include "ct_types.h"
 #include "normalize.h"
+#include "loader.h"
 #include "dvm.h"
 
 static int tests_run = 0;
@@ -453,6 +454,202 @@ static int test_saturation_overflow(void)
     return 1;  /* Just verify no crash */
 }
 
+/* ============================================================================
+ * Test: Range Planning (CT-MATH-001 §14.5)
+ * ============================================================================ */
+
+static int test_scan_ranges(void)
+{
+    int32_t d0[3] = {FIXED_ONE, -FIXED_HALF, 7};
+    int32_t d1[2] = {-FIXED_ONE, FIXED_HALF};
+    ct_sample_t samples[2] = {
+        {.version = 1, .dtype = 0, .ndims = 1, .dims = {3, 0, 0, 0}, .total_elements = 3, .data = d0},
+        {.version = 1, .dtype = 0, .ndims = 1, .dims = {2, 0, 0, 0}, .total_elements = 2, .data = d1}
+    };
+    ct_dataset_t dataset;
+    ct_dataset_init(&dataset, samples, 2);
+
+    ct_range_t ranges[4];
+    ct_dataset_scan_ranges(&dataset, ranges, 4);
+
+    if (ranges[0].min != -FIXED_ONE || ranges[0].max != FIXED_ONE) return 0;
+    if (ranges[1].min != -FIXED_HALF || ranges[1].max != FIXED_HALF) return 0;
+    if (ranges[2].min != 7 || ranges[2].max != 7) return 0;
+    if (ranges[3].min <= ranges[3].max) return 0;  /* No sample holds feature 3 */
+
+    ct_range_t u = ct_range_union(ranges, 4);
+    return u.min == -FIXED_ONE && u.max == FIXED_ONE;
+}
+
+static int test_plan_selects_unchecked_identical(void)
+{
+    int32_t means[4] = {FIXED_HALF, -FIXED_ONE, 0, 3 << 16};
+    int32_t inv_stds[4] = {2 << 16, FIXED_HALF, -FIXED_ONE, 0x1234};
+    ct_range_t ranges[4] = {
+        {-(100 << 16), 100 << 16}, {0, 1000 << 16}, {INT32_MIN / 2, INT32_MAX / 2}, {-5, 5}
+    };
+
+    ct_normalize_ctx_t checked;
+    ct_normalize_ctx_t planned;
+    ct_normalize_init(&checked, means, inv_stds, 4);
+    ct_normalize_init(&planned, means, inv_stds, 4);
+
+    ct_range_t out_ranges[4];
+    if (ct_normalize_plan(&planned, ranges, out_ranges) != 1) return 0;
+    if (planned.unchecked != 1 || checked.unchecked != 0) return 0;
+
+    /* Every range endpoint and a sweep of interior values */
+    for (int32_t step = 0; step <= 64; step++) {
+        int32_t x[4];
+        for (uint32_t f = 0; f < 4; f++) {
+            int64_t span = (int64_t)ranges[f].max - ranges[f].min;
+            x[f] = (int32_t)(ranges[f].min + span * step / 64);
+        }
+        int32_t y_checked[4];
+        int32_t y_planned[4];
+        ct_sample_t in = {.version = 1, .ndims = 1, .dims = {4, 0, 0, 0}, .total_elements = 4, .data = x};
+        ct_sample_t o1 = {.data = y_checked};
+        ct_sample_t o2 = {.data = y_planned};
+        ct_fault_flags_t f1 = {0};
+        ct_fault_flags_t f2 = {0};
+
+        ct_normalize_sample(&checked, &in, &o1, &f1);
+        ct_normalize_sample(&planned, &in, &o2, &f2);
+
+        if (memcmp(y_checked, y_planned, sizeof(y_checked)) != 0) return 0;
+        if (f1.overflow || f1.underflow || f2.overflow || f2.underflow) return 0;
+        for (uint32_t f = 0; f < 4; f++) {
+            if (y_planned[f] < out_ranges[f].min || y_planned[f] > out_ranges[f].max) return 0;
+        }
+    }
+
+    return 1;
+}
+
+static int test_plan_rejects_saturating_range(void)
+{
+    int32_t means[2] = {0, -FIXED_ONE};
+    int32_t inv_stds[2] = {FIXED_ONE, FIXED_ONE};
+
+    ct_normalize_ctx_t ctx;
+    ct_normalize_init(&ctx, means, inv_stds, 2);
+
+    /* x - mean overflows at the top of feature 1 */
+    ct_range_t ranges[2] = { {0, FIXED_ONE}, {0, INT32_MAX} };
+    if (ct_normalize_plan(&ctx, ranges, NULL) != 0) return 0;
+    if (ctx.unchecked != 0) return 0;
+
+    /* Product overflows */
+    inv_stds[1] = INT32_MAX;
+    ranges[1].max = 2 << 16;
+    return ct_normalize_plan(&ctx, ranges, NULL) == 0 && ctx.unchecked == 0;
+}
+
+/* ============================================================================
+ * Test: Narrow Formats (CT-MATH-001 §3.10)
+ * ============================================================================ */
+
+static int test_normalize16_q8_8_basic(void)
+{
+    /* (3.0 − 1.0) × 2.0 = 4.0; (0.5 − 1.0) × 2.0 = −1.0 */
+    int16_t means[2] = {0x0100, 0x0100};
+    int16_t inv_stds[2] = {0x0200, 0x0200};
+    int16_t x[2] = {0x0300, 0x0080};
+    int16_t y[2];
+
+    ct_normalize16_ctx_t ctx;
+    ct_normalize16_init(&ctx, means, inv_stds, 2, CT_DTYPE_Q8_8);
+    ct_sample16_t in = {.version = 1, .dtype = CT_DTYPE_Q8_8, .ndims = 1, .dims = {2, 0, 0, 0}, .total_elements = 2, .data = x};
+    ct_sample16_t out = {.data = y};
+    ct_fault_flags_t faults = {0};
+
+    ct_normalize16_sample(&ctx, &in, &out, &faults);
+
+    return y[0] == 0x0400 && y[1] == -0x0100 && out.dtype == CT_DTYPE_Q8_8 &&
+           !faults.overflow && !faults.underflow;
+}
+
+static int test_normalize16_agrees_with_q16(void)
+{
+    /* Widening is exact, so the Q16.16 path on widened operands, narrowed
+     * once at the end, must give the narrow result bit for bit. */
+    enum { N = 70 };
+    int16_t means[N], inv_stds[N], x[N], y16[N];
+    int32_t wmeans[N], winv[N], wx[N], wy[N];
+    uint32_t state = 0x2468ACE1U;
+
+    for (uint32_t i = 0; i < N; i++) {
+        state = state * 1103515245U + 12345U;
+        x[i] = (int16_t)((int32_t)(state >> 16) % 0x1000);
+        means[i] = (int16_t)((int32_t)(state & 0xFFFF) % 0x0800 - 0x0400);
+        inv_stds[i] = (int16_t)(0x0040 + (int32_t)(i * 13U % 0x0180));
+        wmeans[i] = dvm_widen16(means[i], CT_FRAC_Q8_8);
+        winv[i] = dvm_widen16(inv_stds[i], CT_FRAC_Q8_8);
+        wx[i] = dvm_widen16(x[i], CT_FRAC_Q8_8);
+    }
+
+    ct_normalize16_ctx_t ctx16;
+    ct_normalize_ctx_t ctx32;
+    ct_normalize16_init(&ctx16, means, inv_stds, N, CT_DTYPE_Q8_8);
+    ct_normalize_init(&ctx32, wmeans, winv, N);
+
+    ct_sample16_t in16 = {.version = 1, .dtype = CT_DTYPE_Q8_8, .ndims = 1, .dims = {N, 0, 0, 0}, .total_elements = N, .data = x};
+    ct_sample16_t out16 = {.data = y16};
+    ct_sample_t in32 = {.version = 1, .ndims = 1, .dims = {N, 0, 0, 0}, .total_elements = N, .data = wx};
+    ct_sample_t out32 = {.data = wy};
+    ct_fault_flags_t f16 = {0};
+    ct_fault_flags_t f32 = {0};
+
+    ct_normalize16_sample(&ctx16, &in16, &out16, &f16);
+    ct_normalize_sample(&ctx32, &in32, &out32, &f32);
+
+    for (uint32_t i = 0; i < N; i++) {
+        if (dvm_narrow16(wy[i], CT_FRAC_Q8_8, &f32) != y16[i]) return 0;
+    }
+    return !f16.overflow && !f16.underflow && !f32.overflow && !f32.underflow;
+}
+
+static int test_normalize16_dtype_mismatch(void)
+{
+    int16_t means[1] = {0};
+    int16_t inv_stds[1] = {0x7FFF};
+    int16_t x[1] = {0x1000};
+    int16_t y[1] = {0x5555};
+
+    ct_normalize16_ctx_t ctx;
+    ct_normalize16_init(&ctx, means, inv_stds, 1, CT_DTYPE_Q1_15);
+    ct_sample16_t in = {.version = 1, .dtype = CT_DTYPE_Q8_8, .ndims = 1, .dims = {1, 0, 0, 0}, .total_elements = 1, .data = x};
+    ct_sample16_t out = {.data = y};
+    ct_fault_flags_t faults = {0};
+
+    ct_normalize16_sample(&ctx, &in, &out, &faults);
+
+    return faults.domain == 1 && y[0] == 0x5555;
+}
+
+static int test_sample_widen_narrow(void)
+{
+    int32_t wide[3] = {FIXED_ONE, -FIXED_HALF, 0x0180};
+    int16_t narrow[3];
+    int32_t back[3];
+
+    ct_sample_t in = {.version = 1, .ndims = 1, .dims = {3, 0, 0, 0}, .total_elements = 3, .data = wide};
+    ct_sample16_t mid = {.data = narrow};
+    ct_sample_t out = {.data = back};
+    ct_fault_flags_t faults = {0};
+
+    ct_sample_narrow(&in, &mid, CT_DTYPE_Q8_8, &faults);
+    if (mid.dtype != CT_DTYPE_Q8_8 || mid.total_elements != 3) return 0;
+    if (narrow[0] != 0x0100 || narrow[1] != -0x0080 || narrow[2] != 2) return 0;
+
+    ct_sample_widen(&mid, &out, &faults);
+    if (out.dtype != CT_DTYPE_Q16_16) return 0;
+    if (back[0] != FIXED_ONE || back[1] != -FIXED_HALF || back[2] != 0x0200) return 0;
+
+    ct_sample_narrow(&in, &mid, 7, &faults);
+    return faults.domain == 1 && !faults.overflow && !faults.underflow;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -489,6 +686,17 @@ int main(void)
     printf("\nFault handling:\n");
     RUN_TEST(test_saturation_overflow);
     
+    printf("\nRange planning:\n");
+    RUN_TEST(test_scan_ranges);
+    RUN_TEST(test_plan_selects_unchecked_identical);
+    RUN_TEST(test_plan_rejects_saturating_range);
+    
+    printf("\nNarrow formats:\n");
+    RUN_TEST(test_normalize16_q8_8_basic);
+    RUN_TEST(test_normalize16_agrees_with_q16);
+    RUN_TEST(test_normalize16_dtype_mismatch);
+    RUN_TEST(test_sample_widen_narrow);
+    
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
     printf("==============================================\n");
@@ -431,6 +431,207 @@ static int test_divq16_by_one(void)
     return result == x;
 }
 
+/* ============================================================================
+ * Test: Invariant Divisors (CT-MATH-001 §3.8)
+ * ============================================================================ */
+
+static uint64_t div_test_rng(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static int div_matches(int32_t num, const dvm_divisor_t *div)
+{
+    ct_fault_flags_t f_ref = {0};
+    ct_fault_flags_t f_fast = {0};
+    int32_t ref = dvm_div_q16(num, div->denom, &f_ref);
+    int32_t fast = dvm_div_q16_by(num, div, &f_fast);
+
+    return ref == fast && f_ref.overflow == f_fast.overflow &&
+           f_ref.underflow == f_fast.underflow && f_ref.div_zero == f_fast.div_zero;
+}
+
+/* Numerators around every multiple boundary of num × 2^16 / |denom| */
+static int div_matches_boundaries(const dvm_divisor_t *div, uint64_t *rng)
+{
+    static const int32_t edges[] = {
+        0, 1, -1, 2, -2, FIXED_ONE, -FIXED_ONE, FIXED_HALF, -FIXED_HALF,
+        0x7FFF, 0x8000, INT32_MAX, INT32_MIN, INT32_MAX - 1, INT32_MIN + 1
+    };
+    for (uint32_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+        if (!div_matches(edges[i], div)) return 0;
+    }
+
+    uint64_t d = (div->denom < 0) ? (uint64_t)(-(int64_t)div->denom) : (uint64_t)div->denom;
+    for (uint32_t i = 0; i < 64; i++) {
+        /* num ≈ q × d / 2^16 for a random quotient q */
+        uint64_t q = div_test_rng(rng) >> (16 + (i & 31U));
+        int64_t num = (int64_t)((q * d) >> 16);
+        for (int64_t delta = -1; delta <= 1; delta++) {
+            int64_t v = num + delta;
+            if (v > INT32_MAX || v < -(int64_t)INT32_MAX) continue;
+            if (!div_matches((int32_t)v, div)) return 0;
+            if (!div_matches((int32_t)-v, div)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_divisor_small_denominators(void)
+{
+    /* Every denominator in [-8192, 8192], including zero */
+    uint64_t rng = 1;
+    for (int32_t d = -8192; d <= 8192; d++) {
+        dvm_divisor_t div;
+        dvm_divisor_init(&div, d);
+        if (!div_matches_boundaries(&div, &rng)) return 0;
+    }
+    return 1;
+}
+
+static int test_divisor_powers_of_two(void)
+{
+    /* ±2^k and ±(2^k ± 1): the shift and magic extremes */
+    uint64_t rng = 2;
+    for (uint32_t k = 0; k < 32; k++) {
+        int64_t p = (int64_t)1 << k;
+        int64_t cands[6] = { p, p - 1, p + 1, -p, -(p - 1), -(p + 1) };
+        for (uint32_t c = 0; c < 6; c++) {
+            if (cands[c] > INT32_MAX || cands[c] < INT32_MIN) continue;
+            dvm_divisor_t div;
+            dvm_divisor_init(&div, (int32_t)cands[c]);
+            if (!div_matches_boundaries(&div, &rng)) return 0;
+
+            /* Strided sweep over the whole numerator range */
+            for (uint64_t n = 0; n < (1ULL << 32); n += 65521ULL) {
+                if (!div_matches((int32_t)(uint32_t)n, &div)) return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static int test_divisor_random_pairs(void)
+{
+    uint64_t rng = 3;
+    for (uint32_t i = 0; i < 20000; i++) {
+        uint64_t r = div_test_rng(&rng);
+        /* Spread denominators over every magnitude */
+        int32_t d = (int32_t)(uint32_t)(r >> (r & 31U));
+        dvm_divisor_t div;
+        dvm_divisor_init(&div, d);
+        if (!div_matches_boundaries(&div, &rng)) return 0;
+        for (uint32_t j = 0; j < 16; j++) {
+            if (!div_matches((int32_t)(uint32_t)div_test_rng(&rng), &div)) return 0;
+        }
+    }
+    return 1;
+}
+
+static int test_divisor_zero_faults(void)
+{
+    dvm_divisor_t div;
+    dvm_divisor_init(&div, 0);
+
+    ct_fault_flags_t faults = {0};
+    int32_t result = dvm_div_q16_by(FIXED_ONE, &div, &faults);
+
+    return result == 0 && faults.div_zero == 1;
+}
+
+/* ============================================================================
+ * Test: Narrow Formats (CT-MATH-001 §3.10)
+ * ============================================================================ */
+
+static int test_add16_saturates(void)
+{
+    ct_fault_flags_t faults = {0};
+    if (dvm_add16(100, 200, &faults) != 300) return 0;
+    if (faults.overflow || faults.underflow) return 0;
+    if (dvm_add16(INT16_MAX, 1, &faults) != INT16_MAX || !faults.overflow) return 0;
+    if (dvm_sub16(INT16_MIN, 1, &faults) != INT16_MIN || !faults.underflow) return 0;
+    return 1;
+}
+
+static int test_mul_fx16_q8_8(void)
+{
+    ct_fault_flags_t faults = {0};
+
+    /* 1.5 × 2.0 = 3.0; 0.5 × 0.5 = 0.25 */
+    if (dvm_mul_fx16(0x0180, 0x0200, CT_FRAC_Q8_8, &faults) != 0x0300) return 0;
+    if (dvm_mul_fx16(0x0080, 0x0080, CT_FRAC_Q8_8, &faults) != 0x0040) return 0;
+
+    /* 2^-8 × 0.5 is exactly halfway: RNE rounds 0.5 ulp to 0, 1.5 ulp to 2 */
+    if (dvm_mul_fx16(0x0001, 0x0080, CT_FRAC_Q8_8, &faults) != 0) return 0;
+    if (dvm_mul_fx16(0x0003, 0x0080, CT_FRAC_Q8_8, &faults) != 2) return 0;
+    if (dvm_mul_fx16(-0x0001, 0x0080, CT_FRAC_Q8_8, &faults) != 0) return 0;
+
+    return !faults.overflow && !faults.underflow;
+}
+
+static int test_mul_fx16_q1_15_extremes(void)
+{
+    ct_fault_flags_t faults = {0};
+
+    /* (−1) × (−1) = +1 is not representable in Q1.15 */
+    if (dvm_mul_fx16(INT16_MIN, INT16_MIN, CT_FRAC_Q1_15, &faults) != INT16_MAX) return 0;
+    if (!faults.overflow) return 0;
+
+    faults.overflow = 0;
+    if (dvm_mul_fx16(INT16_MIN, INT16_MAX, CT_FRAC_Q1_15, &faults) != -INT16_MAX) return 0;
+    return !faults.overflow && !faults.underflow;
+}
+
+static int test_mul_fx16_invalid_frac(void)
+{
+    ct_fault_flags_t faults = {0};
+    return dvm_mul_fx16(1, 1, 0, &faults) == 0 && faults.domain == 1;
+}
+
+static int test_widen_narrow_roundtrip(void)
+{
+    /* Widening is exact, so narrowing it back is the identity */
+    static const uint32_t fracs[2] = { CT_FRAC_Q8_8, CT_FRAC_Q1_15 };
+    for (uint32_t f = 0; f < 2; f++) {
+        for (int32_t x = INT16_MIN; x <= INT16_MAX; x += 97) {
+            ct_fault_flags_t faults = {0};
+            int32_t wide = dvm_widen16((int16_t)x, fracs[f]);
+            if (dvm_narrow16(wide, fracs[f], &faults) != x) return 0;
+            if (faults.overflow || faults.underflow) return 0;
+        }
+    }
+
+    return dvm_widen16(0x0100, CT_FRAC_Q8_8) == FIXED_ONE &&
+           dvm_widen16(0x4000, CT_FRAC_Q1_15) == FIXED_HALF;
+}
+
+static int test_narrow_rounds_and_saturates(void)
+{
+    ct_fault_flags_t faults = {0};
+
+    /* Q16.16 0x0080 is half a Q8.8 ulp: ties to even */
+    if (dvm_narrow16(0x0080, CT_FRAC_Q8_8, &faults) != 0) return 0;
+    if (dvm_narrow16(0x0180, CT_FRAC_Q8_8, &faults) != 2) return 0;
+    if (faults.overflow || faults.underflow) return 0;
+
+    /* 1.0 does not fit Q1.15; −128 − 2^-8 does not fit Q8.8 */
+    if (dvm_narrow16(FIXED_ONE, CT_FRAC_Q1_15, &faults) != INT16_MAX) return 0;
+    if (!faults.overflow) return 0;
+    if (dvm_narrow16(-128 * FIXED_ONE - 0x100, CT_FRAC_Q8_8, &faults) != INT16_MIN) return 0;
+    return faults.underflow == 1;
+}
+
+static int test_dtype_frac_bits(void)
+{
+    return ct_dtype_frac_bits(CT_DTYPE_Q16_16) == 16 &&
+           ct_dtype_frac_bits(CT_DTYPE_Q8_8) == 8 &&
+           ct_dtype_frac_bits(CT_DTYPE_Q1_15) == 15 &&
+           ct_dtype_frac_bits(99) == 0;
+}
+
 /* ============================================================================
  * Test: Fault Flag Management
  * ============================================================================ */
@@ -521,6 +722,21 @@ int main(void)
     RUN_TEST(test_divq16_by_zero);
     RUN_TEST(test_divq16_by_one);
     
+    printf("\nInvariant Divisors:\n");
+    RUN_TEST(test_divisor_small_denominators);
+    RUN_TEST(test_divisor_powers_of_two);
+    RUN_TEST(test_divisor_random_pairs);
+    RUN_TEST(test_divisor_zero_faults);
+    
+    printf("\nNarrow Formats:\n");
+    RUN_TEST(test_add16_saturates);
+    RUN_TEST(test_mul_fx16_q8_8);
+    RUN_TEST(test_mul_fx16_q1_15_extremes);
+    RUN_TEST(test_mul_fx16_invalid_frac);
+    RUN_TEST(test_widen_narrow_roundtrip);
+    RUN_TEST(test_narrow_rounds_and_saturates);
+    RUN_TEST(test_dtype_frac_bits);
+    
     printf("\nFault Flags:\n");
     RUN_TEST(test_fault_clear);
     
@@ -12,6 +12,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "ct_types.h"
+#include "dispatch.h"
 #include "prng.h"
 
 static int tests_run = 0;
@@ -190,6 +191,76 @@ static int test_uniform_coverage(void)
     return 1;
 }
 
+/* ============================================================================
+ * Test: Bounded Uniform, Version 2 (CT-MATH-001 §5.5)
+ * ============================================================================ */
+
+static int test_uniform_v2_range(void)
+{
+    static const uint32_t NS[5] = { 2, 100, 65537, 0x80000001U, 0xFFFFFFFFU };
+    for (uint32_t k = 0; k < 5; k++) {
+        for (uint32_t i = 0; i < 1000; i++) {
+            if (ct_prng_uniform_v2(0x123456789ABCDEF0ULL, 0, i, NS[k]) >= NS[k]) return 0;
+        }
+    }
+    return ct_prng_uniform_v2(12345, 0, 0, 0) == 0 && ct_prng_uniform_v2(12345, 0, 0, 1) == 0;
+}
+
+static int test_uniform_v2_unbiased(void)
+{
+    /* n = 3 × 2^30: a 32-bit modulo would put half the draws below 2^30,
+     * an unbiased draw puts a third there */
+    uint32_t below = 0;
+    for (uint32_t i = 0; i < 30000; i++) {
+        below += (ct_prng_uniform_v2(0x9999999999999999ULL, 2, i, 0xC0000000U) < 0x40000000U);
+    }
+    return below > 9500 && below < 10500;
+}
+
+static int test_uniform_v2_bound_matches(void)
+{
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint64_t r = ct_prng(0xABCDEF0123456789ULL, 5, i);
+        if (ct_prng_bound_v2(r, 0x80000001U) != ct_prng_uniform_v2(0xABCDEF0123456789ULL, 5, i,
+                                                                    0x80000001U)) return 0;
+    }
+    return 1;
+}
+
+static int test_uniform_v2_vectors(void)
+{
+    uint64_t seed = 0x123456789ABCDEF0ULL;
+
+    /* CT-MATH-001 §5.5 */
+    if (ct_prng_uniform_v2(seed, 0, 0, 10) != 3) return 0;
+    if (ct_prng_uniform_v2(seed, 0, 1, 1000) != 363) return 0;
+    if (ct_prng_uniform_v2(seed, 0, 0, 65536) != 21773) return 0;
+    if (ct_prng_uniform_v2(seed, 0, 1, 0x80000001U) != 780954065U) return 0;
+    if (ct_prng_uniform_v2(seed, 0, 0, 0xFFFFFFFFU) != 1426955565U) return 0;
+
+    /* Low word rejected, high word accepted */
+    if (ct_prng_bound_v2(0xFFFFFFFF00000000ULL, 0x80000001U) != 0x80000000U) return 0;
+    /* Both words rejected: the SplitMix64 successor decides */
+    return ct_prng_bound_v2(0, 0x80000001U) == 1032775383U;
+}
+
+static int test_uniform_v2_bulk(void)
+{
+    uint64_t u[100];
+    uint32_t out[100];
+    const ct_dispatch_t *k = ct_dispatch_get();
+    for (uint32_t i = 0; i < 100; i++) {
+        u[i] = ct_prng(0x5555AAAA5555AAAAULL, 1, i);
+    }
+    u[7] = 0;
+    u[16] = 0xFFFFFFFF00000000ULL;
+    k->bound_v2(u, out, 100, 0x80000001U);
+    for (uint32_t i = 0; i < 100; i++) {
+        if (out[i] != ct_prng_bound_v2(u[i], 0x80000001U)) return 0;
+    }
+    return 1;
+}
+
 /* ============================================================================
  * Test: Known Test Vectors (CT-MATH-001 §5)
  * ============================================================================ */
@@ -243,6 +314,13 @@ int main(void)
     RUN_TEST(test_uniform_deterministic);
     RUN_TEST(test_uniform_coverage);
     
+    printf("\nBounded uniform, version 2:\n");
+    RUN_TEST(test_uniform_v2_range);
+    RUN_TEST(test_uniform_v2_unbiased);
+    RUN_TEST(test_uniform_v2_bound_matches);
+    RUN_TEST(test_uniform_v2_vectors);
+    RUN_TEST(test_uniform_v2_bulk);
+    
     printf("\nKnown test vectors:\n");
     RUN_TEST(test_known_vectors);
     
@@ -0,0 +1,667 @@
+/**
+ * @file test_shm.c
+ * @project Certifiable Data Pipeline
+ * @brief Unit tests for the shared-memory batch ring
+ *
+ * @traceability CT-STRUCT-001 §20
+ *
+ * @author William Murray
+ * @copyright Copyright (c) 2026 The Murray Family Innovation Trust.
+ */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "ct_types.h"
+#include "batch.h"
+#include "loader.h"
+#include "merkle.h"
+#include "shm.h"
+
+static int tests_run = 0;
+static int tests_passed = 0;
+
+#define RUN_TEST(fn) do { \
+    printf("  %-50s ", #fn); \
+    tests_run++; \
+    if (fn()) { printf("PASS\n"); tests_passed++; } \
+    else { printf("FAIL\n"); } \
+} while(0)
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define SHM_N      10
+#define SHM_B      4
+#define SHM_ELEMS  3
+
+static int32_t g_data[SHM_N][SHM_ELEMS];
+static ct_sample_t g_samples[SHM_N];
+static ct_dataset_t g_dataset;
+static char g_name[CT_SHM_NAME_MAX];
+
+static void setup(void)
+{
+    for (uint32_t i = 0; i < SHM_N; i++) {
+        for (uint32_t j = 0; j < SHM_ELEMS; j++) {
+            g_data[i][j] = (int32_t)((i * 7U + j) << 12);
+        }
+        g_samples[i] = (ct_sample_t){ .version = 1, .ndims = 1, .dims = {SHM_ELEMS, 0, 0, 0},
+                                      .total_elements = SHM_ELEMS, .data = g_data[i] };
+    }
+    ct_dataset_init(&g_dataset, g_samples, SHM_N);
+    memset(g_dataset.dataset_hash, 0x5A, 32);
+    snprintf(g_name, sizeof(g_name), "/ct_test_shm_%ld", (long)getpid());
+}
+
+static ct_shm_params_t make_params(uint32_t slot_count)
+{
+    ct_shm_params_t p;
+    memset(&p, 0, sizeof(p));
+    p.slot_count = slot_count;
+    p.batch_size = SHM_B;
+    p.max_elements = SHM_ELEMS;
+    memcpy(p.dataset_hash, g_dataset.dataset_hash, 32);
+    memset(p.config_hash, 0xC3, 32);
+    return p;
+}
+
+/* Fill and publish batch b of epoch 0 */
+static int publish(ct_shm_server_t *server, uint32_t b)
+{
+    ct_sample_t samples[SHM_B];
+    ct_hash_t hashes[SHM_B];
+    ct_batch_t batch;
+    ct_batch_init(&batch, samples, hashes, SHM_B);
+    ct_batch_fill(&batch, &g_dataset, b, 0, 42);
+    return ct_shm_server_publish(server, &batch, 0);
+}
+
+/* ============================================================================
+ * Test: Layout
+ * ============================================================================ */
+
+static int test_region_size(void)
+{
+    ct_shm_params_t p = make_params(2);
+    size_t one = ct_shm_region_size(&p);
+    p.slot_count = 3;
+    size_t three = ct_shm_region_size(&p);
+    if (one == 0 || three <= one || (three % 64) != 0) return 0;
+
+    p.slot_count = 0;
+    if (ct_shm_region_size(&p) != 0) return 0;
+    p = make_params(2);
+    p.max_elements = 0;
+    return ct_shm_region_size(&p) == 0;
+}
+
+static int test_create_rejects_bad_name_and_duplicates(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server, again;
+    if (ct_shm_server_create(&server, "no_slash", &p) != CT_SHM_ERROR) return 0;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    int dup = ct_shm_server_create(&again, g_name, &p);
+    ct_shm_server_destroy(&server);
+
+    ct_shm_client_t client;
+    return dup == CT_SHM_ERROR && ct_shm_client_attach(&client, g_name) == CT_SHM_ERROR;
+}
+
+/* The object as a client can see it part-way through ct_shm_server_create */
+static int test_attach_during_create(void)
+{
+    ct_shm_params_t p = make_params(2);
+    size_t size = ct_shm_region_size(&p);
+    ct_shm_client_t client;
+    int fd = shm_open(g_name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return 0;
+
+    /* Opened, not yet sized */
+    int ok = ct_shm_client_attach(&client, g_name) == CT_SHM_AGAIN;
+
+    /* Sized and zero-filled, magic not yet stored */
+    ok = ok && ftruncate(fd, (off_t)size) == 0 &&
+         ct_shm_client_attach(&client, g_name) == CT_SHM_AGAIN;
+
+    /* A header that is not ours is still an error */
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ok = ok && base != MAP_FAILED;
+    if (ok) {
+        memset(base, 0xA5, size);
+        munmap(base, size);
+        ok = ct_shm_client_attach(&client, g_name) == CT_SHM_ERROR;
+    }
+
+    close(fd);
+    shm_unlink(g_name);
+    return ok;
+}
+
+/* ============================================================================
+ * Test: Publish / Consume
+ * ============================================================================ */
+
+static int test_roundtrip_zero_copy(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    if (ct_shm_client_attach(&client, g_name) != CT_SHM_OK) {
+        ct_shm_server_destroy(&server);
+        return 0;
+    }
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    uint32_t epoch = 99;
+    int ok = ct_shm_client_acquire(&client, &view, view_samples, &epoch) == CT_SHM_AGAIN;
+    ok = ok && publish(&server, 1) == CT_SHM_OK;
+    ok = ok && ct_shm_client_acquire(&client, &view, view_samples, &epoch) == CT_SHM_OK;
+
+    /* Compare against the same batch built privately */
+    ct_sample_t samples[SHM_B];
+    ct_hash_t hashes[SHM_B];
+    ct_batch_t expected;
+    ct_batch_init(&expected, samples, hashes, SHM_B);
+    ct_batch_fill(&expected, &g_dataset, 1, 0, 42);
+
+    if (ok) {
+        const uint8_t *lo = (const uint8_t *)client.base;
+        const uint8_t *hi = lo + client.size;
+        ok = epoch == 0 && view.batch_index == 1 &&
+             memcmp(view.batch_hash, expected.batch_hash, 32) == 0;
+        for (uint32_t i = 0; ok && i < SHM_B; i++) {
+            const uint8_t *d = (const uint8_t *)view_samples[i].data;
+            ok = d >= lo && d < hi &&
+                 memcmp(view_samples[i].data, samples[i].data, SHM_ELEMS * sizeof(int32_t)) == 0 &&
+                 memcmp(view.sample_hashes[i], hashes[i], 32) == 0;
+        }
+        ok = ok && ct_batch_verify(&view) && ct_shm_view_verify(&view);
+    }
+
+    /* A second acquire without release is a protocol error */
+    ok = ok && ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_ERROR;
+    ct_shm_client_release(&client);
+
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+static int test_partial_batch_verifies(void)
+{
+    ct_shm_params_t p = make_params(1);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&client, g_name);
+
+    /* Batch 2 holds samples 8..9 and two padding slots */
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    int ok = publish(&server, 2) == CT_SHM_OK &&
+             ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_OK &&
+             view_samples[3].data == NULL && ct_shm_view_verify(&view);
+
+    ct_shm_client_release(&client);
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+static int test_tampered_data_detected(void)
+{
+    ct_shm_params_t p = make_params(1);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&client, g_name);
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    int ok = publish(&server, 0) == CT_SHM_OK &&
+             ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_OK;
+
+    /* Hashes still agree with each other, so only a re-hash notices */
+    ok = ok && ct_shm_view_verify(&view);
+    if (ok) {
+        view_samples[1].data[0] ^= 1;
+        ok = ct_batch_verify(&view) && !ct_shm_view_verify(&view);
+    }
+
+    ct_shm_client_release(&client);
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* ============================================================================
+ * Test: Flow Control
+ * ============================================================================ */
+
+static int test_backpressure_and_broadcast(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    ct_shm_client_t a, b;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&a, g_name);
+    ct_shm_client_attach(&b, g_name);
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    int ok = publish(&server, 0) == CT_SHM_OK && publish(&server, 1) == CT_SHM_OK;
+
+    /* Both slots unread by both clients */
+    ok = ok && publish(&server, 2) == CT_SHM_AGAIN;
+
+    /* One client moving on is not enough */
+    ok = ok && ct_shm_client_acquire(&a, &view, view_samples, NULL) == CT_SHM_OK &&
+         view.batch_index == 0;
+    ct_shm_client_release(&a);
+    ok = ok && publish(&server, 2) == CT_SHM_AGAIN;
+
+    /* Every client sees every batch, in order */
+    ok = ok && ct_shm_client_acquire(&b, &view, view_samples, NULL) == CT_SHM_OK &&
+         view.batch_index == 0;
+    ct_shm_client_release(&b);
+    ok = ok && publish(&server, 2) == CT_SHM_OK;
+
+    for (uint32_t expect = 1; ok && expect <= 2; expect++) {
+        ok = ct_shm_client_acquire(&a, &view, view_samples, NULL) == CT_SHM_OK &&
+             view.batch_index == expect && ct_shm_view_verify(&view);
+        ct_shm_client_release(&a);
+    }
+
+    /* A detached client no longer holds the ring back */
+    ct_shm_client_detach(&b);
+    ok = ok && publish(&server, 0) == CT_SHM_OK && publish(&server, 1) == CT_SHM_OK;
+
+    ct_shm_client_detach(&a);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+static int test_late_client_starts_at_live_edge(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+
+    int ok = publish(&server, 0) == CT_SHM_OK;
+    ct_shm_client_attach(&client, g_name);
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    ok = ok && ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_AGAIN;
+    ok = ok && publish(&server, 1) == CT_SHM_OK &&
+         ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_OK &&
+         view.batch_index == 1;
+    ct_shm_client_release(&client);
+
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+static int test_close_after_drain(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&client, g_name);
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    int ok = publish(&server, 0) == CT_SHM_OK;
+    ct_shm_server_close(&server);
+
+    /* Published batches are still delivered after close */
+    ok = ok && ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_OK;
+    ct_shm_client_release(&client);
+    ok = ok && ct_shm_client_acquire(&client, &view, view_samples, NULL) == CT_SHM_CLOSED;
+
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* ============================================================================
+ * Test: Commitments
+ * ============================================================================ */
+
+static int test_commitments_published(void)
+{
+    ct_shm_params_t p = make_params(1);
+    ct_shm_server_t server;
+    ct_shm_client_t client;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    ct_shm_client_attach(&client, g_name);
+
+    ct_provenance_t prov;
+    ct_provenance_init(&prov, p.dataset_hash, p.config_hash, 42);
+    ct_hash_t epoch_hash;
+    memset(epoch_hash, 0x11, 32);
+    ct_provenance_advance(&prov, epoch_hash);
+
+    ct_hash_t dataset_hash, config_hash;
+    ct_provenance_t seen;
+    int ok = ct_shm_server_set_provenance(&server, &prov) == CT_SHM_OK &&
+             ct_shm_client_commitments(&client, dataset_hash, config_hash, &seen) == CT_SHM_OK;
+
+    ok = ok && memcmp(dataset_hash, p.dataset_hash, 32) == 0 &&
+             memcmp(config_hash, p.config_hash, 32) == 0 &&
+             seen.current_epoch == prov.current_epoch &&
+             seen.total_epochs == prov.total_epochs &&
+             memcmp(seen.current_hash, prov.current_hash, 32) == 0 &&
+             memcmp(seen.prev_hash, prov.prev_hash, 32) == 0;
+
+    ct_shm_client_detach(&client);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* ============================================================================
+ * Test: Separate Process
+ * ============================================================================ */
+
+static void pause_briefly(void)
+{
+    struct timespec ts = { 0, 100000 };
+    nanosleep(&ts, NULL);
+}
+
+static int consume_all(int ready_fd)
+{
+    ct_shm_client_t client;
+    int attached = ct_shm_client_attach(&client, g_name);
+    char byte = (attached == CT_SHM_OK) ? 'y' : 'n';
+    if (write(ready_fd, &byte, 1) != 1 || attached != CT_SHM_OK) return 1;
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    uint32_t expect = 0;
+    for (;;) {
+        int status = ct_shm_client_acquire(&client, &view, view_samples, NULL);
+        if (status == CT_SHM_CLOSED) break;
+        if (status == CT_SHM_AGAIN) {
+            pause_briefly();
+            continue;
+        }
+        if (status != CT_SHM_OK || view.batch_index != expect % 3 ||
+            !ct_shm_view_verify(&view)) {
+            return 1;
+        }
+        expect++;
+        ct_shm_client_release(&client);
+    }
+    ct_shm_client_detach(&client);
+    return (expect == 12) ? 0 : 1;
+}
+
+static int test_fork_consumer(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    int ready[2];
+    if (pipe(ready) != 0) return 0;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        ct_shm_server_destroy(&server);
+        return 0;
+    }
+    if (pid == 0) {
+        close(ready[0]);
+        _exit(consume_all(ready[1]));
+    }
+    close(ready[1]);
+
+    /* Publish only once the child has joined, so it must see all 12 */
+    char byte = 0;
+    int ok = read(ready[0], &byte, 1) == 1 && byte == 'y';
+    close(ready[0]);
+
+    /* Twelve batches through two slots: the child paces the server */
+    uint32_t published = 0;
+    while (ok && published < 12) {
+        int status = publish(&server, published % 3);
+        if (status == CT_SHM_OK) {
+            published++;
+        } else if (status == CT_SHM_AGAIN) {
+            pause_briefly();
+        } else {
+            ok = 0;
+        }
+    }
+    ct_shm_server_close(&server);
+
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    ct_shm_server_destroy(&server);
+    return ok && WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0;
+}
+
+/* ============================================================================
+ * Test: Crash Recovery
+ * ============================================================================ */
+
+/* Attach, report, hold batch 0, report again, then wait to be killed */
+static int hold_until_killed(int ready_fd)
+{
+    ct_shm_client_t client;
+    char byte = (ct_shm_client_attach(&client, g_name) == CT_SHM_OK) ? 'y' : 'n';
+    if (write(ready_fd, &byte, 1) != 1 || byte != 'y') return 1;
+
+    ct_sample_t view_samples[SHM_B];
+    ct_batch_t view;
+    int status;
+    while ((status = ct_shm_client_acquire(&client, &view, view_samples, NULL)) == CT_SHM_AGAIN) {
+        pause_briefly();
+    }
+    byte = (status == CT_SHM_OK && view.batch_index == 0) ? 'h' : 'n';
+    if (write(ready_fd, &byte, 1) != 1) return 1;
+    for (;;) {
+        pause();
+    }
+}
+
+static int test_killed_client_evicted_by_publish(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    int ready[2];
+    if (pipe(ready) != 0) return 0;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        ct_shm_server_destroy(&server);
+        return 0;
+    }
+    if (pid == 0) {
+        close(ready[0]);
+        _exit(hold_until_killed(ready[1]));
+    }
+    close(ready[1]);
+
+    char byte = 0;
+    int ok = read(ready[0], &byte, 1) == 1 && byte == 'y';
+    ok = ok && publish(&server, 0) == CT_SHM_OK && publish(&server, 1) == CT_SHM_OK;
+    ok = ok && read(ready[0], &byte, 1) == 1 && byte == 'h';
+    close(ready[0]);
+
+    /* A live client holding the oldest slot still applies backpressure */
+    ok = ok && publish(&server, 2) == CT_SHM_AGAIN;
+
+    /* Once it is dead and waited for, its view no longer pins the slot */
+    kill(pid, SIGKILL);
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    ok = ok && WIFSIGNALED(wstatus) && publish(&server, 2) == CT_SHM_OK;
+
+    ct_shm_client_t client;
+    ok = ok && ct_shm_client_attach(&client, g_name) == CT_SHM_OK;
+    if (ok) ct_shm_client_detach(&client);
+
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+static int test_reap_exited_client(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    ct_shm_client_t live;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+    int ok = ct_shm_client_attach(&live, g_name) == CT_SHM_OK;
+
+    /* The child exits attached, without detaching */
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        ct_shm_server_destroy(&server);
+        return 0;
+    }
+    if (pid == 0) {
+        ct_shm_client_t client;
+        _exit((ct_shm_client_attach(&client, g_name) == CT_SHM_OK) ? 0 : 1);
+    }
+    int wstatus = 0;
+    waitpid(pid, &wstatus, 0);
+    ok = ok && WIFEXITED(wstatus) && WEXITSTATUS(wstatus) == 0;
+
+    /* Only the dead entry goes; the live client keeps its place */
+    uint32_t evicted = 99;
+    ok = ok && ct_shm_server_reap(&server, &evicted) == CT_SHM_OK && evicted == 1;
+    ok = ok && ct_shm_server_reap(&server, &evicted) == CT_SHM_OK && evicted == 0;
+    ok = ok && publish(&server, 0) == CT_SHM_OK && publish(&server, 1) == CT_SHM_OK &&
+         publish(&server, 2) == CT_SHM_AGAIN;
+
+    if (ok) ct_shm_client_detach(&live);
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* Hammer the join/claim lock until killed */
+static int lock_forever(int ready_fd)
+{
+    ct_shm_client_t client;
+    char byte = (ct_shm_client_attach(&client, g_name) == CT_SHM_OK) ? 'y' : 'n';
+    if (write(ready_fd, &byte, 1) != 1 || byte != 'y') return 1;
+    ct_provenance_t prov;
+    for (;;) {
+        (void)ct_shm_client_commitments(&client, NULL, NULL, &prov);
+    }
+}
+
+static int test_lock_holder_killed(void)
+{
+    ct_shm_params_t p = make_params(2);
+    ct_shm_server_t server;
+    if (ct_shm_server_create(&server, g_name, &p) != CT_SHM_OK) return 0;
+
+    /* Some of these kills land inside the lock; none may wedge the ring */
+    int ok = 1;
+    for (uint32_t round = 0; ok && round < 8; round++) {
+        int ready[2];
+        if (pipe(ready) != 0) {
+            ok = 0;
+            break;
+        }
+        fflush(stdout);
+        pid_t pid = fork();
+        if (pid < 0) {
+            close(ready[0]);
+            close(ready[1]);
+            ok = 0;
+            break;
+        }
+        if (pid == 0) {
+            close(ready[0]);
+            _exit(lock_forever(ready[1]));
+        }
+        close(ready[1]);
+        char byte = 0;
+        ok = read(ready[0], &byte, 1) == 1 && byte == 'y';
+        close(ready[0]);
+        pause_briefly();
+        kill(pid, SIGKILL);
+        waitpid(pid, NULL, 0);
+
+        ct_provenance_t prov;
+        ct_provenance_init(&prov, p.dataset_hash, p.config_hash, round);
+        ok = ok && ct_shm_server_set_provenance(&server, &prov) == CT_SHM_OK &&
+             publish(&server, round % 3) == CT_SHM_OK;
+    }
+
+    uint32_t evicted = 0;
+    ok = ok && ct_shm_server_reap(&server, &evicted) == CT_SHM_OK;
+    ct_shm_server_destroy(&server);
+    return ok;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    printf("==============================================\n");
+    printf("Certifiable Data - Shared-Memory Ring Tests\n");
+    printf("Traceability: CT-STRUCT-001 §20\n");
+    printf("==============================================\n\n");
+
+    setup();
+
+    printf("Layout:\n");
+    RUN_TEST(test_region_size);
+    RUN_TEST(test_create_rejects_bad_name_and_duplicates);
+    RUN_TEST(test_attach_during_create);
+
+    printf("\nPublish / consume:\n");
+    RUN_TEST(test_roundtrip_zero_copy);
+    RUN_TEST(test_partial_batch_verifies);
+    RUN_TEST(test_tampered_data_detected);
+
+    printf("\nFlow control:\n");
+    RUN_TEST(test_backpressure_and_broadcast);
+    RUN_TEST(test_late_client_starts_at_live_edge);
+    RUN_TEST(test_close_after_drain);
+
+    printf("\nCommitments:\n");
+    RUN_TEST(test_commitments_published);
+
+    printf("\nSeparate process:\n");
+    RUN_TEST(test_fork_consumer);
+
+    printf("\nCrash recovery:\n");
+    RUN_TEST(test_killed_client_evicted_by_publish);
+    RUN_TEST(test_reap_exited_client);
+    RUN_TEST(test_lock_holder_killed);
+
+    printf("\n==============================================\n");
+    printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
+    printf("==============================================\n");
+
+    return (tests_passed == tests_run) ? 0 : 1;
+}
@@ -1,7 +1,7 @@
 /**
  * @file test_shuffle.c
  * @project Certifiable Data Pipeline
- * @brief Unit tests for Feistel permutation
+ * @brief Unit tests for Feistel permutation and weighted sampling
  *
  * @traceability SRS-004-SHUFFLE, CT-MATH-001 §7
  *
@@ -236,6 +236,25 @@ static int test_determinism_sequence(void)
     return memcmp(seq1, seq2, N * sizeof(uint32_t)) == 0;
 }
 
+static int test_determinism_range_matches_index(void)
+{
+    uint64_t seed = 0xCCCCCCCCCCCCCCCCULL;
+    uint32_t out[300];
+    
+    /* Batched evaluation must equal per-index evaluation, any offset */
+    static const uint32_t sizes[] = { 1, 2, 100, 257, 60000 };
+    for (uint32_t c = 0; c < 5; c++) {
+        uint32_t N = sizes[c];
+        uint32_t start = N / 3;
+        uint32_t count = (N - start < 300) ? N - start : 300;
+        ct_permute_range(start, count, N, seed, 7, out);
+        for (uint32_t j = 0; j < count; j++) {
+            if (out[j] != ct_permute_index(start + j, N, seed, 7)) return 0;
+        }
+    }
+    return 1;
+}
+
 /* ============================================================================
  * Test: Range Validity
  * ============================================================================ */
@@ -304,6 +323,257 @@ static int test_verify_valid_bijection(void)
     return valid == 1;
 }
 
+/* ============================================================================
+ * Test: Weighted Sampling (CT-MATH-001 §7.6)
+ * ============================================================================ */
+
+#define ALIAS_N  8
+static const uint32_t ALIAS_WEIGHTS[ALIAS_N] = { 1, 2, 3, 4, 0, 5, 6, 7 };
+
+static int build_fixture(ct_alias_table_t *table, uint32_t *prob, uint32_t *alias)
+{
+    uint32_t work[ALIAS_N];
+    return ct_alias_build(table, ALIAS_WEIGHTS, ALIAS_N, prob, alias, work);
+}
+
+/* Every column's kept share plus what others borrow from it is w × N */
+static int alias_masses_exact(const ct_alias_table_t *t, const uint32_t *weights)
+{
+    uint64_t w = t->total_weight;
+    for (uint32_t i = 0; i < t->num_samples; i++) {
+        if (t->prob[i] > w || t->alias[i] >= t->num_samples) return 0;
+    }
+    for (uint32_t i = 0; i < t->num_samples; i++) {
+        uint64_t mass = t->prob[i];
+        for (uint32_t k = 0; k < t->num_samples; k++) {
+            if (k != i && t->alias[k] == i) {
+                mass += w - t->prob[k];
+            }
+        }
+        if (mass != (uint64_t)weights[i] * t->num_samples) return 0;
+    }
+    return 1;
+}
+
+static int test_alias_build_exact(void)
+{
+    uint32_t prob[ALIAS_N], alias[ALIAS_N];
+    ct_alias_table_t table;
+    if (build_fixture(&table, prob, alias) != 0) return 0;
+    if (table.num_samples != ALIAS_N || table.total_weight != 28) return 0;
+    if (!alias_masses_exact(&table, ALIAS_WEIGHTS)) return 0;
+
+    /* Skewed and near-limit weights */
+    static uint32_t big[300];
+    static uint32_t bp[300], ba[300], bw[300];
+    for (uint32_t i = 0; i < 300; i++) {
+        big[i] = (i % 7 == 0) ? 0x00FFFFFFU : i;
+    }
+    if (ct_alias_build(&table, big, 300, bp, ba, bw) != 0) return 0;
+    if (!alias_masses_exact(&table, big)) return 0;
+
+    uint32_t edge[2] = { 0xFFFFFFFEU, 1 };
+    if (ct_alias_build(&table, edge, 2, bp, ba, bw) != 0) return 0;
+    return table.total_weight == 0xFFFFFFFFU && alias_masses_exact(&table, edge);
+}
+
+static int test_alias_build_rejects(void)
+{
+    uint32_t prob[4], alias[4], work[4];
+    ct_alias_table_t table;
+    memset(&table, 0, sizeof(table));
+    uint32_t zeros[2] = { 0, 0 };
+    uint32_t over[2] = { 0xFFFFFFFFU, 1 };
+
+    if (ct_alias_build(&table, zeros, 0, prob, alias, work) != -1) return 0;
+    if (ct_alias_build(&table, zeros, 2, prob, alias, work) != -1) return 0;
+    if (ct_alias_build(&table, over, 2, prob, alias, work) != -1) return 0;
+    return table.prob == NULL && table.num_samples == 0;
+}
+
+static int test_alias_range_matches_draw(void)
+{
+    uint32_t prob[ALIAS_N], alias[ALIAS_N];
+    ct_alias_table_t table;
+    if (build_fixture(&table, prob, alias) != 0) return 0;
+
+    uint32_t out[150];
+    ct_alias_draw_range(&table, 0xDEADBEEFULL, 3, 5, 150, out);
+    for (uint32_t j = 0; j < 150; j++) {
+        if (out[j] != ct_alias_draw(&table, 0xDEADBEEFULL, 3, 5 + j)) return 0;
+    }
+    return 1;
+}
+
+static int test_alias_frequencies(void)
+{
+    uint32_t prob[ALIAS_N], alias[ALIAS_N];
+    ct_alias_table_t table;
+    if (build_fixture(&table, prob, alias) != 0) return 0;
+
+    /* 1000 expected draws per unit of weight */
+    static uint32_t out[28000];
+    uint32_t count[ALIAS_N] = { 0 };
+    ct_alias_draw_range(&table, 42, 0, 0, 28000, out);
+    for (uint32_t j = 0; j < 28000; j++) {
+        count[out[j]]++;
+    }
+    for (uint32_t i = 0; i < ALIAS_N; i++) {
+        uint32_t expect = 1000U * ALIAS_WEIGHTS[i];
+        uint32_t slack = expect / 8U;
+        if (count[i] + slack < expect || count[i] > expect + slack) return 0;
+    }
+    return count[4] == 0;
+}
+
+static int test_alias_deterministic(void)
+{
+    uint32_t prob[ALIAS_N], alias[ALIAS_N];
+    ct_alias_table_t table;
+    if (build_fixture(&table, prob, alias) != 0) return 0;
+
+    uint32_t a[64], b[64], c[64];
+    ct_alias_draw_range(&table, 7, 1, 0, 64, a);
+    ct_alias_draw_range(&table, 7, 1, 0, 64, b);
+    ct_alias_draw_range(&table, 7, 2, 0, 64, c);
+    return memcmp(a, b, sizeof(a)) == 0 && memcmp(a, c, sizeof(a)) != 0;
+}
+
+static int test_alias_hash_binds_weights(void)
+{
+    uint32_t prob[ALIAS_N], alias[ALIAS_N], work[ALIAS_N];
+    ct_alias_table_t a, b;
+    if (build_fixture(&a, prob, alias) != 0) return 0;
+    ct_hash_t first;
+    memcpy(first, a.table_hash, 32);
+    if (build_fixture(&a, prob, alias) != 0) return 0;
+    if (memcmp(first, a.table_hash, 32) != 0) return 0;
+
+    uint32_t weights[ALIAS_N];
+    memcpy(weights, ALIAS_WEIGHTS, sizeof(weights));
+    weights[4] = 1;
+    if (ct_alias_build(&b, weights, ALIAS_N, prob, alias, work) != 0) return 0;
+    return memcmp(first, b.table_hash, 32) != 0;
+}
+
+/* ============================================================================
+ * Test: Stratified Ordering (CT-MATH-001 §7.7)
+ * ============================================================================ */
+
+#define STRATA_N  20
+#define STRATA_C  3
+static const uint32_t STRATA_LABELS[STRATA_N] = {
+    0, 1, 0, 2, 0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0
+};
+static const uint32_t STRATA_QUOTA[STRATA_C] = { 2, 1, 1 };
+
+static uint32_t g_offsets[STRATA_C + 1], g_members[STRATA_N], g_slots[4], g_work[STRATA_C];
+
+static int build_strata(ct_strata_t *s)
+{
+    return ct_strata_build(s, STRATA_LABELS, STRATA_N, STRATA_QUOTA, STRATA_C,
+                           g_offsets, g_members, g_slots, g_work);
+}
+
+static int test_strata_build(void)
+{
+    ct_strata_t s;
+    if (build_strata(&s) != 0) return 0;
+    if (s.batch_size != 4 || s.num_samples != STRATA_N) return 0;
+    if (g_offsets[0] != 0 || g_offsets[1] != 14 || g_offsets[2] != 17 || g_offsets[3] != 20) return 0;
+
+    /* Grouped by class, ascending within a class */
+    for (uint32_t c = 0; c < STRATA_C; c++) {
+        for (uint32_t k = g_offsets[c]; k < g_offsets[c + 1]; k++) {
+            if (STRATA_LABELS[g_members[k]] != c) return 0;
+            if (k > g_offsets[c] && g_members[k] <= g_members[k - 1]) return 0;
+        }
+    }
+
+    /* Class 0 takes slots 0 and 3, classes 1 and 2 the middle */
+    static const uint32_t expect[4] = { 0, 3, 1, 2 };
+    return memcmp(g_slots, expect, sizeof(expect)) == 0;
+}
+
+static int test_strata_rejects(void)
+{
+    ct_strata_t s;
+    memset(&s, 0, sizeof(s));
+    uint32_t labels[STRATA_N];
+    memcpy(labels, STRATA_LABELS, sizeof(labels));
+    uint32_t quota[STRATA_C] = { 0, 0, 0 };
+
+    if (ct_strata_build(&s, labels, 0, STRATA_QUOTA, STRATA_C, g_offsets, g_members, g_slots, g_work) != -1) return 0;
+    if (ct_strata_build(&s, labels, STRATA_N, quota, STRATA_C, g_offsets, g_members, g_slots, g_work) != -1) return 0;
+    labels[7] = STRATA_C;
+    if (ct_strata_build(&s, labels, STRATA_N, STRATA_QUOTA, STRATA_C, g_offsets, g_members, g_slots, g_work) != -1) return 0;
+
+    /* Class 3 has a quota but no samples */
+    uint32_t quota4[4] = { 1, 1, 1, 1 };
+    uint32_t offsets4[5], work4[4];
+    labels[7] = 0;
+    if (ct_strata_build(&s, labels, STRATA_N, quota4, 4, offsets4, g_members, g_slots, work4) != -1) return 0;
+    return s.members == NULL && s.num_samples == 0;
+}
+
+static int test_strata_class_mix(void)
+{
+    ct_strata_t s;
+    if (build_strata(&s) != 0) return 0;
+
+    /* Class 2 has 3 members: positions 0..2 and 3..5 are two full passes */
+    uint32_t idx[6];
+    ct_strata_class_range(&s, 99, 4, 2, 0, 6, idx);
+    uint32_t seen = 0;
+    for (uint32_t k = 0; k < 6; k++) {
+        if (STRATA_LABELS[idx[k]] != 2) return 0;
+        seen |= 1U << idx[k];
+        if (k == 2 && seen != ((1U << 3) | (1U << 8) | (1U << 15))) return 0;
+    }
+    if (seen != ((1U << 3) | (1U << 8) | (1U << 15))) return 0;
+
+    /* A run across a pass boundary matches position by position */
+    for (uint32_t k = 0; k < 6; k++) {
+        uint32_t one;
+        ct_strata_class_range(&s, 99, 4, 2, 2 + k, 1, &one);
+        uint32_t run[6];
+        ct_strata_class_range(&s, 99, 4, 2, 2, 6, run);
+        if (one != run[k]) return 0;
+    }
+
+    /* Class 0 (14 members, 2 per batch) covers every member in 7 batches */
+    uint32_t all[14];
+    ct_strata_class_range(&s, 99, 4, 0, 0, 14, all);
+    uint32_t mask = 0;
+    for (uint32_t k = 0; k < 14; k++) {
+        if (STRATA_LABELS[all[k]] != 0 || (mask & (1U << all[k])) != 0) return 0;
+        mask |= 1U << all[k];
+    }
+    return 1;
+}
+
+static int test_strata_deterministic(void)
+{
+    ct_strata_t s;
+    if (build_strata(&s) != 0) return 0;
+    ct_hash_t first;
+    memcpy(first, s.strata_hash, 32);
+
+    uint32_t a[14], b[14], c[14];
+    ct_strata_class_range(&s, 5, 0, 0, 0, 14, a);
+    ct_strata_class_range(&s, 5, 0, 0, 0, 14, b);
+    ct_strata_class_range(&s, 5, 1, 0, 0, 14, c);
+    if (memcmp(a, b, sizeof(a)) != 0 || memcmp(a, c, sizeof(a)) == 0) return 0;
+
+    /* The commitment follows labels and quotas */
+    uint32_t quota[STRATA_C] = { 1, 2, 1 };
+    uint32_t slots[4];
+    if (build_strata(&s) != 0 || memcmp(first, s.strata_hash, 32) != 0) return 0;
+    if (ct_strata_build(&s, STRATA_LABELS, STRATA_N, quota, STRATA_C,
+                        g_offsets, g_members, slots, g_work) != 0) return 0;
+    return memcmp(first, s.strata_hash, 32) != 0;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -331,6 +601,7 @@ int main(void)
     printf("\nDeterminism:\n");
     RUN_TEST(test_determinism_same_inputs);
     RUN_TEST(test_determinism_sequence);
+    RUN_TEST(test_determinism_range_matches_index);
     
     printf("\nRange validity:\n");
     RUN_TEST(test_range_all_outputs_valid);
@@ -343,6 +614,20 @@ int main(void)
     printf("\nVerification function:\n");
     RUN_TEST(test_verify_valid_bijection);
     
+    printf("\nWeighted sampling (CT-MATH-001 §7.6):\n");
+    RUN_TEST(test_alias_build_exact);
+    RUN_TEST(test_alias_build_rejects);
+    RUN_TEST(test_alias_range_matches_draw);
+    RUN_TEST(test_alias_frequencies);
+    RUN_TEST(test_alias_deterministic);
+    RUN_TEST(test_alias_hash_binds_weights);
+    
+    printf("\nStratified ordering (CT-MATH-001 §7.7):\n");
+    RUN_TEST(test_strata_build);
+    RUN_TEST(test_strata_rejects);
+    RUN_TEST(test_strata_class_mix);
+    RUN_TEST(test_strata_deterministic);
+    
     printf("\n==============================================\n");
     printf("Results: %d/%d tests passed\n", tests_passed, tests_run);
     printf("==============================================\n");